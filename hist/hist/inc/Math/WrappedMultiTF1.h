@@ -20,6 +20,7 @@
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <type_traits>
 
 namespace ROOT {
 
@@ -160,6 +161,19 @@ namespace ROOT {
             return fFunc->EvalPar(x, p);
          }
 
+         /// evaluate function at many points passing the coordinate arrays x and vector of parameters
+         /// use TF1::EvalParBatch when the TF1 dimension is the same as the wrapped one
+         void DoEvalParBatch(unsigned int n, const T *const *x, const double *p, T *result) const override
+         {
+            if constexpr (std::is_same<T, double>::value) {
+               if (fDim == static_cast<unsigned int>(fFunc->GetNdim())) {
+                  fFunc->EvalParBatch(n, x, result, p);
+                  return;
+               }
+            }
+            BaseParamFunc::DoEvalParBatch(n, x, p, result);
+         }
+
          /// evaluate function using the cached parameter values (of TF1)
          /// re-implement for better efficiency
          T DoEvalVec(const T *x) const
@@ -25,6 +25,8 @@
 #include "TAttAxis.h"
 #include "TArrayD.h"
 
+#include <vector>
+
 class THashList;
 class TAxisModLab;
 
@@ -43,6 +45,9 @@ private:
    TObject     *fParent;        ///<! Object owning this axis
    THashList   *fLabels;        ///<  List of labels
    TList       *fModLabs;       ///<  List of modified labels
+   Double_t     fInvBinWidth = 0;    ///<! fNbins/(fXmax-fXmin), used by FindBin for fix bins
+   Double_t     fInvLookupWidth = 0; ///<! Inverse of the distance between the points of fBinLookup
+   std::vector<Int_t> fBinLookup;    ///<! Bins containing equidistant points of a variable bin axis
 
    /// TAxis extra status bits (stored in fBits2)
    enum {
@@ -52,6 +57,8 @@ private:
    };
 
    Bool_t       HasBinWithoutLabel() const;
+   Int_t        FindBinInRange(Double_t x) const;
+   void         UpdateFindBinCache();
 
 
    TAxisModLab *FindModLab(Int_t num, Double_t v = 0., Double_t eps = 0.) const;
@@ -161,7 +168,7 @@ public:
                                   Double_t labSize = -1., Int_t labAlign = -1,
                                   Int_t labColor = -1 , Int_t labFont = -1,
                                   const TString &labText = ""); // *MENU*
-   virtual void       SetLimits(Double_t xmin, Double_t xmax) { /* set axis limits */ fXmin = xmin; fXmax = xmax; } // *MENU*
+   virtual void       SetLimits(Double_t xmin, Double_t xmax) { /* set axis limits */ fXmin = xmin; fXmax = xmax; UpdateFindBinCache(); } // *MENU*
            void       SetMoreLogLabels(Bool_t more=kTRUE);  // *TOGGLE* *GETTER=GetMoreLogLabels
            void       SetNoExponent(Bool_t noExponent=kTRUE);  // *TOGGLE* *GETTER=GetNoExponent
    virtual void       SetParent(TObject *obj) {fParent = obj;}
@@ -107,6 +107,8 @@ private:
    CallFuncSignature fFuncPtr = nullptr;           ///<! Function pointer, owned by the JIT.
    CallFuncSignature fGradFuncPtr = nullptr;       ///<! Function pointer, owned by the JIT.
    CallFuncSignature fHessFuncPtr = nullptr;       ///<! Function pointer, owned by the JIT.
+   std::string       fBatchGenerationInput;        ///<! Input code of the function evaluating the formula over arrays
+   std::atomic<CallFuncSignature> fBatchFuncPtr{nullptr}; ///<! Function pointer, owned by the JIT.
    void *   fLambdaPtr = nullptr;                  ///<! Pointer to the lambda function
    static bool       fIsCladRuntimeIncluded;
 
@@ -137,6 +139,12 @@ private:
    bool HasHessianGenerationFailed() const {
       return !fHessFuncPtr && !fHessGenerationInput.empty();
    }
+   std::string GetBatchFuncName() const {
+      // the loop over the points depends on the number of dimensions
+      return std::string(GetUniqueFuncName().Data()) + "_batch_" + std::to_string(fNdim) + "d_" +
+             std::to_string(fNpar) + "p";
+   }
+   bool GenerateBatchEval();
 
 protected:
 
@@ -200,6 +208,8 @@ public:
    template <typename... Args>
    Double_t       Eval(Args... args) const;
    Double_t       EvalPar(const Double_t *x, const Double_t *params = nullptr) const;
+   void           EvalParBatch(Long64_t n, const Double_t *const *x, Double_t *result,
+                               const Double_t *params = nullptr) const;
 
    /// Generate gradient computation routine with respect to the parameters.
    /// \returns true if a gradient was generated and GradientPar can be called.
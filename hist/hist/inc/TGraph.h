@@ -29,6 +29,10 @@
 #include "TVectorDfwd.h"
 #include "TFitResultPtr.h"
 
+#include "ROOT/RSpan.hxx"
+
+#include <atomic>
+
 class TBrowser;
 class TAxis;
 class TH1;
@@ -38,6 +42,12 @@ class TF1;
 class TSpline;
 class TList;
 
+namespace ROOT {
+namespace Internal {
+class TGraphEvalCache;
+}
+}
+
 class TGraph : public TNamed, public TAttLine, public TAttFill, public TAttMarker {
 
 protected:
@@ -51,6 +61,7 @@ protected:
    Double_t           fMinimum;   ///< Minimum value for plotting along y
    Double_t           fMaximum;   ///< Maximum value for plotting along y
    TString fOption;               ///< Options used for drawing the graph
+   mutable std::atomic<ROOT::Internal::TGraphEvalCache *> fEvalCache{nullptr}; ///<! Sorted points (and spline) used by Eval
 
    static void        SwapValues(Double_t* arr, Int_t pos1, Int_t pos2);
    virtual void       SwapPoints(Int_t pos1, Int_t pos2);
@@ -66,6 +77,8 @@ protected:
    Double_t         **ShrinkAndCopy(Int_t size, Int_t iend);
    virtual Bool_t     DoMerge(const TGraph * g);
 
+   ROOT::Internal::TGraphEvalCache *GetEvalCache(Bool_t spline) const;
+
    TString            SaveArray(std::ostream &out, const char *suffix, Int_t frameNumber, Double_t *arr);
    void               SaveHistogramAndFunctions(std::ostream &out, const char *varname, Int_t &frameNumber, Option_t *option);
 
@@ -112,6 +125,7 @@ public:
    virtual void          DrawGraph(Int_t n, const Double_t *x=nullptr, const Double_t *y=nullptr, Option_t *option="");
    virtual void          DrawPanel(); // *MENU*
    virtual Double_t      Eval(Double_t x, TSpline *spline=nullptr, Option_t *option="") const;
+   void                  Eval(std::span<const Double_t> x, std::span<Double_t> y, Option_t *option="") const;
    void                  ExecuteEvent(Int_t event, Int_t px, Int_t py) override;
    virtual void          Expand(Int_t newsize);
    virtual void          Expand(Int_t newsize, Int_t step);
@@ -178,6 +192,7 @@ public:
    void                  RecursiveRemove(TObject *obj) override;
    virtual Int_t         RemovePoint(); // *MENU*
    virtual Int_t         RemovePoint(Int_t ipoint);
+   void                  ResetEvalCache();
    void                  SavePrimitive(std::ostream &out, Option_t *option = "") override;
    void                  SaveAs(const char *filename = "graph", Option_t *option = "") const override; // *MENU*
    virtual void          Scale(Double_t c1=1., Option_t *option="y"); // *MENU*
@@ -42,6 +42,8 @@
 
 #include "TFitResultPtr.h"
 
+#include "ROOT/RSpan.hxx"
+
 #include <cfloat>
 #include <string>
 
@@ -220,6 +222,7 @@ public:
    virtual Int_t    Fill(Double_t x);
    virtual Int_t    Fill(Double_t x, Double_t w);
    virtual Int_t    Fill(const char *name, Double_t w);
+           void     Fill(std::span<const Double_t> x, std::span<const Double_t> w = {});
    virtual void     FillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride=1);
    virtual void     FillN(Int_t, const Double_t *, const Double_t *, const Double_t *, Int_t) {}
    virtual void     FillRandom(const char *fname, Int_t ntimes=5000, TRandom * rng = nullptr);
@@ -78,6 +78,7 @@ public:
            void     Copy(TObject &hnew) const override;
            Int_t    Fill(Double_t x, Double_t y) override;
    virtual Int_t    Fill(Double_t x, Double_t y, Double_t w);
+           void     Fill(std::span<const Double_t> x, std::span<const Double_t> y, std::span<const Double_t> w = {});
    virtual Int_t    Fill(Double_t x, const char *namey, Double_t w);
    virtual Int_t    Fill(const char *namex, Double_t y, Double_t w);
    virtual Int_t    Fill(const char *namex, const char *namey, Double_t w);
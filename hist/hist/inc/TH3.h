@@ -83,6 +83,8 @@ public:
            void     Copy(TObject &hnew) const override;
    virtual Int_t    Fill(Double_t x, Double_t y, Double_t z);
    virtual Int_t    Fill(Double_t x, Double_t y, Double_t z, Double_t w);
+           void     Fill(std::span<const Double_t> x, std::span<const Double_t> y, std::span<const Double_t> z,
+                         std::span<const Double_t> w = {});
 
    virtual Int_t    Fill(const char *namex, const char *namey, const char *namez, Double_t w);
    virtual Int_t    Fill(const char *namex, Double_t y, const char *namez, Double_t w);
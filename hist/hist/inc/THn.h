@@ -20,6 +20,8 @@
 
 #include "TAxis.h"
 
+#include <functional>
+
 class TH1;
 class TH1D;
 class TH2D;
@@ -32,6 +34,7 @@ class THn: public THnBase {
 protected:
    void AllocCoordBuf() const;
    void InitStorage(Int_t* nbins, Int_t chunkSize) override;
+   static void ForEachBinRange(Long64_t nbins, const std::function<void(Long64_t, Long64_t)> &func);
 
    THn() = default;
    THn(const char* name, const char* title, Int_t dim, const Int_t* nbins,
@@ -236,6 +239,29 @@ public:
    TNDArray& GetArray() override { return fArray; }
 
 protected:
+   /// Add c * the bins of h if it is a THnT<T>, directly on the typed arrays,
+   /// and with implicit multi-threading enabled in parallel over bin ranges.
+   Bool_t AddBinsDirect(const THnBase* hbase, Double_t c) override {
+      const THnT* h = dynamic_cast<const THnT*>(hbase);
+      if (!h || h->GetNbins() != GetNbins())
+         return kFALSE;
+      const Bool_t haveErrors = GetCalculateErrors();
+      const Bool_t otherErrors = h->GetCalculateErrors();
+      // trigger the lazy allocation before the bins are updated concurrently
+      fArray.At(ULong64_t(0));
+      if (haveErrors)
+         fSumw2.At(ULong64_t(0));
+      ForEachBinRange(GetNbins(), [&](Long64_t first, Long64_t last) {
+         for (Long64_t i = first; i < last; ++i) {
+            const T v = h->fArray.At(ULong64_t(i));
+            fArray.At(ULong64_t(i)) += (T) (c * v);
+            if (haveErrors)
+               fSumw2.At(ULong64_t(i)) += c * c * (otherErrors ? h->fSumw2.At(ULong64_t(i)) : (Double_t) v);
+         }
+      });
+      return kTRUE;
+   }
+
    TNDArrayT<T> fArray; ///< Bin content
    ClassDefOverride(THnT, 1);   ///< Multi-dimensional histogram with templated storage
 };
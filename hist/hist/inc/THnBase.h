@@ -111,6 +111,9 @@ protected:
                           Bool_t wantNDim, Option_t* option = "") const;
    Bool_t PrintBin(Long64_t idx, Int_t* coord, Option_t* options) const;
    void AddInternal(const THnBase* h, Double_t c, Bool_t rebinned);
+   /// Add c * the bin contents (and errors) of h, which has the same binning,
+   /// bypassing the generic bin iteration. Return kFALSE if not supported for h.
+   virtual Bool_t AddBinsDirect(const THnBase* /*h*/, Double_t /*c*/) { return kFALSE; }
    THnBase* RebinBase(Int_t group) const;
    THnBase* RebinBase(const Int_t* group) const;
    void ResetBase(Option_t *option= "");
@@ -21,9 +21,10 @@
 
 
 #include "THnBase.h"
-#include "TExMap.h"
 #include "THnSparse_Internal.h"
 
+#include <vector>
+
 // needed only for template instantiations of THnSparseT:
 #include "TArrayF.h"
 #include "TArrayL.h"
@@ -39,10 +40,12 @@ class THnSparse: public THnBase {
    Int_t      fChunkSize;                   ///<  Number of entries for each chunk
    Long64_t   fFilledBins;                  ///<  Number of filled bins
    TObjArray  fBinContent;                  ///<  Array of THnSparseArrayChunk
-   TExMap     fBins;                        ///<! Filled bins
-   TExMap     fBinsContinued;               ///<! Filled bins for non-unique hashes, containing pairs of (bin index 0, bin index 1)
+   std::vector<ULong64_t> fBinTable;        ///<! Open-addressing hash table of filled bins, pairs of (hash, bin index + 1)
    THnSparseCompactBinCoord *fCompactCoord; ///<! Compact coordinate
 
+   void InsertBinIndex(ULong64_t hash, Long64_t idx);
+   void ResizeBinTable(Long64_t nbins);
+
    THnSparse(const THnSparse&) = delete;
    THnSparse& operator=(const THnSparse&) = delete;
 
@@ -58,9 +61,10 @@ class THnSparse: public THnBase {
 
    THnSparseArrayChunk* AddChunk();
    void Reserve(Long64_t nbins) override;
-   void FillExMap();
+   void FillBinTable();
    virtual TArray* GenerateArray() const = 0;
    Long64_t GetBinIndexForCurrentBin(Bool_t allocate);
+   Bool_t AddBinsDirect(const THnBase* h, Double_t c) override;
 
    /// Increment the bin content of "bin" by "w",
    /// return the bin index.
@@ -100,6 +104,8 @@ class THnSparse: public THnBase {
    Long64_t GetBin(const Double_t* x, Bool_t allocate = kTRUE) override;
    Long64_t GetBin(const char* name[], Bool_t allocate = kTRUE) override;
 
+   void FillN(Long64_t n, const Double_t* x, const Double_t* w = nullptr);
+
    /// Forwards to THnBase::SetBinContent().
    /// Non-virtual, CINT-compatible replacement of a using declaration.
    void SetBinContent(const Int_t* idx, Double_t v) {
@@ -213,6 +219,19 @@ class THnSparseT: public THnSparse {
       THnSparse(name, title, dim, nbins, xmin, xmax, chunksize) {}
 
    TArray* GenerateArray() const override { return new CONT(GetChunkSize()); }
+
+ protected:
+   /// Increment the bin content of "bin" by "w", accessing the typed
+   /// content array directly instead of through TArray's virtual interface.
+   void FillBin(Long64_t bin, Double_t w) override {
+      THnSparseArrayChunk* chunk = GetChunk(bin / GetChunkSize());
+      const Int_t idx = bin % GetChunkSize();
+      static_cast<CONT*>(chunk->fContent)->fArray[idx] += w;
+      if (chunk->fSumw2)
+         chunk->fSumw2->fArray[idx] += w * w;
+      FillBinBase(w);
+   }
+
  private:
    ClassDefOverride(THnSparseT, 1); // Sparse n-dimensional histogram with templated content
 };
@@ -98,6 +98,7 @@ public:
    Int_t    Fill(Double_t x, Double_t y) override;
    Int_t    Fill(const char *namex, Double_t y) override;
    virtual Int_t    Fill(Double_t x, Double_t y, Double_t w);
+           void     Fill(std::span<const Double_t> x, std::span<const Double_t> y, std::span<const Double_t> w = {});
    virtual Int_t    Fill(const char *namex, Double_t y, Double_t w);
    void     FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *w, Int_t stride=1) override;
    Double_t GetBinContent(Int_t bin) const override;
@@ -26,6 +26,7 @@
 #include "strlcpy.h"
 #include "snprintf.h"
 
+#include <algorithm>
 #include <iostream>
 #include <ctime>
 #include <cassert>
@@ -59,6 +60,7 @@ TAxis::TAxis(): TNamed(), TAttAxis()
    fModLabs = nullptr;
    fBits2   = 0;
    fTimeDisplay = false;
+   UpdateFindBinCache();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -228,6 +230,7 @@ void TAxis::Copy(TObject &obj) const
    axis.fTimeFormat   = fTimeFormat;
    axis.fTimeDisplay  = fTimeDisplay;
    axis.fParent       = fParent;
+   axis.UpdateFindBinCache();
    if (axis.fLabels) {
       axis.fLabels->Delete();
       delete axis.fLabels;
@@ -297,6 +300,8 @@ Int_t TAxis::FindBin(Double_t x)
    // but it is heavily used (legacy) in the TTreePlayer to fill alphanumeric histograms.
    // but in case of alphanumeric do-not extend the axis. It makes no sense
    if (IsAlphanumeric() && gDebug) Info("FindBin","Numeric query on alphanumeric axis - Sorting the bins or extending the axes / rebinning can alter the correspondence between the label and the bin interval.");
+   if (x >= fXmin && x < fXmax)  //*-* most common case first
+      return FindBinInRange(x);
    if (x < fXmin) {              //*-* underflow
       bin = 0;
       if (fParent == nullptr) return bin;
@@ -309,13 +314,6 @@ Int_t TAxis::FindBin(Double_t x)
       if (!CanExtend() || IsAlphanumeric() ) return bin;
       ((TH1*)fParent)->ExtendAxis(x,this);
       return FindFixBin(x);
-   } else {
-      if (!fXbins.fN) {        //*-* fix bins
-         bin = 1 + int (fNbins*(x-fXmin)/(fXmax-fXmin) );
-      } else {                  //*-* variable bin sizes
-         //for (bin =1; x >= fXbins.fArray[bin]; bin++);
-         bin = 1 + TMath::BinarySearch(fXbins.fN,fXbins.fArray,x);
-      }
    }
    return bin;
 }
@@ -351,6 +349,7 @@ Int_t TAxis::FindBin(const char *label)
             //L.M. Dec 2010 in case of no min and max specified use 0 ->NBINS
             fXmin = 0;
             fXmax = fNbins;
+            UpdateFindBinCache();
          }
       }
    }
@@ -424,16 +423,73 @@ Int_t TAxis::FindFixBin(Double_t x) const
    } else  if ( !(x < fXmax)) {     //*-* overflow  (note the way to catch NaN
       bin = fNbins+1;
    } else {
-      if (!fXbins.fN) {        //*-* fix bins
-         bin = 1 + int (fNbins*(x-fXmin)/(fXmax-fXmin) );
-      } else {                  //*-* variable bin sizes
-//         for (bin =1; x >= fXbins.fArray[bin]; bin++);
-         bin = 1 + TMath::BinarySearch(fXbins.fN,fXbins.fArray,x);
-      }
+      bin = FindBinInRange(x);
    }
    return bin;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Find bin number corresponding to abscissa x, with fXmin <= x < fXmax.
+///
+/// For fix bins, the multiplication by the precomputed inverse bin width can
+/// differ in the last digit from the division done originally, which matters
+/// only next to a bin edge: there the exact expression is used, so the result
+/// is always the same. For variable bins, fBinLookup restricts the binary
+/// search to the few edges around x.
+
+Int_t TAxis::FindBinInRange(Double_t x) const
+{
+   if (!fXbins.fN) {        //*-* fix bins
+      const Double_t t = (x - fXmin) * fInvBinWidth;
+      const Int_t bin = Int_t(t);
+      constexpr Double_t kEdgeTolerance = 1e-6;
+      if (t - bin > kEdgeTolerance && t - bin < 1 - kEdgeTolerance)
+         return 1 + bin;
+      return 1 + int (fNbins*(x-fXmin)/(fXmax-fXmin) );
+   }
+   //*-* variable bin sizes
+   const Double_t *edges = fXbins.fArray;
+   if (!fBinLookup.empty()) {
+      const Int_t ncells = fBinLookup.size() - 1;
+      const Double_t t = (x - edges[0]) * fInvLookupWidth;
+      const Int_t cell = t <= 0 ? 0 : (t >= ncells ? ncells - 1 : Int_t(t));
+      const Double_t *first = edges + fBinLookup[cell];
+      const Double_t *last = edges + fBinLookup[cell + 1] + 2;
+      const Double_t *pos = std::lower_bound(first, last, x);
+      // at the ends of the range x may be outside of it (rounding, or edges equal to x)
+      if (pos != first && pos != last)
+         return (*pos == x) ? 1 + Int_t(pos - edges) : Int_t(pos - edges);
+   }
+   return 1 + TMath::BinarySearch(fXbins.fN,edges,x);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Precompute the quantities used by FindBin and FindFixBin. Must be called
+/// whenever the number of bins, the limits or the bin edges change.
+
+void TAxis::UpdateFindBinCache()
+{
+   fInvBinWidth = (fXmax > fXmin) ? fNbins / (fXmax - fXmin) : 0.;
+   fBinLookup.clear();
+   fInvLookupWidth = 0;
+   // a binary search on a few edges is as fast as the lookup
+   constexpr Int_t kMinBinsForLookup = 32;
+   constexpr Int_t kMaxLookupCells = 8192;
+   if (fXbins.fN < kMinBinsForLookup + 1 || fXbins.fN != fNbins + 1)
+      return;
+   const Double_t *edges = fXbins.fArray;
+   const Double_t length = edges[fNbins] - edges[0];
+   if (!(length > 0))
+      return;
+   const Int_t ncells = std::min(2 * fNbins, kMaxLookupCells);
+   fInvLookupWidth = ncells / length;
+   fBinLookup.resize(ncells + 1);
+   for (Int_t i = 0; i <= ncells; ++i) {
+      const Int_t bin = TMath::BinarySearch(fXbins.fN, edges, edges[0] + i * (length / ncells));
+      fBinLookup[i] = std::clamp(bin, 0, fNbins - 1);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return label for bin
 
@@ -798,6 +854,7 @@ void TAxis::Set(Int_t nbins, Double_t xlow, Double_t xup)
    fXmax    = xup;
    if (!fParent) SetDefaults();
    if (fXbins.fN > 0) fXbins.Set(0);
+   UpdateFindBinCache();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -816,6 +873,7 @@ void TAxis::Set(Int_t nbins, const Float_t *xbins)
    fXmin      = fXbins.fArray[0];
    fXmax      = fXbins.fArray[fNbins];
    if (!fParent) SetDefaults();
+   UpdateFindBinCache();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -834,6 +892,7 @@ void TAxis::Set(Int_t nbins, const Double_t *xbins)
    fXmin      = fXbins.fArray[0];
    fXmax      = fXbins.fArray[fNbins];
    if (!fParent) SetDefaults();
+   UpdateFindBinCache();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1220,6 +1279,7 @@ void TAxis::Streamer(TBuffer &R__b)
       Version_t R__v = R__b.ReadVersion(&R__s, &R__c);
       if (R__v > 5) {
          R__b.ReadClassBuffer(TAxis::Class(), this, R__v, R__s, R__c);
+         UpdateFindBinCache();
          return;
       }
       //====process old versions before automatic schema evolution
@@ -1255,6 +1315,7 @@ void TAxis::Streamer(TBuffer &R__b)
       } else {
          SetTimeFormat();
       }
+      UpdateFindBinCache();
       R__b.CheckByteCount(R__s, R__c, TAxis::IsA());
       //====end of old versions
 
@@ -9,14 +9,18 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
+#include <vector>
 #include "strlcpy.h"
 #include "snprintf.h"
 #include "TROOT.h"
 #include "TBuffer.h"
 #include "TMath.h"
 #include "TF1.h"
+#include "TF2.h"
+#include "TF3.h"
 #include "TH1.h"
 #include "TGraph.h"
 #include "TVirtualPad.h"
@@ -1530,6 +1534,42 @@ Double_t TF1::EvalPar(const Double_t *x, const Double_t *params)
    return result;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the function at `n` points with the parameters `params` (or the
+/// function's own parameters if null), and write the `n` results into `result`.
+/// The points are given as one array of `n` values per dimension, i.e. the
+/// i-th point is `(x[0][i], x[1][i], ...)`.
+///
+/// Formula-based TF1, TF2 and TF3 objects are evaluated through
+/// TFormula::EvalParBatch(), which compiles the formula in a loop over the
+/// points; all other functions are evaluated point by point with EvalPar().
+
+void TF1::EvalParBatch(Long64_t n, const Double_t *const *x, Double_t *result, const Double_t *params)
+{
+   if (n <= 0)
+      return;
+
+   // classes deriving from TF1 may override EvalPar()
+   const TClass *cl = IsA();
+   if (fType == EFType::kFormula && (cl == TF1::Class() || cl == TF2::Class() || cl == TF3::Class())) {
+      assert(fFormula);
+      fFormula->EvalParBatch(n, x, result, params);
+      if (fNormalized && fNormIntegral != 0) {
+         for (Long64_t i = 0; i < n; ++i)
+            result[i] /= fNormIntegral;
+      }
+      return;
+   }
+
+   std::vector<Double_t> point(std::max(fNdim, 1));
+   InitArgs(point.data(), params);
+   for (Long64_t i = 0; i < n; ++i) {
+      for (Int_t d = 0; d < fNdim; ++d)
+         point[d] = x[d][i];
+      result[i] = EvalPar(point.data(), params);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Execute action corresponding to one event.
 ///
@@ -3048,7 +3088,6 @@ void TF1::Paint(Option_t *option)
 TH1   *TF1::DoCreateHistogram(Double_t xmin, Double_t  xmax, Bool_t recreate)
 {
    Int_t i;
-   Double_t xv[1];
 
    TH1 *histogram = nullptr;
 
@@ -3118,11 +3157,14 @@ TH1   *TF1::DoCreateHistogram(Double_t xmin, Double_t  xmax, Bool_t recreate)
    histogram->GetYaxis()->SetTitle(ytitle.Data());
    Double_t *parameters = GetParameters();
 
-   InitArgs(xv, parameters);
-   for (i = 1; i <= fNpx; i++) {
-      xv[0] = histogram->GetBinCenter(i);
-      histogram->SetBinContent(i, EvalPar(xv, parameters));
-   }
+   std::vector<Double_t> xcenters(fNpx);
+   std::vector<Double_t> values(fNpx);
+   for (i = 1; i <= fNpx; i++)
+      xcenters[i - 1] = histogram->GetBinCenter(i);
+   const Double_t *xcolumns[1] = {xcenters.data()};
+   EvalParBatch(fNpx, xcolumns, values.data(), parameters);
+   for (i = 1; i <= fNpx; i++)
+      histogram->SetBinContent(i, values[i - 1]);
 
    // Copy Function attributes to histogram attributes.
    histogram->SetBit(TH1::kNoStats);
@@ -3201,12 +3243,11 @@ void TF1::Save(Double_t xmin, Double_t xmax, Double_t, Double_t, Double_t, Doubl
    if (npx <= 0)
       return;
    fSave.resize(npx + 3);
-   Double_t xv[1];
-   InitArgs(xv, parameters);
-   for (Int_t i = 0; i <= npx; i++) {
-      xv[0]    = xmin + dx * i;
-      fSave[i] = EvalPar(xv, parameters);
-   }
+   std::vector<Double_t> xv(npx + 1);
+   for (Int_t i = 0; i <= npx; i++)
+      xv[i] = xmin + dx * i;
+   const Double_t *xcolumns[1] = {xv.data()};
+   EvalParBatch(npx + 1, xcolumns, fSave.data(), parameters);
    fSave[npx + 1] = xmin;
    fSave[npx + 2] = xmax;
 }
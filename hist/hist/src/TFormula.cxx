@@ -23,6 +23,7 @@
 
 #include "ROOT/StringUtils.hxx"
 
+#include <algorithm>
 #include <array>
 #include <iostream>
 #include <memory>
@@ -757,6 +758,8 @@ void TFormula::Copy(TObject &obj) const
    fnew.fHessGenerationInput = fHessGenerationInput;
    fnew.fGradFuncPtr = fGradFuncPtr;
    fnew.fHessFuncPtr = fHessFuncPtr;
+   fnew.fBatchGenerationInput = fBatchGenerationInput;
+   fnew.fBatchFuncPtr = fBatchFuncPtr.load();
 
 }
 
@@ -2334,6 +2337,9 @@ void TFormula::ProcessFormula(TString &formula)
          // set the cling name using hash of the static formulae map
          auto hasher = gClingFunctions.hash_function();
          fClingName = TString::Format("%s__id%zu", gNamePrefix.Data(), hasher(inputFormulaVecFlag));
+         // the batch evaluation function is generated again on demand for the new expression
+         fBatchGenerationInput.clear();
+         fBatchFuncPtr = nullptr;
 
          fClingInput = TString::Format("%s %s(%s){ return %s ; }", argType.Data(), fClingName.Data(),
                                        argumentsPrototype.Data(), inputFormula.c_str());
@@ -3124,6 +3130,111 @@ static bool functionExists(const string &Name) {
    return gInterpreter->GetFunction(/*cl*/nullptr, Name.c_str());
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Declare to Cling a function evaluating the formula in a loop over arrays
+/// of points, `void <name>_batch_<ndim>d_<npar>p(Long64_t n, const Double_t *const *xs, Double_t *p, Double_t *out)`,
+/// and set fBatchFuncPtr. The loop body is the expression of the scalar function,
+/// so that the compiler can vectorize it. Returns true on success.
+
+bool TFormula::GenerateBatchEval()
+{
+   if (fBatchFuncPtr)
+      return true;
+
+   R__LOCKGUARD(gROOTMutex);
+   // check again in case another thread has generated it in the meantime
+   if (fBatchFuncPtr)
+      return true;
+   // did we fail before?
+   if (!fBatchGenerationInput.empty())
+      return false;
+
+   std::string clingFunc = fClingInput.Data();
+   std::size_t found = clingFunc.find("return");
+   std::size_t found2 = clingFunc.rfind(';');
+   if (found == std::string::npos || found2 == std::string::npos || found2 < found) {
+      fBatchGenerationInput = "invalid";
+      return false;
+   }
+   const std::string expression = clingFunc.substr(found + 7, found2 - found - 7);
+
+   const std::string funcName = GetBatchFuncName();
+   fBatchGenerationInput = "#pragma cling optimize(2)\n"
+                           "void " + funcName + "(Long64_t n, const Double_t *const *xs, Double_t *p, Double_t *out) {\n"
+                           "   (void) xs; (void) p;\n"
+                           "   for (Long64_t i = 0; i < n; ++i) {\n";
+   if (fNdim > 0) {
+      fBatchGenerationInput += "      Double_t x[" + std::to_string(fNdim) + "] = {";
+      for (Int_t i = 0; i < fNdim; ++i)
+         fBatchGenerationInput += (i ? ", xs[" : "xs[") + std::to_string(i) + "][i]";
+      fBatchGenerationInput += "};\n";
+   }
+   fBatchGenerationInput += "      out[i] = " + expression + ";\n"
+                            "   }\n"
+                            "}\n";
+
+   // another TFormula with the same expression and dimensions might have declared it already
+   if (!functionExists(funcName) && !gInterpreter->Declare(fBatchGenerationInput.c_str()))
+      return false;
+
+   TMethodCall method;
+   method.InitWithPrototype(funcName.c_str(), "Long64_t,const Double_t*const*,Double_t*,Double_t*");
+   if (!method.IsValid())
+      return false;
+   fBatchFuncPtr = prepareFuncPtr(&method);
+   return fBatchFuncPtr != nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the formula at `n` points, using the parameter values `params`
+/// (or the stored ones if null), and write the `n` results into `result`.
+/// The points are passed as one array of `n` values per variable, i.e. the
+/// i-th point is `(x[0][i], x[1][i], ...)`.
+///
+/// The first call compiles a function evaluating the formula expression in a
+/// loop over the points, which the compiler can vectorize; it is shared by all
+/// formulas with the same expression. Lambda expressions and vectorized
+/// formulas are evaluated point by point.
+
+void TFormula::EvalParBatch(Long64_t n, const Double_t *const *x, Double_t *result, const Double_t *params) const
+{
+   if (n <= 0)
+      return;
+
+   const Int_t ndim = fNdim;
+   std::vector<Double_t> point(std::max(ndim, 1));
+   auto evalPoint = [&](Long64_t i) {
+      for (Int_t d = 0; d < ndim; ++d)
+         point[d] = x[d][i];
+      return EvalPar(point.data(), params);
+   };
+
+   // The first point goes through the standard path, which also takes care of
+   // the (lazy) initialization of the formula and reports errors.
+   result[0] = evalPoint(0);
+   if (n == 1)
+      return;
+
+   const Bool_t canBatch = fReadyToExecute && fClingInitialized && !fVectorized && !TestBit(TFormula::kLambda) &&
+                           fClingInput.Length() > 0;
+   if (canBatch && const_cast<TFormula *>(this)->GenerateBatchEval()) {
+      std::vector<const Double_t *> xs(ndim);
+      for (Int_t d = 0; d < ndim; ++d)
+         xs[d] = x[d] + 1;
+      Long64_t nrest = n - 1;
+      const Double_t *const *vars = xs.data();
+      Double_t *pars = (fNpar <= 0) ? nullptr
+                                    : const_cast<Double_t *>(params ? params : fClingParameters.data());
+      Double_t *out = result + 1;
+      void *args[4] = {&nrest, &vars, &pars, &out};
+      (*fBatchFuncPtr.load())(nullptr, 4, args, /*ret*/ nullptr);
+      return;
+   }
+
+   for (Long64_t i = 1; i < n; ++i)
+      result[i] = evalPoint(i);
+}
+
 static void IncludeCladRuntime(Bool_t &IsCladRuntimeIncluded) {
    if (!IsCladRuntimeIncluded) {
       IsCladRuntimeIncluded = true;
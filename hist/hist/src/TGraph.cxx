@@ -40,6 +40,8 @@
 #include <fstream>
 #include <cstring>
 #include <numeric>
+#include <mutex>
+#include <algorithm>
 
 #include "HFitInterface.h"
 #include "Fit/DataRange.h"
@@ -237,6 +239,7 @@ TGraph& TGraph::operator=(const TGraph &gr)
       TAttFill::operator=(gr);
       TAttMarker::operator=(gr);
 
+      ResetEvalCache();
       fNpoints = gr.fNpoints;
       fMaxSize = gr.fMaxSize;
 
@@ -567,6 +570,7 @@ TGraph::~TGraph()
 {
    delete [] fX;
    delete [] fY;
+   delete fEvalCache.load();
    if (fFunctions) {
       fFunctions->SetBit(kInvalidObject);
       //special logic to support the case where the same object is
@@ -622,6 +626,7 @@ Double_t** TGraph::AllocateArrays(Int_t Narrays, Int_t arraySize)
 void TGraph::Add(TF1 *f, Double_t c1)
 {
    if (fHistogram) SetBit(kResetHisto);
+   ResetEvalCache();
 
    for (Int_t i = 0; i < fNpoints; i++) {
       fY[i] += c1*f->Eval(fX[i], fY[i]);
@@ -638,6 +643,7 @@ void TGraph::Add(TF1 *f, Double_t c1)
 void TGraph::Apply(TF1 *f)
 {
    if (fHistogram) SetBit(kResetHisto);
+   ResetEvalCache();
 
    for (Int_t i = 0; i < fNpoints; i++) {
       fY[i] = f->Eval(fX[i], fY[i]);
@@ -762,6 +768,7 @@ void TGraph::ComputeRange(Double_t &xmin, Double_t &ymin, Double_t &xmax, Double
 void TGraph::CopyAndRelease(Double_t **newarrays, Int_t ibegin, Int_t iend,
                             Int_t obegin)
 {
+   ResetEvalCache();
    CopyPoints(newarrays, ibegin, iend, obegin);
    if (newarrays) {
       delete[] fX;
@@ -935,6 +942,123 @@ void TGraph::DrawPanel()
    if (painter) painter->DrawPanelHelper(this);
 }
 
+namespace ROOT {
+namespace Internal {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Points of a TGraph sorted in X, and the coefficients of the TSpline3 through
+/// them, kept by TGraph::Eval between calls. The spline is only computed the
+/// first time it is needed.
+
+class TGraphEvalCache {
+private:
+   std::vector<Double_t> fX;        ///< Abscissas in increasing order
+   std::vector<Double_t> fY;        ///< Ordinates matching fX
+   std::vector<Double_t> fB;        ///< First order spline coefficients
+   std::vector<Double_t> fC;        ///< Second order spline coefficients
+   std::vector<Double_t> fD;        ///< Third order spline coefficients
+   std::once_flag fSplineOnce;      ///< Guards the computation of the spline coefficients
+
+   /// Return the index of the first point with abscissa >= x. `hint` is the
+   /// result of the previous call: if the queries are monotonic the answer is
+   /// usually found next to it without a binary search.
+   Int_t Locate(Double_t x, Int_t &hint) const
+   {
+      const Int_t n = fX.size();
+      for (Int_t pos = std::max(hint - 1, 0); pos <= std::min(hint + 2, n); ++pos) {
+         if ((pos == 0 || fX[pos - 1] < x) && (pos == n || fX[pos] >= x))
+            return hint = pos;
+      }
+      return hint = std::lower_bound(fX.begin(), fX.end(), x) - fX.begin();
+   }
+
+   void ComputeSpline()
+   {
+      const Int_t n = fX.size();
+      TSpline3 spline("", fX.data(), fY.data(), n);
+      fB.resize(n);
+      fC.resize(n);
+      fD.resize(n);
+      Double_t xi, yi;
+      for (Int_t i = 0; i < n; ++i)
+         spline.GetCoeff(i, xi, yi, fB[i], fC[i], fD[i]);
+   }
+
+public:
+   TGraphEvalCache(Int_t n, const Double_t *x, const Double_t *y, Bool_t isSorted) : fX(n), fY(n)
+   {
+      std::vector<Int_t> index(n);
+      if (isSorted)
+         std::iota(index.begin(), index.end(), 0);
+      else
+         TMath::Sort(n, x, index.data(), false);
+      for (Int_t i = 0; i < n; ++i) {
+         fX[i] = x[index[i]];
+         fY[i] = y[index[i]];
+      }
+   }
+
+   /// Make the spline coefficients available; safe to call from several threads.
+   void BuildSpline() { std::call_once(fSplineOnce, &TGraphEvalCache::ComputeSpline, this); }
+
+   /// Linear interpolation with the same results as TGraph::Eval on a graph sorted in X.
+   Double_t EvalLinear(Double_t x, Int_t &hint) const
+   {
+      const Int_t n = fX.size();
+      const Int_t pos = Locate(x, hint);
+      if (pos < n && fX[pos] == x)
+         return fY[pos];
+      const Int_t low = std::min(std::max(pos - 1, 0), n - 2);
+      const Int_t up = low + 1;
+      if (fX[low] == fX[up])
+         return fY[low];
+      return fY[up] + (x - fX[up]) * (fY[low] - fY[up]) / (fX[low] - fX[up]);
+   }
+
+   /// Cubic spline interpolation with the same results as TSpline3::Eval; requires BuildSpline().
+   Double_t EvalSpline(Double_t x, Int_t &hint) const
+   {
+      const Int_t n = fX.size();
+      const Int_t k = std::min(std::max(Locate(x, hint) - 1, 0), n - 2);
+      const Double_t dx = x - fX[k];
+      return fY[k] + dx * (fB[k] + dx * (fC[k] + dx * fD[k]));
+   }
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the evaluation cache of this graph, creating it if needed.
+/// If `spline` is true the spline coefficients are computed as well.
+
+ROOT::Internal::TGraphEvalCache *TGraph::GetEvalCache(Bool_t spline) const
+{
+   auto cache = fEvalCache.load();
+   if (!cache) {
+      auto newCache = new ROOT::Internal::TGraphEvalCache(fNpoints, fX, fY, TestBit(kIsSortedX));
+      // another thread may have been faster
+      if (fEvalCache.compare_exchange_strong(cache, newCache))
+         cache = newCache;
+      else
+         delete newCache;
+   }
+   if (spline)
+      cache->BuildSpline();
+   return cache;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Discard the sorted points and spline used by Eval with option "C" and by
+/// the batch Eval. This is done by all the functions modifying the points;
+/// it must be called explicitly after changing the points through the arrays
+/// returned by GetX() and GetY().
+
+void TGraph::ResetEvalCache()
+{
+   delete fEvalCache.exchange(nullptr);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Interpolate points in this graph at x using a TSpline.
 ///
@@ -949,6 +1073,13 @@ void TGraph::DrawPanel()
 ///   If the points are sorted in X a binary search is used (significantly faster)
 ///   One needs to set the bit  TGraph::SetBit(TGraph::kIsSortedX) before calling
 ///   TGraph::Eval to indicate that the graph is sorted in X.
+///
+///   With option "C" (alone or together with "S") a sorted copy of the points,
+///   and the spline coefficients for option "S", are kept between calls and a
+///   binary search is always used, whether the graph is sorted or not. This is
+///   much faster when the same graph is evaluated many times. The cache is
+///   discarded when the points are modified through the TGraph interface; see
+///   ResetEvalCache().
 
 Double_t TGraph::Eval(Double_t x, TSpline *spline, Option_t *option) const
 {
@@ -964,6 +1095,12 @@ Double_t TGraph::Eval(Double_t x, TSpline *spline, Option_t *option) const
    if (option && *option) {
       TString opt = option;
       opt.ToLower();
+      if (opt.Contains("c")) {
+         Int_t hint = 0;
+         if (opt.Contains("s"))
+            return GetEvalCache(kTRUE)->EvalSpline(x, hint);
+         return GetEvalCache(kFALSE)->EvalLinear(x, hint);
+      }
       // create a TSpline every time when using option "s" and no spline pointer is given
       if (opt.Contains("s")) {
 
@@ -1042,6 +1179,41 @@ Double_t TGraph::Eval(Double_t x, TSpline *spline, Option_t *option) const
    return yn;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Interpolate points in this graph at all the values of `x` and store the
+/// results in `y`, which must have the same size.
+///
+/// The cached sorted points of option "C" are always used: with option "S" a
+/// cubic spline interpolation is done, otherwise a linear one, as for the
+/// scalar Eval(). Consecutive values of `x` close to each other, in particular
+/// increasing or decreasing sequences, are located in constant time.
+
+void TGraph::Eval(std::span<const Double_t> x, std::span<Double_t> y, Option_t *option) const
+{
+   if (x.size() != y.size()) {
+      Error("Eval", "The input and output arrays have different sizes (%zu and %zu)", x.size(), y.size());
+      return;
+   }
+
+   if (fNpoints < 2) {
+      std::fill(y.begin(), y.end(), fNpoints == 0 ? 0. : fY[0]);
+      return;
+   }
+
+   TString opt = option;
+   opt.ToLower();
+   const Bool_t useSpline = opt.Contains("s");
+   const auto cache = GetEvalCache(useSpline);
+   Int_t hint = 0;
+   if (useSpline) {
+      for (std::size_t i = 0; i < x.size(); ++i)
+         y[i] = cache->EvalSpline(x[i], hint);
+   } else {
+      for (std::size_t i = 0; i < x.size(); ++i)
+         y[i] = cache->EvalLinear(x[i], hint);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Execute action corresponding to one event.
 ///
@@ -1056,6 +1228,8 @@ Double_t TGraph::Eval(Double_t x, TSpline *spline, Option_t *option) const
 void TGraph::ExecuteEvent(Int_t event, Int_t px, Int_t py)
 {
    TVirtualGraphPainter *painter = TVirtualGraphPainter::GetPainter();
+   // the painter may move points when they are dragged with the mouse
+   ResetEvalCache();
    if (painter) painter->ExecuteEventHelper(this, event, px, py);
 }
 
@@ -1769,6 +1943,7 @@ void TGraph::InsertPointBefore(Int_t ipoint, Double_t x, Double_t y)
    // To avoid redefinitions in descendant classes
    FillZero(ipoint, ipoint + 1);
 
+   ResetEvalCache();
    fX[ipoint] = x;
    fY[ipoint] = y;
 }
@@ -2259,6 +2434,7 @@ void TGraph::SaveHistogramAndFunctions(std::ostream &out, const char *varname, I
 void TGraph::Scale(Double_t c1, Option_t *option)
 {
    TString opt = option; opt.ToLower();
+   ResetEvalCache();
    if (opt.Contains("x")) {
       for (Int_t i=0; i<GetN(); i++)
          GetX()[i] *= c1;
@@ -2355,6 +2531,7 @@ void TGraph::SetPoint(Int_t i, Double_t x, Double_t y)
       FillZero(fNpoints, i + 1);
       fNpoints = i + 1;
    }
+   ResetEvalCache();
    fX[i] = x;
    fY[i] = y;
    if (gPad) gPad->Modified();
@@ -2516,6 +2693,7 @@ void TGraph::Sort(Bool_t (*greaterfunc)(const TGraph *, Int_t, Int_t) /*=TGraph:
 void TGraph::Streamer(TBuffer &b)
 {
    if (b.IsReading()) {
+      ResetEvalCache();
       UInt_t R__s, R__c;
       Version_t R__v = b.ReadVersion(&R__s, &R__c);
       if (R__v > 2) {
@@ -2582,6 +2760,7 @@ void TGraph::Streamer(TBuffer &b)
 
 void TGraph::SwapPoints(Int_t pos1, Int_t pos2)
 {
+   ResetEvalCache();
    SwapValues(fX, pos1, pos2);
    SwapValues(fY, pos1, pos2);
 }
@@ -2601,6 +2780,7 @@ void TGraph::UpdateArrays(const std::vector<Int_t> &sorting_indices, Int_t numSo
                  [begin = low, &sorting_indices, this]() mutable { return fY[sorting_indices[begin++]]; });
 
    // Copy the sorted X and Y values back to the original arrays
+   ResetEvalCache();
    std::copy(fXSorted.begin(), fXSorted.end(), fX + low);
    std::copy(fYSorted.begin(), fYSorted.end(), fY + low);
 }
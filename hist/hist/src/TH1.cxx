@@ -9,6 +9,7 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <algorithm>
 #include <array>
 #include <cctype>
 #include <climits>
@@ -54,6 +55,7 @@
 #include "Math/QuantFuncMathCore.h"
 
 #include "TH1Merger.h"
+#include "TH1BatchFill.h"
 
 /** \addtogroup Histograms
 @{
@@ -3433,6 +3435,69 @@ Int_t TH1::Fill(const char *namex, Double_t w)
    return bin;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill this histogram with a batch of values x and weights w.
+///
+/// \param[in] x values to be histogrammed
+/// \param[in] w weights; if empty, each entry has weight 1, otherwise it
+///            must have the same size as x
+///
+/// The result is the same as calling Fill(x[i], w[i]) for each entry, but
+/// for TH1F and TH1D with a non-extendable axis and no buffer the bins of a
+/// whole chunk of values are computed at once (with arithmetic for fixed
+/// bins and a branchless binary search for variable bins), the contents are
+/// updated without virtual calls and the statistics are summed once per
+/// chunk. Other histograms fall back to the entry-by-entry Fill.
+
+void TH1::Fill(std::span<const Double_t> x, std::span<const Double_t> w)
+{
+   if (!w.empty() && w.size() != x.size()) {
+      Error("Fill", "The number of weights (%zu) differs from the number of values (%zu)", w.size(), x.size());
+      return;
+   }
+   const Double_t *weights = w.empty() ? nullptr : w.data();
+
+   const bool isTH1D = IsA() == TH1D::Class();
+   if (fBuffer || fDimension != 1 || fXaxis.CanExtend() || !(isTH1D || IsA() == TH1F::Class())) {
+      for (std::size_t i = 0; i < x.size(); ++i)
+         Fill(x[i], weights ? weights[i] : 1.);
+      return;
+   }
+
+   // must be called before adding to the bin contents
+   if (!fSumw2.fN && !TestBit(TH1::kIsNotW) && TH1BatchFill::HasNonUnitWeight(weights, x.size()))
+      Sumw2();
+
+   const Bool_t statOverflows = GetStatOverflowsBehaviour();
+   Double_t *sumw2 = fSumw2.fN ? fSumw2.fArray : nullptr;
+   Int_t bins[TH1BatchFill::kChunkSize];
+   Double_t tsumw = 0, tsumw2 = 0, tsumwx = 0, tsumwx2 = 0;
+   for (std::size_t start = 0; start < x.size(); start += TH1BatchFill::kChunkSize) {
+      const std::size_t n = std::min(TH1BatchFill::kChunkSize, x.size() - start);
+      const Double_t *xs = x.data() + start;
+      const Double_t *ws = weights ? weights + start : nullptr;
+      TH1BatchFill::FindBins(fXaxis, xs, bins, n);
+      if (isTH1D)
+         TH1BatchFill::AddBinContents(static_cast<TH1D *>(this)->fArray, sumw2, bins, ws, n);
+      else
+         TH1BatchFill::AddBinContents(static_cast<TH1F *>(this)->fArray, sumw2, bins, ws, n);
+      for (std::size_t i = 0; i < n; ++i) {
+         const bool use = statOverflows || TH1BatchFill::InRange(fXaxis, bins[i]);
+         const Double_t z = use ? (ws ? ws[i] : 1.) : 0.;
+         const Double_t xi = use ? xs[i] : 0.;
+         tsumw   += z;
+         tsumw2  += z*z;
+         tsumwx  += z*xi;
+         tsumwx2 += z*xi*xi;
+      }
+   }
+   fEntries += x.size();
+   fTsumw   += tsumw;
+   fTsumw2  += tsumw2;
+   fTsumwx  += tsumwx;
+   fTsumwx2 += tsumwx2;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Fill this histogram with an array x and weights w.
 ///
@@ -0,0 +1,110 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TH1BatchFill
+#define ROOT_TH1BatchFill
+
+// Helper class implementing the batch Fill(std::span...) functions of TH1, TH2, TH3 and TProfile
+
+#include "TAxis.h"
+#include "TArrayD.h"
+
+#include <cstddef>
+
+class TH1BatchFill {
+
+public:
+   /// Number of values whose bins are computed in one go.
+   static constexpr std::size_t kChunkSize = 256;
+
+   /// Compute the bin numbers of `n` values on a non-extendable axis, as TAxis::FindBin would.
+   /// The loops are written without data-dependent branches so that the compiler can vectorize
+   /// the fixed-width case and keep the pipeline full in the variable-width case.
+   static void FindBins(const TAxis &axis, const Double_t *x, Int_t *bins, std::size_t n)
+   {
+      const Int_t nbins = axis.GetNbins();
+      const Double_t xmin = axis.GetXmin();
+      const Double_t xmax = axis.GetXmax();
+      const TArrayD *edges = axis.GetXbins();
+      if (!edges->fN) {
+         const Double_t width = xmax - xmin;
+         const Double_t invWidth = nbins / width;
+         // Multiplying by the inverse bin width can differ in the last digit from the division
+         // done by TAxis::FindFixBin, which matters only next to a bin edge. Those values are
+         // flagged here and recomputed below with the exact expression.
+         constexpr Double_t kEdgeTolerance = 1e-6;
+         Bool_t nearEdge = kFALSE;
+         for (std::size_t i = 0; i < n; ++i) {
+            const Double_t xi = x[i];
+            // Out-of-range values are moved in range before the conversion to integer,
+            // whose result is then discarded.
+            const Double_t inRange = (xi >= xmin && xi < xmax) ? xi : xmin + 0.5 / invWidth;
+            const Double_t t = (inRange - xmin) * invWidth;
+            const Int_t bin = Int_t(t);
+            nearEdge |= (t - bin <= kEdgeTolerance) | (t - bin >= 1 - kEdgeTolerance);
+            bins[i] = xi < xmin ? 0 : (xi < xmax ? 1 + bin : nbins + 1);
+         }
+         if (nearEdge) {
+            for (std::size_t i = 0; i < n; ++i) {
+               if (!(x[i] >= xmin && x[i] < xmax))
+                  continue;
+               const Double_t t = (x[i] - xmin) * invWidth;
+               if (t - Int_t(t) <= kEdgeTolerance || t - Int_t(t) >= 1 - kEdgeTolerance)
+                  bins[i] = 1 + Int_t(nbins * (x[i] - xmin) / width);
+            }
+         }
+      } else {
+         // Branchless binary search for the last edge <= x, i.e. TMath::BinarySearch.
+         const Double_t *e = edges->GetArray();
+         for (std::size_t i = 0; i < n; ++i) {
+            const Double_t xi = x[i];
+            const Double_t *base = e;
+            Int_t len = nbins + 1;
+            while (len > 1) {
+               const Int_t half = len / 2;
+               base = (base[half] <= xi) ? base + half : base;
+               len -= half;
+            }
+            const Int_t bin = 1 + Int_t(base - e);
+            bins[i] = xi < xmin ? 0 : (xi < xmax ? bin : nbins + 1);
+         }
+      }
+   }
+
+   /// Return true if a bin number on `axis` is not an underflow or overflow bin.
+   static Bool_t InRange(const TAxis &axis, Int_t bin) { return bin >= 1 && bin <= axis.GetNbins(); }
+
+   /// Return true if any of the `n` weights differs from one.
+   static Bool_t HasNonUnitWeight(const Double_t *w, std::size_t n)
+   {
+      if (!w)
+         return kFALSE;
+      for (std::size_t i = 0; i < n; ++i) {
+         if (w[i] != 1.)
+            return kTRUE;
+      }
+      return kFALSE;
+   }
+
+   /// Add the weights `w` (or one if null) to `content` and their squares to `sumw2` (if not null)
+   /// at the given global bin numbers.
+   template <typename T>
+   static void AddBinContents(T *content, Double_t *sumw2, const Int_t *bins, const Double_t *w, std::size_t n)
+   {
+      for (std::size_t i = 0; i < n; ++i) {
+         const Double_t wi = w ? w[i] : 1.;
+         content[bins[i]] += T(wi);
+         if (sumw2)
+            sumw2[bins[i]] += wi * wi;
+      }
+   }
+};
+
+#endif
@@ -8,6 +8,11 @@
 #include "TError.h"
 #include "THashList.h"
 #include "TClass.h"
+#include "TROOT.h"
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+#include <algorithm>
 #include <iostream>
 #include <limits>
 #include <utility>
@@ -26,6 +31,9 @@ Bool_t TH1Merger::AxesHaveLimits(const TH1 * h) {
 /// Function performing the actual merge
 Bool_t TH1Merger::operator() () {
 
+   // fast path for the common case, e.g. merging per-thread or per-file copies of a histogram
+   if (HaveIdenticalAxes())
+      return SameAxesMerge();
 
    EMergerType type = ExamineHistograms();
 
@@ -479,6 +487,37 @@ TH1Merger::EMergerType TH1Merger::ExamineHistograms() {
 
 }
 
+/**
+   Quick check for the most common case: all histograms are of the same class as
+   fH0, have the same binning and no labels, no buffer and no power-of-2 auto-binning.
+   They can then be merged bin by bin without the axis and label logic of
+   ExamineHistograms().
+*/
+Bool_t TH1Merger::HaveIdenticalAxes() {
+
+   if (fH0->fBuffer || fH0->TestBit(TH1::kAutoBinPTwo) || !AxesHaveLimits(fH0) || HasLabels(fH0))
+      return kFALSE;
+
+   const Int_t dimension = fH0->GetDimension();
+   Bool_t haveWeights = fH0->GetSumw2N() != 0;
+   for (TObject *obj : fInputList) {
+      const TH1 *h = dynamic_cast<const TH1 *>(obj);
+      if (!h || h->IsA() != fH0->IsA() || h->fBuffer || h->TestBit(TH1::kAutoBinPTwo) || HasLabels(h))
+         return kFALSE;
+      if (!TH1::SameLimitsAndNBins(fH0->fXaxis, h->fXaxis) ||
+          (dimension > 1 && !TH1::SameLimitsAndNBins(fH0->fYaxis, h->fYaxis)) ||
+          (dimension > 2 && !TH1::SameLimitsAndNBins(fH0->fZaxis, h->fZaxis)))
+         return kFALSE;
+      haveWeights |= h->GetSumw2N() != 0;
+   }
+
+   // as in ExamineHistograms()
+   if (haveWeights && fH0->GetSumw2N() == 0)
+      fH0->Sumw2();
+
+   return kTRUE;
+}
+
 /**
    Function to define new histogram axis when merging
    It is call only in case of merging with different axis or with the
@@ -762,6 +801,7 @@ Bool_t TH1Merger::SameAxesMerge() {
    fH0->GetStats(totstats);
    Double_t nentries = fH0->GetEntries();
 
+   std::vector<const TH1 *> inputs;
    TIter next(&fInputList);
    while (TH1* hist=(TH1*)next()) {
       // process only if the histogram has limits; otherwise it was processed before
@@ -779,12 +819,38 @@ Bool_t TH1Merger::SameAxesMerge() {
          totstats[i] += stats[i];
       nentries += hist->GetEntries();
 
-         //Int_t nx = hist->GetXaxis()->GetNbins();
-         // loop on bins of the histogram and do the merge
-      for (Int_t ibin = 0; ibin < hist->fNcells; ibin++) {
-         MergeBin(hist, ibin, ibin);
-      }
+      inputs.push_back(hist);
+   }
+
+   // loop on bins of the histograms and do the merge
+   const Int_t ncells = fH0->fNcells;
+#ifdef R__USE_IMT
+   // Each task merges all inputs into its own range of bins of fH0. This is only done
+   // for ROOT's own histogram classes, whose AddBinContent() only touches the given bin.
+   static const TClass *const parallelClasses[] = {
+      TH1C::Class(), TH1S::Class(), TH1I::Class(), TH1L::Class(), TH1F::Class(), TH1D::Class(),
+      TH2C::Class(), TH2S::Class(), TH2I::Class(), TH2L::Class(), TH2F::Class(), TH2D::Class(),
+      TH3C::Class(), TH3S::Class(), TH3I::Class(), TH3L::Class(), TH3F::Class(), TH3D::Class(),
+      TProfile::Class(), TProfile2D::Class(), TProfile3D::Class()};
+   const Bool_t knownClass = std::find(std::begin(parallelClasses), std::end(parallelClasses), fH0->IsA()) !=
+                             std::end(parallelClasses);
+   const Bool_t sameClass =
+      std::all_of(inputs.begin(), inputs.end(), [this](const TH1 *h) { return h->IsA() == fH0->IsA(); });
+   if (ROOT::IsImplicitMTEnabled() && sameClass && knownClass &&
+       (Long64_t)ncells * (Long64_t)inputs.size() >= kMinParallelMergeWork) {
+      const Int_t nchunks = std::min<Long64_t>(4 * ROOT::GetThreadPoolSize(), ncells / 4096 + 1);
+      const Int_t chunkSize = (ncells + nchunks - 1) / nchunks;
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&](Int_t ichunk) {
+         const Int_t first = ichunk * chunkSize;
+         MergeBinRange(inputs, first, std::min(ncells, first + chunkSize));
+      }, ROOT::TSeq<Int_t>(0, nchunks));
+   } else
+#endif
+   {
+      MergeBinRange(inputs, 0, ncells);
    }
+
    //copy merged stats
    fH0->PutStats(totstats);
    fH0->SetEntries(nentries);
@@ -1120,6 +1186,25 @@ Bool_t TH1Merger::LabelMerge(bool newLimits) {
    return kTRUE;
 }
 
+/// merge the bins [first, last) of all inputs into the same bins of fH0;
+/// the inputs have the same binning as fH0
+
+void TH1Merger::MergeBinRange(const std::vector<const TH1 *> &inputs, Int_t first, Int_t last)
+{
+   for (const TH1 *hist : inputs) {
+      for (Int_t ibin = first; ibin < last; ibin++) {
+         MergeBin(hist, ibin, ibin);
+      }
+   }
+}
+
+/// check if any axis of the histogram has labels
+
+Bool_t TH1Merger::HasLabels(const TH1 *hist)
+{
+   return hist->fXaxis.GetLabels() || hist->fYaxis.GetLabels() || hist->fZaxis.GetLabels();
+}
+
 /// helper function for merging
 
 Bool_t TH1Merger::IsBinEmpty(const TH1 * hist, Int_t ibin) {
@@ -17,6 +17,8 @@
 #include "TProfile3D.h"
 #include "TList.h"
 
+#include <vector>
+
 class TH1Merger {
 
 public:
@@ -59,6 +61,12 @@ public:
     // function to check if histogram bin is empty
    static Bool_t IsBinEmpty(const TH1 *hist, Int_t bin);
 
+   // check if any axis of the histogram has labels
+   static Bool_t HasLabels(const TH1 *hist);
+
+   // minimal number of bins times inputs for merging bin ranges in parallel
+   static constexpr Long64_t kMinParallelMergeWork = 1 << 20;
+
 
 
    TH1Merger(TH1 & h, TCollection & l, Option_t * opt = "") :
@@ -102,6 +110,8 @@ public:
 private:
    Bool_t AutoP2BuildAxes(TH1 *);
 
+   Bool_t HaveIdenticalAxes();
+
    EMergerType ExamineHistograms();
 
    void DefineNewAxes();
@@ -116,6 +126,8 @@ private:
 
    Bool_t SameAxesMerge();
 
+   void MergeBinRange(const std::vector<const TH1 *> &inputs, Int_t first, Int_t last);
+
    Bool_t DifferentAxesMerge();
 
    Bool_t LabelMerge(bool newLimits = false);
@@ -28,6 +28,10 @@
 #include "TVirtualHistPainter.h"
 #include "snprintf.h"
 
+#include "TH1BatchFill.h"
+
+#include <algorithm>
+
 ClassImp(TH2);
 
 /** \addtogroup Histograms
@@ -486,6 +490,78 @@ Int_t TH2::Fill(Double_t x, Double_t y, Double_t w)
    return bin;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill this histogram with a batch of values x, y and weights w.
+///
+/// \param[in] x, y values to be histogrammed, of the same size
+/// \param[in] w weights; if empty, each entry has weight 1, otherwise it
+///            must have the same size as x
+///
+/// The result is the same as calling Fill(x[i], y[i], w[i]) for each entry;
+/// see TH1::Fill(std::span<const Double_t>, std::span<const Double_t>) for
+/// the histograms filled in batch.
+
+void TH2::Fill(std::span<const Double_t> x, std::span<const Double_t> y, std::span<const Double_t> w)
+{
+   if (y.size() != x.size() || (!w.empty() && w.size() != x.size())) {
+      Error("Fill", "The numbers of values and weights differ (x: %zu, y: %zu, w: %zu)", x.size(), y.size(), w.size());
+      return;
+   }
+   const Double_t *weights = w.empty() ? nullptr : w.data();
+
+   const bool isTH2D = IsA() == TH2D::Class();
+   if (fBuffer || fXaxis.CanExtend() || fYaxis.CanExtend() || !(isTH2D || IsA() == TH2F::Class())) {
+      for (std::size_t i = 0; i < x.size(); ++i)
+         Fill(x[i], y[i], weights ? weights[i] : 1.);
+      return;
+   }
+
+   // must be called before adding to the bin contents
+   if (!fSumw2.fN && !TestBit(TH1::kIsNotW) && TH1BatchFill::HasNonUnitWeight(weights, x.size()))
+      Sumw2();
+
+   const Bool_t statOverflows = GetStatOverflowsBehaviour();
+   const Int_t nx = fXaxis.GetNbins() + 2;
+   Double_t *sumw2 = fSumw2.fN ? fSumw2.fArray : nullptr;
+   Int_t bins[TH1BatchFill::kChunkSize];
+   Int_t binsy[TH1BatchFill::kChunkSize];
+   Double_t tsumw = 0, tsumw2 = 0, tsumwx = 0, tsumwx2 = 0, tsumwy = 0, tsumwy2 = 0, tsumwxy = 0;
+   for (std::size_t start = 0; start < x.size(); start += TH1BatchFill::kChunkSize) {
+      const std::size_t n = std::min(TH1BatchFill::kChunkSize, x.size() - start);
+      const Double_t *xs = x.data() + start;
+      const Double_t *ys = y.data() + start;
+      const Double_t *ws = weights ? weights + start : nullptr;
+      TH1BatchFill::FindBins(fXaxis, xs, bins, n);
+      TH1BatchFill::FindBins(fYaxis, ys, binsy, n);
+      for (std::size_t i = 0; i < n; ++i) {
+         const bool use = statOverflows || (TH1BatchFill::InRange(fXaxis, bins[i]) && TH1BatchFill::InRange(fYaxis, binsy[i]));
+         const Double_t z = use ? (ws ? ws[i] : 1.) : 0.;
+         const Double_t xi = use ? xs[i] : 0.;
+         const Double_t yi = use ? ys[i] : 0.;
+         tsumw   += z;
+         tsumw2  += z*z;
+         tsumwx  += z*xi;
+         tsumwx2 += z*xi*xi;
+         tsumwy  += z*yi;
+         tsumwy2 += z*yi*yi;
+         tsumwxy += z*xi*yi;
+         bins[i] += nx * binsy[i];
+      }
+      if (isTH2D)
+         TH1BatchFill::AddBinContents(static_cast<TH2D *>(this)->fArray, sumw2, bins, ws, n);
+      else
+         TH1BatchFill::AddBinContents(static_cast<TH2F *>(this)->fArray, sumw2, bins, ws, n);
+   }
+   fEntries += x.size();
+   fTsumw   += tsumw;
+   fTsumw2  += tsumw2;
+   fTsumwx  += tsumwx;
+   fTsumwx2 += tsumwx2;
+   fTsumwy  += tsumwy;
+   fTsumwy2 += tsumwy2;
+   fTsumwxy += tsumwxy;
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Increment cell defined by namex,namey by a weight w
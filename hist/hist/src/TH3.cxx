@@ -25,6 +25,10 @@
 #include "TMath.h"
 #include "TObjString.h"
 
+#include "TH1BatchFill.h"
+
+#include <algorithm>
+
 ClassImp(TH3);
 
 /** \addtogroup Histograms
@@ -466,6 +470,97 @@ Int_t TH3::Fill(Double_t x, Double_t y, Double_t z, Double_t w)
    return bin;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill this histogram with a batch of values x, y, z and weights w.
+///
+/// \param[in] x, y, z values to be histogrammed, of the same size
+/// \param[in] w weights; if empty, each entry has weight 1, otherwise it
+///            must have the same size as x
+///
+/// The result is the same as calling Fill(x[i], y[i], z[i], w[i]) for each
+/// entry; see TH1::Fill(std::span<const Double_t>, std::span<const Double_t>)
+/// for the histograms filled in batch.
+
+void TH3::Fill(std::span<const Double_t> x, std::span<const Double_t> y, std::span<const Double_t> z,
+               std::span<const Double_t> w)
+{
+   if (y.size() != x.size() || z.size() != x.size() || (!w.empty() && w.size() != x.size())) {
+      Error("Fill", "The numbers of values and weights differ (x: %zu, y: %zu, z: %zu, w: %zu)", x.size(), y.size(),
+            z.size(), w.size());
+      return;
+   }
+   const Double_t *weights = w.empty() ? nullptr : w.data();
+
+   const bool isTH3D = IsA() == TH3D::Class();
+   if (fBuffer || fXaxis.CanExtend() || fYaxis.CanExtend() || fZaxis.CanExtend() ||
+       !(isTH3D || IsA() == TH3F::Class())) {
+      for (std::size_t i = 0; i < x.size(); ++i)
+         Fill(x[i], y[i], z[i], weights ? weights[i] : 1.);
+      return;
+   }
+
+   // must be called before adding to the bin contents
+   if (!fSumw2.fN && !TestBit(TH1::kIsNotW) && TH1BatchFill::HasNonUnitWeight(weights, x.size()))
+      Sumw2();
+
+   const Bool_t statOverflows = GetStatOverflowsBehaviour();
+   const Int_t nx = fXaxis.GetNbins() + 2;
+   const Int_t nxy = nx * (fYaxis.GetNbins() + 2);
+   Double_t *sumw2 = fSumw2.fN ? fSumw2.fArray : nullptr;
+   Int_t bins[TH1BatchFill::kChunkSize];
+   Int_t binsy[TH1BatchFill::kChunkSize];
+   Int_t binsz[TH1BatchFill::kChunkSize];
+   Double_t tsumw = 0, tsumw2 = 0, tsumwx = 0, tsumwx2 = 0, tsumwy = 0, tsumwy2 = 0, tsumwxy = 0;
+   Double_t tsumwz = 0, tsumwz2 = 0, tsumwxz = 0, tsumwyz = 0;
+   for (std::size_t start = 0; start < x.size(); start += TH1BatchFill::kChunkSize) {
+      const std::size_t n = std::min(TH1BatchFill::kChunkSize, x.size() - start);
+      const Double_t *xs = x.data() + start;
+      const Double_t *ys = y.data() + start;
+      const Double_t *zs = z.data() + start;
+      const Double_t *ws = weights ? weights + start : nullptr;
+      TH1BatchFill::FindBins(fXaxis, xs, bins, n);
+      TH1BatchFill::FindBins(fYaxis, ys, binsy, n);
+      TH1BatchFill::FindBins(fZaxis, zs, binsz, n);
+      for (std::size_t i = 0; i < n; ++i) {
+         const bool use = statOverflows || (TH1BatchFill::InRange(fXaxis, bins[i]) &&
+                                            TH1BatchFill::InRange(fYaxis, binsy[i]) &&
+                                            TH1BatchFill::InRange(fZaxis, binsz[i]));
+         const Double_t wi = use ? (ws ? ws[i] : 1.) : 0.;
+         const Double_t xi = use ? xs[i] : 0.;
+         const Double_t yi = use ? ys[i] : 0.;
+         const Double_t zi = use ? zs[i] : 0.;
+         tsumw   += wi;
+         tsumw2  += wi*wi;
+         tsumwx  += wi*xi;
+         tsumwx2 += wi*xi*xi;
+         tsumwy  += wi*yi;
+         tsumwy2 += wi*yi*yi;
+         tsumwxy += wi*xi*yi;
+         tsumwz  += wi*zi;
+         tsumwz2 += wi*zi*zi;
+         tsumwxz += wi*xi*zi;
+         tsumwyz += wi*yi*zi;
+         bins[i] += nx * binsy[i] + nxy * binsz[i];
+      }
+      if (isTH3D)
+         TH1BatchFill::AddBinContents(static_cast<TH3D *>(this)->fArray, sumw2, bins, ws, n);
+      else
+         TH1BatchFill::AddBinContents(static_cast<TH3F *>(this)->fArray, sumw2, bins, ws, n);
+   }
+   fEntries += x.size();
+   fTsumw   += tsumw;
+   fTsumw2  += tsumw2;
+   fTsumwx  += tsumwx;
+   fTsumwx2 += tsumwx2;
+   fTsumwy  += tsumwy;
+   fTsumwy2 += tsumwy2;
+   fTsumwxy += tsumwxy;
+   fTsumwz  += tsumwz;
+   fTsumwz2 += tsumwz2;
+   fTsumwxz += tsumwxz;
+   fTsumwyz += tsumwyz;
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Increment cell defined by namex,namey,namez by a weight w
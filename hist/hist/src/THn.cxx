@@ -11,6 +11,13 @@
 
 #include "THn.h"
 
+#include "TROOT.h"
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
+#include <algorithm>
+
 namespace {
    //______________________________________________________________________________
    //
@@ -234,6 +241,30 @@ void THn::AllocCoordBuf() const
    fCoordBuf.assign(fNdimensions, 0);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Call func(first, last) for consecutive ranges of bins covering [0, nbins).
+/// With implicit multi-threading enabled, large numbers of bins are split
+/// into ranges that are processed in parallel; func must then only access
+/// the bins of the range it is called for.
+
+void THn::ForEachBinRange(Long64_t nbins, const std::function<void(Long64_t, Long64_t)> &func)
+{
+#ifdef R__USE_IMT
+   constexpr Long64_t kMinBinsPerTask = 1 << 16;
+   if (ROOT::IsImplicitMTEnabled() && nbins >= 2 * kMinBinsPerTask) {
+      const Long64_t ntasks = std::min<Long64_t>(4 * ROOT::GetThreadPoolSize(), nbins / kMinBinsPerTask);
+      const Long64_t binsPerTask = (nbins + ntasks - 1) / ntasks;
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&](Long64_t itask) {
+         const Long64_t first = itask * binsPerTask;
+         func(first, std::min(nbins, first + binsPerTask));
+      }, ROOT::TSeq<Long64_t>(0, ntasks));
+      return;
+   }
+#endif
+   func(0, nbins);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Initialize the storage of a histogram created via Init()
 
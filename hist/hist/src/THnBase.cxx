@@ -807,44 +807,46 @@ void THnBase::AddInternal(const THnBase* h, Double_t c, Bool_t rebinned)
       Sumw2();
    Bool_t haveErrors = GetCalculateErrors();
 
-   Double_t* x = nullptr;
-   if (rebinned) {
-      x = new Double_t[fNdimensions];
-   }
-   Int_t* coord = new Int_t[fNdimensions];
-
-   // Expand the exmap if needed, to reduce collisions
+   // Expand the bin lookup if needed, to reduce collisions
    Long64_t numTargetBins = GetNbins() + h->GetNbins();
    Reserve(numTargetBins);
 
-   Long64_t i = 0;
-   std::unique_ptr<ROOT::Internal::THnBaseBinIter> iter{h->CreateIter(false)};
-   // Add to this whatever is found inside the other histogram
-   while ((i = iter->Next(coord)) >= 0) {
-      // Get the content of the bin from the second histogram
-      Double_t v = h->GetBinContent(i);
-
-      Long64_t mybinidx = -1;
+   if (rebinned || !AddBinsDirect(h, c)) {
+      Double_t* x = nullptr;
       if (rebinned) {
-         // Get the bin center given a coord
-         for (Int_t j = 0; j < fNdimensions; ++j)
-            x[j] = h->GetAxis(j)->GetBinCenter(coord[j]);
-
-         mybinidx = GetBin(x, kTRUE /* allocate*/);
-      } else {
-         mybinidx = GetBin(coord, kTRUE /*allocate*/);
+         x = new Double_t[fNdimensions];
       }
+      Int_t* coord = new Int_t[fNdimensions];
+
+      Long64_t i = 0;
+      std::unique_ptr<ROOT::Internal::THnBaseBinIter> iter{h->CreateIter(false)};
+      // Add to this whatever is found inside the other histogram
+      while ((i = iter->Next(coord)) >= 0) {
+         // Get the content of the bin from the second histogram
+         Double_t v = h->GetBinContent(i);
+
+         Long64_t mybinidx = -1;
+         if (rebinned) {
+            // Get the bin center given a coord
+            for (Int_t j = 0; j < fNdimensions; ++j)
+               x[j] = h->GetAxis(j)->GetBinCenter(coord[j]);
+
+            mybinidx = GetBin(x, kTRUE /* allocate*/);
+         } else {
+            mybinidx = GetBin(coord, kTRUE /*allocate*/);
+         }
 
-      if (haveErrors) {
-         Double_t err2 = h->GetBinError2(i) * c * c;
-         AddBinError2(mybinidx, err2);
+         if (haveErrors) {
+            Double_t err2 = h->GetBinError2(i) * c * c;
+            AddBinError2(mybinidx, err2);
+         }
+         // only _after_ error calculation, or sqrt(v) is taken into account!
+         AddBinContent(mybinidx, c * v);
       }
-      // only _after_ error calculation, or sqrt(v) is taken into account!
-      AddBinContent(mybinidx, c * v);
-   }
 
-   delete [] coord;
-   delete [] x;
+      delete [] coord;
+      delete [] x;
+   }
 
    // add also the statistics
    fTsumw += c * h->fTsumw;
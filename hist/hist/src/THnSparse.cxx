@@ -16,6 +16,10 @@
 #include "TDataMember.h"
 #include "TDataType.h"
 
+#include "TH1BatchFill.h"
+
+#include <algorithm>
+
 namespace {
 //______________________________________________________________________________
 //
@@ -270,9 +274,9 @@ ULong64_t THnSparseCoordCompression::GetHashFromCoords(const Int_t* coord) const
 {
    // Bins are addressed in two different modes, depending
    // on whether the compact bin index fits into a Long64_t or not.
-   // If it does, we can use it as a "perfect hash" for the TExMap.
+   // If it does, we can use it as a "perfect hash" for the bin table.
    // If not we build a hash from the compact bin index, and use that
-   // as the TExMap's hash.
+   // as the bin table's hash.
 
    if (fCoordBufferSize <= 8) {
       // fits into a Long64_t
@@ -318,9 +322,9 @@ ULong64_t THnSparseCoordCompression::GetHashFromBuffer(const Char_t* buf) const
 {
    // Bins are addressed in two different modes, depending
    // on whether the compact bin index fits into a Long64_t or not.
-   // If it does, we can use it as a "perfect hash" for the TExMap.
+   // If it does, we can use it as a "perfect hash" for the bin table.
    // If not we build a hash from the compact bin index, and use that
-   // as the TExMap's hash.
+   // as the bin table's hash.
 
    if (fCoordBufferSize <= 8) {
       // fits into a Long64_t
@@ -570,14 +574,23 @@ Translation from an n-dimensional bin coordinate to the linear index within
 the chunks is done by GetBin(). It creates a hash from the compacted bin
 coordinates (the hash of a bin coordinate is the compacted coordinate itself
 if it takes less than 8 bytes, the size of a Long64_t.
-This hash is used to lookup the linear index in the TExMap member fBins;
-the coordinates of the entry fBins points to is compared to the coordinates
-passed to GetBin(). If they do not match, these two coordinates have the same
-hash - which is extremely unlikely but (for the case where the compact bin
-coordinates are larger than 4 bytes) possible. In this case, fBinsContinued
-contains a chain of linear indexes with the same hash. Iterating through this
-chain and comparing each bin coordinates with the one passed to GetBin() will
-retrieve the matching bin.
+This hash is used to lookup the linear index in the open-addressing hash
+table fBinTable, which stores pairs of (hash, linear index + 1) contiguously
+and resolves collisions by linear probing. The table is kept at most half
+full, so a lookup typically touches a single cache line. For each slot with
+a matching hash, the coordinates of the bin it points to are compared to the
+coordinates passed to GetBin(); they can only differ if two coordinates have
+the same hash, which is extremely unlikely but (for the case where the compact
+bin coordinates are larger than 8 bytes) possible. In that case probing simply
+continues with the next slot.
+
+The table is transient; it is rebuilt from the chunks' coordinates when a
+THnSparse read from a file is first accessed.
+
+Many entries can be filled in one go with FillN(), which computes the bins
+of a block of entries per axis before looking them up. Adding or merging
+THnSparse objects with the same binning copies the compact coordinates
+directly, without decoding them.
 */
 
 
@@ -649,36 +662,72 @@ void THnSparse::InitStorage(Int_t* nbins, Int_t chunkSize)
    fCompactCoord = new THnSparseCompactBinCoord(fNdimensions, nbins);
 }
 
+namespace {
+   /// Return the first slot to probe for "hash" in a bin table with "mask" + 1 slots.
+   /// The hash of short compact coordinates is the coordinate itself, whose high bits
+   /// are mostly zero; mix all bits into the low ones used for the slot.
+   inline ULong64_t GetBinTableSlot(ULong64_t hash, ULong64_t mask) {
+      hash ^= hash >> 33;
+      hash *= 0xff51afd7ed558ccdULL;
+      hash ^= hash >> 33;
+      return hash & mask;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Insert the linear bin index "idx" with hash "hash" into fBinTable,
+/// which must have a free slot and must not contain "idx" yet.
+
+void THnSparse::InsertBinIndex(ULong64_t hash, Long64_t idx)
+{
+   const ULong64_t mask = fBinTable.size() / 2 - 1;
+   ULong64_t slot = GetBinTableSlot(hash, mask);
+   while (fBinTable[2 * slot + 1])
+      slot = (slot + 1) & mask;
+   fBinTable[2 * slot] = hash;
+   fBinTable[2 * slot + 1] = idx + 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Make sure fBinTable can hold "nbins" bins while staying at most half full;
+/// the number of slots is a power of two. Existing entries are re-inserted
+/// using their stored hash.
+
+void THnSparse::ResizeBinTable(Long64_t nbins)
+{
+   ULong64_t nslots = 16;
+   while (nslots < 2 * (ULong64_t)nbins)
+      nslots *= 2;
+   if (2 * nslots <= fBinTable.size())
+      return;
+
+   std::vector<ULong64_t> old(2 * nslots, 0);
+   fBinTable.swap(old);
+   for (size_t i = 0; i < old.size(); i += 2) {
+      if (old[i + 1])
+         InsertBinIndex(old[i], old[i + 1] - 1);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
-///We have been streamed; set up fBins
+/// We have been streamed; set up fBinTable from the bins' compact coordinates
 
-void THnSparse::FillExMap()
+void THnSparse::FillBinTable()
 {
    TIter iChunk(&fBinContent);
    THnSparseArrayChunk* chunk = nullptr;
    THnSparseCoordCompression compactCoord(*GetCompactCoord());
    Long64_t idx = 0;
-   if (2 * GetNbins() > fBins.Capacity())
-      fBins.Expand(3 * GetNbins());
+   ResizeBinTable(GetNbins());
    while ((chunk = (THnSparseArrayChunk*) iChunk())) {
       const Int_t chunkSize = chunk->GetEntries();
       Char_t* buf = chunk->fCoordinates;
       const Int_t singleCoordSize = chunk->fSingleCoordinateSize;
       const Char_t* endbuf = buf + singleCoordSize * chunkSize;
       for (; buf < endbuf; buf += singleCoordSize, ++idx) {
-         Long64_t hash = compactCoord.GetHashFromBuffer(buf);
-         Long64_t linidx = fBins.GetValue(hash);
-         if (linidx) {
-            Long64_t nextidx = linidx;
-            while (nextidx) {
-               // must be a collision, so go to fBinsContinued.
-               linidx = nextidx;
-               nextidx = fBinsContinued.GetValue(linidx);
-            }
-            fBinsContinued.Add(linidx, idx + 1);
-         } else {
-            fBins.Add(hash, idx + 1);
-         }
+         if (2 * (ULong64_t)(idx + 1) > fBinTable.size() / 2)
+            ResizeBinTable(idx + 1);
+         InsertBinIndex(compactCoord.GetHashFromBuffer(buf), idx);
       }
    }
 }
@@ -687,12 +736,9 @@ void THnSparse::FillExMap()
 /// Initialize storage for nbins
 
 void THnSparse::Reserve(Long64_t nbins) {
-   if (!fBins.GetSize() && fBinContent.GetSize()) {
-      FillExMap();
-   }
-   if (2 * nbins > fBins.Capacity()) {
-      fBins.Expand(3 * nbins);
-   }
+   if (fBinTable.empty())
+      FillBinTable();
+   ResizeBinTable(nbins);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -736,6 +782,89 @@ Long64_t THnSparse::GetBin(const Int_t* coord, Bool_t allocate /*= kTRUE*/)
    return GetBinIndexForCurrentBin(allocate);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill "n" entries with coordinates "x" and weights "w" (all 1 if null).
+/// "x" holds GetNdimensions() values per entry, entry after entry. This is
+/// equivalent to calling Fill(x + i * GetNdimensions(), w[i]) for each entry,
+/// but computes the bins of a block of entries one axis at a time.
+
+void THnSparse::FillN(Long64_t n, const Double_t* x, const Double_t* w /*= nullptr*/)
+{
+   constexpr Long64_t kBlock = TH1BatchFill::kChunkSize;
+   std::vector<Double_t> xaxis(kBlock);
+   std::vector<Int_t> bins(kBlock * fNdimensions);
+   THnSparseCompactBinCoord* cc = GetCompactCoord();
+   Int_t* coord = cc->GetCoord();
+
+   for (Long64_t first = 0; first < n; first += kBlock) {
+      const Long64_t len = std::min(kBlock, n - first);
+      const Double_t* xblock = x + first * fNdimensions;
+      for (Int_t d = 0; d < fNdimensions; ++d) {
+         TAxis* axis = GetAxis(d);
+         Int_t* axisbins = bins.data() + d * kBlock;
+         if (axis->CanExtend()) {
+            for (Long64_t i = 0; i < len; ++i)
+               axisbins[i] = axis->FindBin(xblock[i * fNdimensions + d]);
+         } else {
+            for (Long64_t i = 0; i < len; ++i)
+               xaxis[i] = xblock[i * fNdimensions + d];
+            TH1BatchFill::FindBins(*axis, xaxis.data(), axisbins, len);
+         }
+      }
+
+      for (Long64_t i = 0; i < len; ++i) {
+         const Double_t wi = w ? w[first + i] : 1.;
+         UpdateXStat(xblock + i * fNdimensions, wi);
+         for (Int_t d = 0; d < fNdimensions; ++d)
+            coord[d] = bins[d * kBlock + i];
+         cc->UpdateCoord();
+         FillBin(GetBinIndexForCurrentBin(kTRUE), wi);
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add "c" times the bins of "h" if it is a THnSparse with the same number of
+/// bins on each axis: the compact coordinates of its bins are then valid for
+/// this histogram, and can be looked up without decoding them.
+/// Return kFALSE (without changing anything) otherwise.
+
+Bool_t THnSparse::AddBinsDirect(const THnBase* hbase, Double_t c)
+{
+   const THnSparse* h = dynamic_cast<const THnSparse*>(hbase);
+   if (!h || h->GetNdimensions() != fNdimensions)
+      return kFALSE;
+   for (Int_t d = 0; d < fNdimensions; ++d)
+      if (h->GetAxis(d)->GetNbins() != GetAxis(d)->GetNbins())
+         return kFALSE;
+   THnSparseCompactBinCoord* cc = GetCompactCoord();
+   if (h->GetCompactCoord()->GetBufferSize() != cc->GetBufferSize())
+      return kFALSE;
+
+   const Bool_t haveErrors = GetCalculateErrors();
+   const Bool_t otherErrors = h->GetCalculateErrors();
+   const Int_t nchunks = h->GetNChunks();
+   for (Int_t ichunk = 0; ichunk < nchunks; ++ichunk) {
+      const THnSparseArrayChunk* chunk = h->GetChunk(ichunk);
+      const Int_t nentries = chunk->GetEntries();
+      const Int_t singleCoordSize = chunk->fSingleCoordinateSize;
+      for (Int_t i = 0; i < nentries; ++i) {
+         cc->SetBuffer(chunk->fCoordinates + i * singleCoordSize);
+         const Long64_t bin = GetBinIndexForCurrentBin(kTRUE);
+         THnSparseArrayChunk* target = GetChunk(bin / fChunkSize);
+         const Int_t idx = bin % fChunkSize;
+         const Double_t v = chunk->fContent->GetAt(i);
+         if (haveErrors) {
+            // as THnSparse::GetBinError2(): the content if h has no errors
+            const Double_t err2 = otherErrors && chunk->fSumw2 ? chunk->fSumw2->GetAt(i) : v;
+            target->fSumw2->fArray[idx] += err2 * c * c;
+         }
+         target->fContent->SetAt(target->fContent->GetAt(idx) + c * v, idx);
+      }
+   }
+   return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return the content of the filled bin number "idx".
 /// If coord is non-null, it will contain the bin's coordinates for each axis
@@ -790,19 +919,18 @@ Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
 {
    THnSparseCompactBinCoord* cc = GetCompactCoord();
    ULong64_t hash = cc->GetHash();
-   if (fBinContent.GetSize() && !fBins.GetSize())
-      FillExMap();
-   Long64_t linidx = (Long64_t) fBins.GetValue(hash);
-   while (linidx) {
-      // fBins stores index + 1!
-      THnSparseArrayChunk* chunk = GetChunk((linidx - 1)/ fChunkSize);
-      if (chunk->Matches((linidx - 1) % fChunkSize, cc->GetBuffer()))
-         return linidx - 1; // we store idx+1, 0 is "TExMap: not found"
-
-      Long64_t nextlinidx = fBinsContinued.GetValue(linidx);
-      if (!nextlinidx) break;
-
-      linidx = nextlinidx;
+   if (fBinTable.empty())
+      FillBinTable();
+   const ULong64_t mask = fBinTable.size() / 2 - 1;
+   ULong64_t slot = GetBinTableSlot(hash, mask);
+   while (Long64_t linidx = (Long64_t) fBinTable[2 * slot + 1]) {
+      // fBinTable stores index + 1, 0 is "empty slot"!
+      if (fBinTable[2 * slot] == hash) {
+         THnSparseArrayChunk* chunk = GetChunk((linidx - 1)/ fChunkSize);
+         if (chunk->Matches((linidx - 1) % fChunkSize, cc->GetBuffer()))
+            return linidx - 1;
+      }
+      slot = (slot + 1) & mask;
    }
    if (!allocate) return -1;
 
@@ -819,15 +947,14 @@ Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
 
    // store translation between hash and bin
    newidx += (fBinContent.GetEntriesFast() - 1) * fChunkSize;
-   if (!linidx) {
-      // fBins didn't find it
-      if (2 * GetNbins() > fBins.Capacity())
-         fBins.Expand(3 * GetNbins());
-      fBins.Add(hash, newidx + 1);
+   if (2 * (ULong64_t)GetNbins() > fBinTable.size() / 2) {
+      // more than half full: grow, and find a new slot
+      ResizeBinTable(2 * GetNbins());
+      InsertBinIndex(hash, newidx);
    } else {
-      // fBins contains one, but it's the wrong one;
-      // add entry to fBinsContinued.
-      fBinsContinued.Add(linidx, newidx + 1);
+      // the probing above stopped at the first free slot
+      fBinTable[2 * slot] = hash;
+      fBinTable[2 * slot + 1] = newidx + 1;
    }
    return newidx;
 }
@@ -880,7 +1007,7 @@ Double_t THnSparse::GetSparseFractionMem() const {
 
    Double_t size = 0.;
    size += fBinContent.GetEntries() * (GetChunkSize() * sizePerChunkElement + sizeof(THnSparseArrayChunk));
-   size += + 3 * sizeof(Long64_t) * fBins.GetSize() /* TExMap */;
+   size += sizeof(ULong64_t) * fBinTable.size() /* bin table */;
 
    Double_t nbinsTotal = 1.;
    for (Int_t d = 0; d < fNdimensions; ++d)
@@ -962,8 +1089,7 @@ void THnSparse::Sumw2()
 void THnSparse::Reset(Option_t *option /*= ""*/)
 {
    fFilledBins = 0;
-   fBins.Delete();
-   fBinsContinued.Clear();
+   std::vector<ULong64_t>().swap(fBinTable);
    fBinContent.Delete();
    ResetBase(option);
 }
@@ -20,6 +20,9 @@
 #include "TObjString.h"
 
 #include "TProfileHelper.h"
+#include "TH1BatchFill.h"
+
+#include <algorithm>
 
 Bool_t TProfile::fgApproximate = kFALSE;
 
@@ -736,6 +739,76 @@ Int_t TProfile::Fill(Double_t x, Double_t y, Double_t w)
    return bin;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill a Profile histogram with a batch of values x, y and weights w.
+///
+/// \param[in] x, y values to be profiled, of the same size
+/// \param[in] w weights; if empty, each entry has weight 1, otherwise it
+///            must have the same size as x
+///
+/// The result is the same as calling Fill(x[i], y[i], w[i]) for each entry,
+/// but for a TProfile with a non-extendable axis and no buffer the bins of a
+/// whole chunk of values are computed at once and the statistics are summed
+/// once per chunk; see TH1::Fill(std::span<const Double_t>, std::span<const Double_t>).
+
+void TProfile::Fill(std::span<const Double_t> x, std::span<const Double_t> y, std::span<const Double_t> w)
+{
+   if (y.size() != x.size() || (!w.empty() && w.size() != x.size())) {
+      Error("Fill", "The numbers of values and weights differ (x: %zu, y: %zu, w: %zu)", x.size(), y.size(), w.size());
+      return;
+   }
+   const Double_t *weights = w.empty() ? nullptr : w.data();
+
+   if (fBuffer || fXaxis.CanExtend() || IsA() != TProfile::Class()) {
+      for (std::size_t i = 0; i < x.size(); ++i)
+         Fill(x[i], y[i], weights ? weights[i] : 1.);
+      return;
+   }
+
+   // must be called before accumulating the entries
+   if (!fBinSumw2.fN && !TestBit(TH1::kIsNotW) && TH1BatchFill::HasNonUnitWeight(weights, x.size()))
+      Sumw2();
+
+   const Bool_t statOverflows = GetStatOverflowsBehaviour();
+   const bool checkY = fYmin != fYmax;
+   Int_t bins[TH1BatchFill::kChunkSize];
+   Double_t entries = 0, tsumw = 0, tsumw2 = 0, tsumwx = 0, tsumwx2 = 0, tsumwy = 0, tsumwy2 = 0;
+   for (std::size_t start = 0; start < x.size(); start += TH1BatchFill::kChunkSize) {
+      const std::size_t n = std::min(TH1BatchFill::kChunkSize, x.size() - start);
+      const Double_t *xs = x.data() + start;
+      const Double_t *ys = y.data() + start;
+      const Double_t *ws = weights ? weights + start : nullptr;
+      TH1BatchFill::FindBins(fXaxis, xs, bins, n);
+      for (std::size_t i = 0; i < n; ++i) {
+         const Double_t yi = ys[i];
+         if (checkY && (yi < fYmin || yi > fYmax || TMath::IsNaN(yi)))
+            continue;
+         const Double_t u = ws ? ws[i] : 1.;
+         const Int_t bin = bins[i];
+         entries += 1;
+         fArray[bin] += u*yi;
+         fSumw2.fArray[bin] += u*yi*yi;
+         if (fBinSumw2.fN) fBinSumw2.fArray[bin] += u*u;
+         fBinEntries.fArray[bin] += u;
+         if (!statOverflows && !TH1BatchFill::InRange(fXaxis, bin))
+            continue;
+         tsumw   += u;
+         tsumw2  += u*u;
+         tsumwx  += u*xs[i];
+         tsumwx2 += u*xs[i]*xs[i];
+         tsumwy  += u*yi;
+         tsumwy2 += u*yi*yi;
+      }
+   }
+   fEntries += entries;
+   fTsumw   += tsumw;
+   fTsumw2  += tsumw2;
+   fTsumwx  += tsumwx;
+   fTsumwx2 += tsumwx2;
+   fTsumwy  += tsumwy;
+   fTsumwy2 += tsumwy2;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Fill a Profile histogram with weights.
 
@@ -1,8 +1,14 @@
 #include "gtest/gtest.h"
 
 #include "THn.h"
+#include "THnSparse.h"
 #include "TH1.h"
 #include "TH2.h"
+#include "TList.h"
+#include "TRandom3.h"
+#include "TROOT.h"
+
+#include <vector>
 
 // Filling THn
 TEST(THn, Fill) {
@@ -144,3 +150,122 @@ TEST(THn, GetBinCenter)
    EXPECT_DOUBLE_EQ(centers.at(0), 2.5);
    EXPECT_DOUBLE_EQ(centers.at(1), -1.5);
 }
+
+// FillN, Add and Merge of THnSparse; 10 axes with 100 bins need compact
+// coordinates larger than 8 bytes, i.e. real hashing in the bin lookup.
+TEST(THnSparse, FillNAddMerge)
+{
+   constexpr Int_t kDim = 10;
+   Int_t bins[kDim];
+   Double_t xmin[kDim];
+   Double_t xmax[kDim];
+   for (Int_t d = 0; d < kDim; ++d) {
+      bins[d] = 100;
+      xmin[d] = -3.;
+      xmax[d] = 3.;
+   }
+   THnSparseD hfill("hfill", "hfill", kDim, bins, xmin, xmax, 1024);
+   THnSparseD hfilln("hfilln", "hfilln", kDim, bins, xmin, xmax, 1024);
+   THnSparseF hfloat("hfloat", "hfloat", kDim, bins, xmin, xmax, 1024);
+   hfill.Sumw2();
+   hfilln.Sumw2();
+
+   constexpr Long64_t kEntries = 3000;
+   TRandom3 rng(42);
+   std::vector<Double_t> x(kEntries * kDim);
+   std::vector<Double_t> w(kEntries);
+   for (Long64_t i = 0; i < kEntries; ++i) {
+      // few distinct values on the first axes, so that some bins get several entries
+      for (Int_t d = 0; d < kDim; ++d)
+         x[i * kDim + d] = d < 7 ? rng.Integer(3) - 1. : rng.Gaus(0., 2.);
+      w[i] = rng.Uniform(0.5, 2.);
+      hfill.Fill(&x[i * kDim], w[i]);
+   }
+   hfilln.FillN(kEntries, x.data(), w.data());
+   hfloat.FillN(kEntries, x.data());
+
+   ASSERT_EQ(hfill.GetNbins(), hfilln.GetNbins());
+   EXPECT_LT(hfill.GetNbins(), kEntries);
+   EXPECT_DOUBLE_EQ(hfill.GetEntries(), hfilln.GetEntries());
+   EXPECT_DOUBLE_EQ(hfill.GetSumw(), hfilln.GetSumw());
+   EXPECT_DOUBLE_EQ(hfill.GetSumw2(), hfilln.GetSumw2());
+   EXPECT_DOUBLE_EQ(kEntries, hfloat.GetSumw());
+
+   Int_t coord[kDim];
+   for (Long64_t i = 0; i < hfill.GetNbins(); ++i) {
+      const Double_t v = hfill.GetBinContent(i, coord);
+      const Long64_t binn = hfilln.GetBin(coord, kFALSE);
+      ASSERT_GE(binn, 0);
+      EXPECT_DOUBLE_EQ(v, hfilln.GetBinContent(binn));
+      EXPECT_DOUBLE_EQ(hfill.GetBinError2(i), hfilln.GetBinError2(binn));
+      EXPECT_GE(hfloat.GetBin(coord, kFALSE), 0);
+   }
+   coord[0] = 50;
+   coord[1] = 50;
+   EXPECT_EQ(-1, hfill.GetBin(coord, kFALSE));
+
+   // Adding a THnSparse with the same binning, and merging with a
+   // differently typed one.
+   THnSparseD hsum("hsum", "hsum", kDim, bins, xmin, xmax, 1024);
+   hsum.Add(&hfill);
+   hsum.Add(&hfilln, 2.);
+   TList list;
+   list.Add(&hfloat);
+   hsum.Merge(&list);
+   list.Clear("nodelete");
+
+   EXPECT_EQ(hfill.GetNbins(), hsum.GetNbins());
+   EXPECT_DOUBLE_EQ(3 * kEntries + kEntries, hsum.GetEntries());
+   for (Long64_t i = 0; i < hfill.GetNbins(); ++i) {
+      const Double_t v = hfill.GetBinContent(i, coord);
+      const Long64_t bin = hsum.GetBin(coord, kFALSE);
+      ASSERT_GE(bin, 0);
+      const Double_t vfloat = hfloat.GetBinContent(hfloat.GetBin(coord, kFALSE));
+      EXPECT_NEAR(3 * v + vfloat, hsum.GetBinContent(bin), 1e-9 * (3 * v + vfloat));
+      EXPECT_NEAR(5 * hfill.GetBinError2(i) + vfloat, hsum.GetBinError2(bin), 1e-9 * (5 * v * v + vfloat));
+   }
+}
+
+// Merge of THn with the same binning, large enough to add bin ranges in parallel
+TEST(THn, Merge)
+{
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT(4);
+#endif
+   Int_t bins[3] = {50, 50, 50};
+   Double_t xmin[3] = {-3., -3., -3.};
+   Double_t xmax[3] = {3., 3., 3.};
+   THnD merged("merged", "merged", 3, bins, xmin, xmax);
+   THnD h1("h1", "h1", 3, bins, xmin, xmax);
+   THnD h2("h2", "h2", 3, bins, xmin, xmax);
+   THnF hf("hf", "hf", 3, bins, xmin, xmax);
+   h2.Sumw2();
+
+   TRandom3 rng(3);
+   Double_t x[3];
+   for (int i = 0; i < 20000; ++i) {
+      for (auto &xi : x)
+         xi = rng.Gaus(0., 1.5);
+      h1.Fill(x);
+      h2.Fill(x, 0.5);
+      hf.Fill(x);
+   }
+
+   TList list;
+   list.Add(&h1);
+   list.Add(&h2);
+   list.Add(&hf);
+   merged.Merge(&list);
+   list.Clear("nodelete");
+
+   EXPECT_DOUBLE_EQ(60000., merged.GetEntries());
+   EXPECT_TRUE(merged.GetCalculateErrors());
+   for (Long64_t bin = 0; bin < merged.GetNbins(); ++bin) {
+      const Double_t v1 = h1.GetBinContent(bin);
+      ASSERT_DOUBLE_EQ(2.5 * v1, merged.GetBinContent(bin));
+      ASSERT_DOUBLE_EQ(v1 + 0.25 * v1 + v1, merged.GetBinError2(bin));
+   }
+#ifdef R__USE_IMT
+   ROOT::DisableImplicitMT();
+#endif
+}
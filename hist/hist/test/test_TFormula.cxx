@@ -1,9 +1,79 @@
 #include "gtest/gtest.h"
 
+#include "TF1.h"
+#include "TF2.h"
 #include "TFormula.h"
 
+#include <vector>
+
 // Test that autoloading works (ROOT-9840)
 TEST(TFormula, Interp)
 {
   TFormula f("func", "TGeoBBox::DeclFileLine()");
 }
+
+// Batch evaluation over arrays of points gives the same results as point-by-point evaluation
+TEST(TFormula, EvalParBatch)
+{
+   TFormula f("batchFormula", "[0]*x*x + [1]*sin(y) + TMath::Exp(-[2]*x)");
+   f.SetParameters(1.5, -2., 0.3);
+
+   constexpr int n = 1000;
+   std::vector<double> xs(n), ys(n), result(n);
+   for (int i = 0; i < n; ++i) {
+      xs[i] = -5. + 0.01 * i;
+      ys[i] = 0.003 * i;
+   }
+   const double *columns[2] = {xs.data(), ys.data()};
+
+   f.EvalParBatch(n, columns, result.data());
+   for (int i = 0; i < n; ++i) {
+      const double point[2] = {xs[i], ys[i]};
+      EXPECT_DOUBLE_EQ(f.EvalPar(point), result[i]);
+   }
+
+   // explicit parameters
+   const double params[3] = {0.5, 1., 0.};
+   f.EvalParBatch(n, columns, result.data(), params);
+   for (int i = 0; i < n; ++i) {
+      const double point[2] = {xs[i], ys[i]};
+      EXPECT_DOUBLE_EQ(f.EvalPar(point, params), result[i]);
+   }
+
+   // lambda expressions are evaluated point by point
+   TFormula flambda("batchLambda", "[](double *x, double *p){ return p[0] * x[0]; }", 1, 1);
+   flambda.SetParameter(0, 3.);
+   flambda.EvalParBatch(n, columns, result.data());
+   for (int i = 0; i < n; ++i)
+      EXPECT_DOUBLE_EQ(3. * xs[i], result[i]);
+}
+
+// The batch function reads as many coordinate arrays as the formula has
+// dimensions, so it must not be shared between formulas with the same
+// expression but a different number of dimensions. A TF2 and then a TF1 with
+// the same expression must each read only the coordinate arrays they get.
+TEST(TFormula, EvalParBatchSameExpressionDifferentDimensions)
+{
+   TF2 f2("batchF2", "[0]*x*x + [1]", -5., 5., -5., 5.);
+   f2.SetParameters(2., 3.);
+   TF1 f1("batchF1", "[0]*x*x + [1]", -5., 5.);
+   f1.SetParameters(2., 3.);
+
+   constexpr int n = 100;
+   std::vector<double> xs(n), ys(n), result(n);
+   for (int i = 0; i < n; ++i) {
+      xs[i] = -5. + 0.1 * i;
+      ys[i] = 0.05 * i;
+   }
+
+   const double *columns2[2] = {xs.data(), ys.data()};
+   f2.GetFormula()->EvalParBatch(n, columns2, result.data());
+   for (int i = 0; i < n; ++i)
+      EXPECT_DOUBLE_EQ(2. * xs[i] * xs[i] + 3., result[i]);
+
+   // Only one coordinate array, a kernel for two dimensions would read past it
+   const double *columns1[1] = {xs.data()};
+   f1.GetFormula()->EvalParBatch(n, columns1, result.data());
+   for (int i = 0; i < n; ++i)
+      EXPECT_DOUBLE_EQ(2. * xs[i] * xs[i] + 3., result[i]);
+}
@@ -0,0 +1,76 @@
+#include "gtest/gtest.h"
+#include "TGraph.h"
+#include "TMath.h"
+#include "TRandom3.h"
+
+#include <vector>
+
+namespace {
+
+// graph with unsorted, distinct abscissas
+TGraph MakeGraph(Int_t n)
+{
+   TGraph graph(n);
+   TRandom3 rndm(1);
+   for (Int_t i = 0; i < n; ++i) {
+      const Double_t x = (i * 37 % n) + rndm.Uniform(0., 0.5);
+      graph.SetPoint(i, x, TMath::Sin(0.1 * x));
+   }
+   return graph;
+}
+
+} // namespace
+
+TEST(TGraphEval, CachedLinear)
+{
+   auto graph = MakeGraph(101);
+   for (Double_t x = -5.; x < 110.; x += 0.37) {
+      EXPECT_NEAR(graph.Eval(x, nullptr, "C"), graph.Eval(x), 1e-12) << "x = " << x;
+   }
+   // evaluation on a point returns its ordinate
+   EXPECT_EQ(graph.Eval(graph.GetPointX(10), nullptr, "C"), graph.GetPointY(10));
+}
+
+TEST(TGraphEval, CachedSpline)
+{
+   auto graph = MakeGraph(101);
+   for (Double_t x = -5.; x < 110.; x += 0.37) {
+      EXPECT_NEAR(graph.Eval(x, nullptr, "CS"), graph.Eval(x, nullptr, "S"), 1e-10) << "x = " << x;
+   }
+}
+
+TEST(TGraphEval, Batch)
+{
+   auto graph = MakeGraph(101);
+   TRandom3 rndm(2);
+   std::vector<Double_t> x(1000);
+   // an increasing sequence followed by random values
+   for (std::size_t i = 0; i < x.size(); ++i)
+      x[i] = i < x.size() / 2 ? -5. + 0.23 * i : rndm.Uniform(-5., 110.);
+
+   std::vector<Double_t> linear(x.size()), spline(x.size());
+   graph.Eval(x, linear);
+   graph.Eval(x, spline, "S");
+   for (std::size_t i = 0; i < x.size(); ++i) {
+      EXPECT_NEAR(linear[i], graph.Eval(x[i]), 1e-12) << "x = " << x[i];
+      EXPECT_NEAR(spline[i], graph.Eval(x[i], nullptr, "S"), 1e-10) << "x = " << x[i];
+   }
+}
+
+TEST(TGraphEval, CacheInvalidation)
+{
+   auto graph = MakeGraph(11);
+   const Double_t x = graph.GetPointX(3);
+   EXPECT_EQ(graph.Eval(x, nullptr, "C"), graph.GetPointY(3));
+
+   graph.SetPoint(3, x, 42.);
+   EXPECT_EQ(graph.Eval(x, nullptr, "C"), 42.);
+
+   graph.RemovePoint(3);
+   EXPECT_NEAR(graph.Eval(x, nullptr, "C"), graph.Eval(x), 1e-12);
+
+   // direct modifications need an explicit reset
+   graph.GetY()[0] = -1.;
+   graph.ResetEvalCache();
+   EXPECT_EQ(graph.Eval(graph.GetPointX(0), nullptr, "C"), -1.);
+}
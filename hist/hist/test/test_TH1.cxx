@@ -2,8 +2,18 @@
 
 #include "TH1.h"
 #include "TH1F.h"
+#include "TH2.h"
+#include "TH3.h"
+#include "TAxis.h"
+#include "TMath.h"
 #include "THLimitsFinder.h"
+#include "TList.h"
+#include "TProfile.h"
+#include "TRandom3.h"
+#include "TROOT.h"
 
+#include <cmath>
+#include <limits>
 #include <vector>
 
 // StatOverflows TH1
@@ -63,3 +73,164 @@ TEST(TH1, SmoothArrayCrossCheck)
       EXPECT_FLOAT_EQ(arr2[i], 1.0);
    }
 }
+
+// Batch filling gives the same contents and statistics as filling one entry at a time
+template <typename Hist>
+void ExpectSameHistogram(const Hist &batch, const Hist &single)
+{
+   ASSERT_EQ(batch.GetNcells(), single.GetNcells());
+   for (Int_t bin = 0; bin < single.GetNcells(); ++bin) {
+      EXPECT_DOUBLE_EQ(batch.GetBinContent(bin), single.GetBinContent(bin)) << "bin " << bin;
+      EXPECT_DOUBLE_EQ(batch.GetBinError(bin), single.GetBinError(bin)) << "bin " << bin;
+   }
+   EXPECT_EQ(batch.GetEntries(), single.GetEntries());
+   Double_t statsBatch[TH1::kNstat] = {};
+   Double_t statsSingle[TH1::kNstat] = {};
+   batch.GetStats(statsBatch);
+   single.GetStats(statsSingle);
+   for (Int_t i = 0; i < TH1::kNstat; ++i)
+      EXPECT_NEAR(statsBatch[i], statsSingle[i], 1e-9 * std::abs(statsSingle[i])) << "stat " << i;
+}
+
+TEST(TH1, BatchFill)
+{
+   TRandom3 rng(42);
+   const int n = 10000;
+   std::vector<double> x(n), y(n), z(n), w(n);
+   for (int i = 0; i < n; ++i) {
+      x[i] = rng.Gaus(0, 2);
+      y[i] = rng.Gaus(1, 2);
+      z[i] = rng.Uniform(-5, 5);
+      w[i] = rng.Uniform(0.5, 1.5);
+   }
+   x[0] = std::numeric_limits<double>::quiet_NaN();
+   x[1] = std::numeric_limits<double>::infinity();
+   x[2] = -1e300;
+
+   const double edges[] = {-4, -2, -1, -0.5, 0, 0.25, 0.5, 1, 2, 3, 5};
+   for (bool variable : {false, true}) {
+      TH1D h1dBatch("h1dBatch", "", 20, -4, 4);
+      TH1D h1dSingle("h1dSingle", "", 20, -4, 4);
+      TH1F h1fBatch("h1fBatch", "", 10, edges);
+      TH1F h1fSingle("h1fSingle", "", 10, edges);
+      if (variable) {
+         h1dBatch.SetBins(10, edges);
+         h1dSingle.SetBins(10, edges);
+      }
+      h1dBatch.Fill(x, w);
+      h1fBatch.Fill(x);
+      for (int i = 0; i < n; ++i) {
+         h1dSingle.Fill(x[i], w[i]);
+         h1fSingle.Fill(x[i]);
+      }
+      ExpectSameHistogram(h1dBatch, h1dSingle);
+      ExpectSameHistogram(h1fBatch, h1fSingle);
+   }
+
+   TH2F h2Batch("h2Batch", "", 10, edges, 15, -3, 3);
+   TH2F h2Single("h2Single", "", 10, edges, 15, -3, 3);
+   h2Batch.Fill(x, y, w);
+   for (int i = 0; i < n; ++i)
+      h2Single.Fill(x[i], y[i], w[i]);
+   ExpectSameHistogram(h2Batch, h2Single);
+
+   TH3D h3Batch("h3Batch", "", 8, -4, 4, 10, -3, 3, 5, -5, 5);
+   TH3D h3Single("h3Single", "", 8, -4, 4, 10, -3, 3, 5, -5, 5);
+   h3Batch.Fill(x, y, z);
+   for (int i = 0; i < n; ++i)
+      h3Single.Fill(x[i], y[i], z[i]);
+   ExpectSameHistogram(h3Batch, h3Single);
+
+   TProfile pBatch("pBatch", "", 10, edges, -2, 4);
+   TProfile pSingle("pSingle", "", 10, edges, -2, 4);
+   pBatch.Fill(x, y, w);
+   for (int i = 0; i < n; ++i)
+      pSingle.Fill(x[i], y[i], w[i]);
+   ExpectSameHistogram(pBatch, pSingle);
+}
+
+// FindBin with the precomputed inverse bin width and bin lookup must agree with the plain formulas
+TEST(TAxis, FindBinFastPaths)
+{
+   TRandom3 rng(7);
+   std::vector<double> x;
+   for (int i = 0; i < 100000; ++i)
+      x.push_back(rng.Uniform(-1.1, 1.1));
+   // values on the bin edges, where rounding matters
+   for (int i = 0; i <= 1000; ++i)
+      x.push_back(-1 + 2. * i / 1000);
+
+   for (int nbins : {3, 10, 100, 1000, 12345}) {
+      TAxis axis(nbins, -1, 1);
+      for (double xi : x) {
+         const int expected =
+            xi < -1 ? 0 : (!(xi < 1) ? nbins + 1 : 1 + int(nbins * (xi - (-1)) / (1 - (-1))));
+         ASSERT_EQ(axis.FindFixBin(xi), expected) << "x = " << xi << ", nbins = " << nbins;
+         ASSERT_EQ(axis.FindBin(xi), expected) << "x = " << xi << ", nbins = " << nbins;
+      }
+   }
+
+   // variable bins of very different widths, including empty ones
+   std::vector<double> edges{-1};
+   while (edges.back() < 1)
+      edges.push_back(edges.back() + (edges.size() % 7 == 0 ? 0 : std::pow(rng.Uniform(0, 1), 4) * 0.05));
+   edges.back() = 1;
+   TAxis axis(edges.size() - 1, edges.data());
+   for (double xi : edges)
+      x.push_back(xi);
+   for (double xi : x) {
+      const int expected = (xi < -1 || !(xi < 1)) ? axis.FindFixBin(xi)
+                                                  : 1 + TMath::BinarySearch(edges.size(), edges.data(), xi);
+      ASSERT_EQ(axis.FindFixBin(xi), expected) << "x = " << xi;
+   }
+
+   // the cached quantities follow changes of the axis
+   TAxis copy(axis);
+   copy.Set(4, 0., 8.);
+   EXPECT_EQ(copy.FindFixBin(4.5), 3);
+   copy.SetLimits(0., 4.);
+   EXPECT_EQ(copy.FindFixBin(2.5), 3);
+   EXPECT_EQ(axis.FindFixBin(edges[5]), 6);
+}
+
+// Merge of many histograms with identical axes, large enough to merge bin ranges in parallel
+TEST(TH1, MergeIdenticalAxes)
+{
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT(4);
+#endif
+   TRandom3 rng(17);
+   TH2D merged("merged", "merged", 1000, -5., 5., 1000, -5., 5.);
+   TH2D expected("expected", "expected", 1000, -5., 5., 1000, -5., 5.);
+   merged.SetDirectory(nullptr);
+   expected.SetDirectory(nullptr);
+   expected.Sumw2();
+   TList inputs;
+   inputs.SetOwner();
+   for (int i = 0; i < 4; ++i) {
+      auto h = new TH2D(Form("h%d", i), "h", 1000, -5., 5., 1000, -5., 5.);
+      h->SetDirectory(nullptr);
+      for (int j = 0; j < 10000; ++j)
+         h->Fill(rng.Gaus(0., 2.), rng.Gaus(0., 2.), i % 2 ? rng.Uniform(0.5, 1.5) : 1.);
+      expected.Add(h);
+      inputs.Add(h);
+   }
+   // an empty one is skipped
+   auto hempty = new TH2D("hempty", "h", 1000, -5., 5., 1000, -5., 5.);
+   hempty->SetDirectory(nullptr);
+   inputs.Add(hempty);
+
+   EXPECT_DOUBLE_EQ(expected.GetEntries(), merged.Merge(&inputs));
+   EXPECT_NE(0, merged.GetSumw2N());
+
+   for (Int_t bin = 0; bin < merged.GetNcells(); ++bin) {
+      ASSERT_DOUBLE_EQ(expected.GetBinContent(bin), merged.GetBinContent(bin));
+      ASSERT_DOUBLE_EQ(expected.GetBinError(bin), merged.GetBinError(bin));
+   }
+   EXPECT_DOUBLE_EQ(expected.GetMean(1), merged.GetMean(1));
+   EXPECT_DOUBLE_EQ(expected.GetStdDev(2), merged.GetStdDev(2));
+   EXPECT_DOUBLE_EQ(expected.GetCorrelationFactor(), merged.GetCorrelationFactor());
+#ifdef R__USE_IMT
+   ROOT::DisableImplicitMT();
+#endif
+}
@@ -0,0 +1,185 @@
+/// \file ROOT/RHistShardedFill.hxx
+/// \ingroup HistV7
+/// \date 2026-10-18
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RHistShardedFill
+#define ROOT7_RHistShardedFill
+
+#include "ROOT/RSpan.hxx"
+#include "ROOT/RHist.hxx"
+
+#include <atomic>
+#include <memory>
+
+namespace ROOT {
+namespace Experimental {
+
+template <class HIST>
+class RHistShardedFillManager;
+
+/**
+ \class RHistShardedFiller
+ Fills a thread's private copy (shard) of the histogram of a
+ RHistShardedFillManager. Enables multi-threaded filling without any
+ synchronization between the filling threads.
+
+ A filler must only be used by one thread at a time. Its shard is handed over
+ to the manager by Flush() and on destruction; the next Fill() starts a new,
+ empty shard.
+ **/
+
+template <class HIST>
+class RHistShardedFiller {
+public:
+   using CoordArray_t = typename HIST::CoordArray_t;
+   using Weight_t = typename HIST::Weight_t;
+
+private:
+   using Shard_t = typename RHistShardedFillManager<HIST>::RShard;
+
+   RHistShardedFillManager<HIST> *fManager; ///< The manager receiving the shards
+   std::unique_ptr<Shard_t> fShard;         ///< The shard currently filled, if any
+
+   HIST &GetShardHist()
+   {
+      if (!fShard)
+         fShard = fManager->MakeShard();
+      return fShard->fHist;
+   }
+
+public:
+   RHistShardedFiller(RHistShardedFillManager<HIST> &manager): fManager(&manager) {}
+   RHistShardedFiller(RHistShardedFiller &&) = default;
+   RHistShardedFiller &operator=(RHistShardedFiller &&other)
+   {
+      Flush();
+      fManager = other.fManager;
+      fShard = std::move(other.fShard);
+      return *this;
+   }
+   ~RHistShardedFiller() { Flush(); }
+
+   /// Thread-specific HIST::Fill().
+   void Fill(const CoordArray_t &x, Weight_t weight = (Weight_t)1) { GetShardHist().Fill(x, weight); }
+
+   /// Thread-specific HIST::FillN().
+   void FillN(const std::span<const CoordArray_t> xN, const std::span<const Weight_t> weightN)
+   {
+      GetShardHist().FillN(xN, weightN);
+   }
+
+   /// Thread-specific HIST::FillN().
+   void FillN(const std::span<const CoordArray_t> xN) { GetShardHist().FillN(xN); }
+
+   /// Hand the filled shard over to the manager; it will be added to the
+   /// histogram by the next RHistShardedFillManager::Flush().
+   void Flush()
+   {
+      if (fShard)
+         fManager->Publish(std::move(fShard));
+   }
+
+   static constexpr int GetNDim() { return HIST::GetNDim(); }
+};
+
+/**
+ \class RHistShardedFillManager
+ Manages multi-threaded filling of a histogram through per-thread shards.
+
+ The HIST template must be a RHist instance. This class hands out
+ RHistShardedFiller objects, each of which fills its own, initially empty,
+ copy of the histogram: filling threads never share memory nor wait for each
+ other. Flushed shards are pushed onto a lock-free list; Flush() adds all of
+ them to the histogram. Unlike RHistConcurrentFillManager, no lock is taken at
+ any point.
+
+ Flush() may be called while other threads are filling, but not concurrently
+ with readers of the histogram nor with another Flush(). It is called by the
+ destructor of the manager; all fillers must have been flushed or destroyed
+ before.
+
+ Each shard is a full copy of the histogram, so the memory needed grows with
+ the number of filling threads: this is the right tool for histograms with
+ many entries per bin, RHistConcurrentFillManager for very large ones.
+ **/
+
+template <class HIST>
+class RHistShardedFillManager {
+   friend class RHistShardedFiller<HIST>;
+
+public:
+   using Hist_t = HIST;
+   using CoordArray_t = typename HIST::CoordArray_t;
+   using Weight_t = typename HIST::Weight_t;
+
+private:
+   /// A thread's private histogram, and the link in the list of flushed shards.
+   struct RShard {
+      HIST fHist;
+      RShard *fNext = nullptr;
+
+      RShard(const HIST &hist): fHist(hist) {}
+   };
+
+   HIST &fHist;                            ///< The histogram filled
+   HIST fEmpty;                            ///< Empty histogram with the binning of fHist, copied for new shards
+   std::atomic<RShard *> fFlushed{nullptr}; ///< Shards flushed by the fillers, not yet added to fHist
+
+   /// Create an empty shard; only reads fEmpty, so it is safe to call concurrently.
+   std::unique_ptr<RShard> MakeShard() const { return std::make_unique<RShard>(fEmpty); }
+
+   /// Push a filled shard onto the list of flushed shards.
+   void Publish(std::unique_ptr<RShard> shard)
+   {
+      RShard *head = fFlushed.load(std::memory_order_relaxed);
+      do {
+         shard->fNext = head;
+      } while (!fFlushed.compare_exchange_weak(head, shard.get(), std::memory_order_release, std::memory_order_relaxed));
+      shard.release();
+   }
+
+public:
+   RHistShardedFillManager(HIST &hist): fHist(hist), fEmpty(hist)
+   {
+      auto &impl = *fEmpty.GetImpl();
+      impl.GetStat() = typename HIST::ImplBase_t::Stat_t(impl.GetNBinsNoOver(), impl.GetNOverflowBins());
+   }
+   RHistShardedFillManager(const RHistShardedFillManager &) = delete;
+   RHistShardedFillManager &operator=(const RHistShardedFillManager &) = delete;
+   ~RHistShardedFillManager() { Flush(); }
+
+   RHistShardedFiller<HIST> MakeFiller() { return RHistShardedFiller<HIST>{*this}; }
+
+   /// Add all shards flushed so far to the histogram.
+   void Flush()
+   {
+      RShard *shard = fFlushed.exchange(nullptr, std::memory_order_acquire);
+      while (shard) {
+         std::unique_ptr<RShard> current(shard);
+         shard = shard->fNext;
+         Add(fHist, current->fHist);
+      }
+   }
+
+   /// Flush and return the histogram.
+   HIST &GetHist()
+   {
+      Flush();
+      return fHist;
+   }
+};
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
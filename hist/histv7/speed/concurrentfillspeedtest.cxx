@@ -0,0 +1,90 @@
+/// \file concurrentfillspeedtest.cxx
+///
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+///
+/// Compares the multi-threaded filling of a RH2D through RHistConcurrentFillManager
+/// (buffered fills, mutex-protected flush) and RHistShardedFillManager (per-thread
+/// shards, lock-free hand-over) for 1 to 128 threads.
+///
+/// Build and run with
+///
+///     g++ -o concurrentspeedtest concurrentfillspeedtest.cxx `root-config --cflags --libs` -lROOTHist -O3
+///     ./concurrentspeedtest [fills per thread, default 1e7] [max threads, default 128]
+
+#include "ROOT/RHist.hxx"
+#include "ROOT/RHistConcurrentFill.hxx"
+#include "ROOT/RHistShardedFill.hxx"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace ROOT::Experimental;
+
+struct Timer {
+   using TimePoint_t = decltype(std::chrono::high_resolution_clock::now());
+
+   const char *fTitle;
+   size_t fCount;
+   TimePoint_t fStart;
+
+   Timer(const char *title, size_t count)
+      : fTitle(title), fCount(count), fStart(std::chrono::high_resolution_clock::now())
+   {}
+
+   ~Timer()
+   {
+      using namespace std::chrono;
+      auto end = high_resolution_clock::now();
+      duration<double> time_span = duration_cast<duration<double>>(end - fStart);
+      std::cout << fCount << " * " << fTitle << ": " << time_span.count() << " seconds, \t";
+      std::cout << fCount / (1e6) / time_span.count() << " millions per seconds \n";
+   }
+};
+
+/// Run `nThreads` threads, each calling `fill(filler, x, y)` `nFills` times with
+/// its own filler made by `mgr`.
+template <class MANAGER>
+void RunThreads(MANAGER &mgr, int nThreads, size_t nFills)
+{
+   std::vector<std::thread> threads;
+   for (int t = 0; t < nThreads; ++t) {
+      threads.emplace_back([filler = mgr.MakeFiller(), t, nFills]() mutable {
+         std::mt19937_64 gen(t);
+         std::uniform_real_distribution<double> uniform(0., 1.);
+         for (size_t i = 0; i < nFills; ++i)
+            filler.Fill({uniform(gen), uniform(gen)});
+      });
+   }
+   for (auto &thr : threads)
+      thr.join();
+}
+
+int main(int argc, char *argv[])
+{
+   const size_t nFills = argc > 1 ? std::atof(argv[1]) : 1e7;
+   const int maxThreads = argc > 2 ? std::atoi(argv[2]) : 128;
+
+   std::cout << "hardware threads: " << std::thread::hardware_concurrency() << '\n';
+   for (int nThreads = 1; nThreads <= maxThreads; nThreads *= 2) {
+      std::cout << "threads: " << nThreads << '\n';
+      {
+         RH2D hist{{100, 0., 1.}, {100, 0., 1.}};
+         RHistConcurrentFillManager<RH2D> mgr(hist);
+         Timer t("RHistConcurrentFillManager Fill", nThreads * nFills);
+         RunThreads(mgr, nThreads, nFills);
+      }
+      {
+         RH2D hist{{100, 0., 1.}, {100, 0., 1.}};
+         RHistShardedFillManager<RH2D> mgr(hist);
+         Timer t("RHistShardedFillManager Fill", nThreads * nFills);
+         RunThreads(mgr, nThreads, nFills);
+         mgr.Flush();
+      }
+   }
+   return 0;
+}
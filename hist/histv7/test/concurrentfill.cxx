@@ -1,6 +1,7 @@
 #include "gtest/gtest.h"
 #include "ROOT/RHist.hxx"
 #include "ROOT/RHistConcurrentFill.hxx"
+#include "ROOT/RHistShardedFill.hxx"
 
 #include <iostream>
 #include <future>
@@ -143,3 +144,58 @@ TEST(ConcurrentFillTest, FillFlush)
    EXPECT_EQ(0, (int)Filler_1.GetCoords().size());
    EXPECT_EQ(0, (int)Filler_2.GetCoords().size());
 }
+
+// Test sharded filling from several threads, with flushes while other threads are filling
+TEST(ConcurrentFillTest, ShardedFill)
+{
+   Experimental::RH2D hist{{100, 0., 1.}, {{0., 1., 2., 3., 10.}}};
+   hist.Fill({0.42, 4.2}, 3.f);
+
+   {
+      Experimental::RHistShardedFillManager<Experimental::RH2D> fillMgr(hist);
+
+      std::array<std::thread, 4> threads;
+      for (auto &thr : threads) {
+         thr = std::thread([filler = fillMgr.MakeFiller()]() mutable {
+            for (int i = 0; i < 3000; ++i) {
+               filler.Fill({(double)i / 100, (double)i / 10}, (float)i);
+               if (i == 1500)
+                  filler.Flush();
+            }
+         });
+      }
+      fillMgr.Flush();
+      for (auto &thr : threads)
+         thr.join();
+
+      // the remaining shards are added by GetHist() or the destructor of the manager
+      EXPECT_EQ(4 * 3000 + 1, fillMgr.GetHist().GetEntries());
+   }
+   EXPECT_EQ(4 * 3000 + 1, hist.GetEntries());
+   EXPECT_FLOAT_EQ(3.f + 4 * 42.f, hist.GetBinContent({(double)42 / 100, (double)42 / 10}));
+}
+
+// Test that nothing reaches the histogram before the manager is flushed
+TEST(ConcurrentFillTest, ShardedFillFlush)
+{
+   Experimental::RH2D hist{{100, 0., 1.}, {{0., 1., 2., 3., 10.}}};
+   Experimental::RHistShardedFillManager<Experimental::RH2D> fillMgr(hist);
+
+   auto filler = fillMgr.MakeFiller();
+   filler.Fill({0.1111, 4.22});
+   filler.Fill({0.3333, 4.44}, .42f);
+   filler.Flush();
+   EXPECT_EQ(0, hist.GetEntries());
+
+   fillMgr.Flush();
+   EXPECT_EQ(2, hist.GetEntries());
+   EXPECT_FLOAT_EQ(1.f, hist.GetBinContent({0.1111, 4.22}));
+   EXPECT_FLOAT_EQ(.42f, hist.GetBinContent({0.3333, 4.44}));
+
+   // the filler starts a new shard after a flush
+   filler.Fill({0.1111, 4.22}, .5f);
+   filler.Flush();
+   fillMgr.Flush();
+   EXPECT_EQ(3, hist.GetEntries());
+   EXPECT_FLOAT_EQ(1.5f, hist.GetBinContent({0.1111, 4.22}));
+}
@@ -126,6 +126,14 @@ private:
 
    void Merge(TBufferMergerFile *memfile);
 
+   /** Merge the objects of memfile directly into their counterparts in the output file,
+    *  bypassing the directory traversal of TFileMerger. Only done when every object of
+    *  memfile is mergeable and already present in the output (i.e. after the first merge).
+    *  The trees only relocate and append the baskets prepared by the worker thread.
+    * @return whether the objects were merged
+    */
+   bool MergeDirect(TBufferMergerFile *memfile);
+
    TFileMerger fMerger{false, false};                            //< TFileMerger used to merge all buffers
    std::mutex fMergeMutex;                                       //< Mutex used to lock fMerger
    std::vector<std::weak_ptr<TBufferMergerFile>> fAttachedFiles; //< Attached files
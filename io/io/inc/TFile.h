@@ -138,6 +138,7 @@ protected:
    virtual void        Init(Bool_t create);
            Bool_t      FlushWriteCache();
            Int_t       ReadBufferViaCache(char *buf, Int_t len);
+           Bool_t      ReadBuffersVectored(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf);
            Int_t       WriteBufferViaCache(const char *buf, Int_t len);
 
    ////////////////////////////////////////////////////////////////////////////////
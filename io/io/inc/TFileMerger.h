@@ -54,6 +54,7 @@ protected:
    TString        fObjectNames;               ///< List of object names to be either merged exclusively or skipped
    TList          fMergeList;                 ///< list of TObjString containing the name of the files need to be merged
    TList          fExcessFiles;               ///<! List of TObjString containing the name of the files not yet added to fFileList due to user or system limitation on the max number of files opened.
+   Bool_t         fParallel{kFALSE};          ///<! True if the objects may be merged concurrently (requires implicit MT)
 
    Bool_t         OpenExcessFiles();
    virtual Bool_t AddFile(TFile *source, Bool_t own, Bool_t cpProgress);
@@ -120,6 +121,8 @@ public:
    virtual Bool_t Merge(Bool_t = kTRUE);
    virtual Bool_t PartialMerge(Int_t type = kAll | kIncremental);
    virtual void   SetFastMethod(Bool_t fast=kTRUE)  {fFastMethod = fast;}
+           Bool_t GetParallel() const { return fParallel; }
+   virtual void   SetParallel(Bool_t parallel=kTRUE) {fParallel = parallel;}
            Bool_t GetNotrees() const { return fNoTrees; }
    virtual void   SetNotrees(Bool_t notrees=kFALSE) {fNoTrees = notrees;}
            void   RecursiveRemove(TObject *obj) override;
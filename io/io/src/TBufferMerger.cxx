@@ -12,11 +12,14 @@
 #include "ROOT/TBufferMerger.hxx"
 
 #include "TBufferFile.h"
+#include "TClass.h"
 #include "TError.h"
+#include "TFileMergeInfo.h"
 #include "TROOT.h"
 #include "TVirtualMutex.h"
 
 #include <utility>
+#include <vector>
 
 namespace ROOT {
 
@@ -77,10 +80,47 @@ void TBufferMerger::Merge(ROOT::TBufferMergerFile *memfile)
 {
    std::lock_guard q(fMergeMutex);
    memfile->WriteStreamerInfo();
+   if (MergeDirect(memfile))
+      return;
    fMerger.AddFile(memfile);
    fMerger.PartialMerge(TFileMerger::kAll | TFileMerger::kIncremental | TFileMerger::kDelayWrite |
                         TFileMerger::kKeepCompression);
    fMerger.Reset();
 }
 
+bool TBufferMerger::MergeDirect(ROOT::TBufferMergerFile *memfile)
+{
+   TFile *output = fMerger.GetOutputFile();
+   // Written keys and sub-directories need the full TFileMerger treatment.
+   if (!output || fMerger.GetNotrees() || memfile->GetListOfKeys()->GetSize())
+      return false;
+
+   std::vector<std::pair<TObject *, TObject *>> targets;
+   for (TObject *obj : *memfile->GetList()) {
+      TClass *cl = obj->IsA();
+      if (!cl->GetMerge() || cl->InheritsFrom(TDirectory::Class()))
+         return false;
+      TObject *target = output->GetList()->FindObject(obj->GetName());
+      if (!target || target->IsA() != cl)
+         return false;
+      targets.emplace_back(target, obj);
+   }
+
+   // Same options as used by Merge(): the output keeps the compression of the inputs.
+   TDirectory::TContext ctxt;
+   TFileMergeInfo info(output);
+   info.fOptions = fMerger.GetMergeOptions();
+   info.fOptions.Append(" fast");
+   TList inputs;
+   for (auto &[target, obj] : targets) {
+      obj->ResetBit(kMustCleanup);
+      inputs.Add(obj);
+      if (target->IsA()->GetMerge()(target, &inputs, &info) < 0)
+         Error("TBufferMerger::Merge", "calling Merge() on '%s'", target->GetName());
+      inputs.Clear();
+      info.Reset();
+   }
+   return true;
+}
+
 } // namespace ROOT
@@ -28,8 +28,9 @@ TBufferMergerFile::~TBufferMergerFile()
 
 Int_t TBufferMergerFile::Write(const char *name, Int_t opt, Int_t bufsize)
 {
-   // Make sure the compression of the basket is done in the unlocked thread and
-   // not in the locked section.
+   // Make sure the compression of the basket, and the loading of the compressed
+   // baskets handed over to the merge (see TBranch::PrepareBaskets), is done in
+   // the unlocked thread and not in the locked section.
    if (!fMerger.GetNotrees())
       TMemFile::Write(name, opt | TObject::kOnlyPrepStep, bufsize);
 
@@ -152,6 +152,11 @@ The structure of a directory is shown in TDirectoryFile::TDirectoryFile
 #include "TGlobal.h"
 #include "ROOT/RConcurrentHashColl.hxx"
 #include <memory>
+#include <vector>
+
+#ifdef R__HAS_URING
+#include "ROOT/RIoUring.hxx"
+#endif
 
 #ifdef R__FBSD
 #include <sys/extattr.h>
@@ -1811,12 +1816,88 @@ Bool_t TFile::ReadBuffer(char *buf, Int_t len)
    return kTRUE;
 }
 
+#ifndef WIN32
+namespace {
+
+/// One read issued by TFile::ReadBuffersVectored(): the file range [fOffset, fOffset + fSize)
+/// is read into fBuffer, which is either the caller's buffer or a scratch area.
+struct RCoalescedRead {
+   char *fBuffer = nullptr;
+   Long64_t fOffset = 0;
+   std::size_t fSize = 0;
+   std::size_t fOutBytes = 0;
+};
+
+/// Complete the given reads with positional reads, picking up after any bytes already read.
+/// Returns the errno of the failed read, -1 on premature end of file and 0 on success.
+int CompleteReadsPositional(int fd, std::vector<RCoalescedRead> &reads)
+{
+   for (auto &r : reads) {
+      while (r.fOutBytes < r.fSize) {
+         auto siz = ::pread(fd, r.fBuffer + r.fOutBytes, r.fSize - r.fOutBytes, r.fOffset + r.fOutBytes);
+         if (siz < 0) {
+            if (errno == EINTR)
+               continue;
+            return errno;
+         }
+         if (siz == 0)
+            return -1;
+         r.fOutBytes += siz;
+      }
+   }
+   return 0;
+}
+
+/// Submit all reads at once through io_uring if available, then finish short or failed reads
+/// with positional reads. Return value as for CompleteReadsPositional().
+/// The submission waits for all reads to complete; the reads are not completed asynchronously.
+int SubmitReads(int fd, std::vector<RCoalescedRead> &reads)
+{
+#ifdef R__HAS_URING
+   // The ring is set up once per thread; setting it up per call would cost more than it saves.
+   thread_local std::unique_ptr<ROOT::Internal::RIoUring> ring;
+   thread_local bool uringFailed = false;
+   if (!uringFailed && !ring && reads.size() > 1) {
+      try {
+         ring = std::make_unique<ROOT::Internal::RIoUring>(); // throws std::runtime_error
+      } catch (const std::runtime_error &e) {
+         Warning("TFile::ReadBuffers", "io_uring setup failed, falling back to positional reads:\n%s", e.what());
+         uringFailed = true;
+      }
+   }
+   if (ring && reads.size() > 1) {
+      std::vector<ROOT::Internal::RIoUring::RReadEvent> events(reads.size());
+      for (std::size_t i = 0; i < reads.size(); ++i) {
+         events[i].fBuffer = reads[i].fBuffer;
+         events[i].fOffset = reads[i].fOffset;
+         events[i].fSize = reads[i].fSize;
+         events[i].fFileDes = fd;
+      }
+      try {
+         ring->SubmitReadsAndWait(events.data(), events.size());
+         for (std::size_t i = 0; i < reads.size(); ++i)
+            reads[i].fOutBytes = events[i].fOutBytes;
+      } catch (const std::runtime_error &e) {
+         // A failed read leaves unreaped completions in the ring, so it is set up again by the
+         // next call. The whole batch is read again below, which also reports a persistent error.
+         Warning("TFile::ReadBuffers", "io_uring read failed, retrying with positional reads:\n%s", e.what());
+         ring.reset();
+      }
+   }
+#endif
+   return CompleteReadsPositional(fd, reads);
+}
+
+} // anonymous namespace
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read the nbuf blocks described in arrays pos and len.
 ///
 /// The value pos[i] is the seek position of block i of length len[i].
 /// Note that for nbuf=1, this call is equivalent to TFile::ReafBuffer.
 /// This function is overloaded by TNetFile, TWebFile, etc.
+/// Plain local files are read with ReadBuffersVectored().
 /// Returns kTRUE in case of failure.
 
 Bool_t TFile::ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
@@ -1831,6 +1912,11 @@ Bool_t TFile::ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
       return kFALSE;
    }
 
+#ifndef WIN32
+   if (IsA() == TFile::Class() && fD >= 0 && nbuf > 1)
+      return ReadBuffersVectored(buf, pos, len, nbuf);
+#endif
+
    Int_t k = 0;
    Bool_t result = kTRUE;
    TFileCacheRead *old = fCacheRead;
@@ -1881,6 +1967,117 @@ Bool_t TFile::ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
    return result;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Read the nbuf blocks described in arrays pos and len into buf, like ReadBuffers(),
+/// for a local file.
+///
+/// Neighbouring blocks are coalesced into one read as long as the coalesced range stays
+/// below the read-ahead size (see SetReadaheadSize()); blocks adjacent in the file are
+/// read straight into buf, without a bounce through a scratch buffer, whatever their
+/// total size. All reads are then issued in a single batch: through io_uring when ROOT
+/// is built with it, with positional reads otherwise. The file offset is left after
+/// the last block, as with ReadBuffers().
+/// Returns kTRUE in case of failure.
+
+Bool_t TFile::ReadBuffersVectored(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
+{
+#ifndef WIN32
+   // A coalesced range [fBegin, fEnd) covering the blocks [fFirst, fLast); if fDirect,
+   // the blocks are adjacent in the file and the range is read to buf + fBufOffset.
+   struct RRange {
+      Int_t fFirst;
+      Int_t fLast;
+      Long64_t fBegin;
+      Long64_t fEnd;
+      Long64_t fBufOffset;
+      bool fDirect;
+   };
+
+   std::vector<RRange> ranges;
+   Long64_t k = 0;
+   Long64_t scratchSize = 0;
+   for (Int_t i = 0; i < nbuf; ++i) {
+      if (!ranges.empty()) {
+         auto &r = ranges.back();
+         const bool adjacent = r.fDirect && pos[i] == r.fEnd;
+         const bool inReadahead = pos[i] >= r.fEnd && pos[i] + len[i] - r.fBegin < fgReadaheadSize;
+         if (adjacent || inReadahead) {
+            r.fDirect = adjacent;
+            r.fEnd = pos[i] + len[i];
+            r.fLast = i + 1;
+            k += len[i];
+            continue;
+         }
+         if (!r.fDirect)
+            scratchSize += r.fEnd - r.fBegin;
+      }
+      ranges.push_back({i, i + 1, pos[i], pos[i] + len[i], k, true});
+      k += len[i];
+   }
+   if (!ranges.back().fDirect)
+      scratchSize += ranges.back().fEnd - ranges.back().fBegin;
+
+   std::vector<char> scratch(scratchSize);
+   std::vector<RCoalescedRead> reads(ranges.size());
+   Long64_t nread = 0;
+   for (std::size_t r = 0, s = 0; r < ranges.size(); ++r) {
+      const auto size = ranges[r].fEnd - ranges[r].fBegin;
+      if (ranges[r].fDirect) {
+         reads[r].fBuffer = buf + ranges[r].fBufOffset;
+      } else {
+         reads[r].fBuffer = scratch.data() + s;
+         s += size;
+      }
+      reads[r].fOffset = ranges[r].fBegin + fArchiveOffset;
+      reads[r].fSize = size;
+      nread += size;
+   }
+
+   Double_t start = 0;
+   if (gPerfStats) start = TTimeStamp();
+
+   const int status = SubmitReads(fD, reads);
+   if (status > 0) {
+      errno = status;
+      SysError("ReadBuffers", "error reading from file %s", GetName());
+      return kTRUE;
+   }
+   if (status < 0) {
+      Error("ReadBuffers", "error reading all requested bytes from file %s", GetName());
+      return kTRUE;
+   }
+
+   for (std::size_t r = 0; r < ranges.size(); ++r) {
+      if (ranges[r].fDirect)
+         continue;
+      Long64_t kr = ranges[r].fBufOffset;
+      for (Int_t i = ranges[r].fFirst; i < ranges[r].fLast; ++i) {
+         memcpy(&buf[kr], reads[r].fBuffer + (pos[i] - ranges[r].fBegin), len[i]);
+         kr += len[i];
+      }
+   }
+
+   // Leave the file offset where the blockwise read would have left it.
+   Seek(ranges.back().fEnd);
+
+   const Long64_t extra = nread - k;
+   fBytesRead       += k;
+   fgBytesRead      += k;
+   fBytesReadExtra  += extra;
+   fReadCalls       += reads.size();
+   fgReadCalls      += reads.size();
+
+   if (gMonitoringWriter)
+      gMonitoringWriter->SendFileReadProgress(this);
+   if (gPerfStats)
+      gPerfStats->FileReadEvent(this, k, start);
+   return kFALSE;
+#else
+   (void)buf; (void)pos; (void)len; (void)nbuf;
+   return kTRUE;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read buffer via cache.
 ///
@@ -20,6 +20,16 @@ any of its remote file access plugins. It is therefore useful in
 a Grid environment where the files might be accessible only remotely.
 The merging interface allows files containing histograms and trees
 to be merged, like the standalone hadd program.
+
+With SetParallel() and implicit multi-threading enabled (ROOT::EnableImplicitMT()),
+the objects that are merged through their Merge function (e.g. histograms) are
+merged concurrently, using as many threads as the implicit MT pool: the
+different keys of a directory are merged by different threads, and a key that
+is merged alone has its inputs read concurrently from the different files.
+Each object is still merged with its inputs in the order of the input files,
+and written in the order of the keys, so the output does not depend on the
+number of threads. TTrees are always merged serially; when their baskets are
+recompressed, the compression runs behind the copy (see TTree::SetWriteBehind).
 */
 
 #include "TFileMerger.h"
@@ -49,7 +59,12 @@ to be merged, like the standalone hadd program.
 #include <sys/resource.h>
 #endif
 
+#include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 ClassImp(TFileMerger);
 
@@ -435,6 +450,142 @@ Bool_t WriteCycleInOrder(const TString &name, TIter &nextkey, TIter &peeknextkey
    return WriteOneAndDelete(name, cl, obj, kFALSE, kTRUE, target) && result;
 };
 
+////////////////////////////////////////////////////////////////////////////////
+/// Read the objects of keys[start, stop) using up to `nworkers` threads.
+/// Each key must belong to a different input file, so that the reads
+/// (decompression and streaming) do not share any TFile state.
+
+void ReadKeysConcurrently(const std::vector<TKey *> &keys, std::vector<TObject *> &objs, std::size_t start,
+                          std::size_t stop, UInt_t nworkers)
+{
+   std::atomic<std::size_t> next{start};
+   auto work = [&]() {
+      for (std::size_t i = next++; i < stop; i = next++) {
+         if (!keys[i])
+            continue;
+         TDirectory::TContext ctxt(keys[i]->GetMotherDir());
+         objs[i] = keys[i]->ReadObj();
+      }
+   };
+   std::vector<std::thread> threads;
+   const std::size_t nthreads = std::min<std::size_t>(nworkers, stop - start);
+   for (std::size_t i = 1; i < nthreads; ++i)
+      threads.emplace_back(work);
+   work();
+   for (auto &t : threads)
+      t.join();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Merge the objects of keys[start, stop) using up to `nworkers` threads.
+/// Each key of dirs[0] is merged with the same-name objects of dirs[1], dirs[2]...
+/// in this order; the result, or nullptr if an input could not be read, is stored
+/// in objs. The accesses to an input file (reading the inputs, and deleting them
+/// since that unregisters them from their directory) are serialized by the mutex
+/// of the file, so the threads only overlap on different files and in Merge().
+
+void MergeKeysConcurrently(const std::vector<TKey *> &keys, std::vector<TObject *> &objs, std::size_t start,
+                           std::size_t stop, const std::vector<TDirectory *> &dirs, std::vector<std::mutex> &mutexes,
+                           TDirectory *target, const TString &options, ROOT::TIOFeatures *features,
+                           Bool_t histoOneGo, UInt_t nworkers)
+{
+   auto mergeKey = [&](TKey *key) -> TObject * {
+      // Keep the objects created by Merge() out of the (shared) input directories.
+      TDirectory::TContext ctxtMerge(nullptr);
+      const char *keyname = key->GetName();
+      TObject *obj = nullptr;
+      {
+         std::lock_guard<std::mutex> lock(mutexes[0]);
+         TDirectory::TContext ctxt(dirs[0]);
+         obj = key->ReadObj();
+      }
+      if (!obj) {
+         Info("TFileMerger::MergeRecursive", "could not read object for key {%s, %s}", keyname, key->GetTitle());
+         return nullptr;
+      }
+      ROOT::MergeFunc_t func = obj->IsA()->GetMerge();
+      const Bool_t oneGo = histoOneGo && obj->IsA()->InheritsFrom(R__TH1_Class);
+      TFileMergeInfo info(target);
+      info.fIOFeatures = features;
+      info.fOptions = options;
+
+      TList inputs;
+      // The objects read from the keys, with the index of their directory.
+      std::vector<std::pair<TObject *, std::size_t>> todelete;
+      auto deleteInputs = [&]() {
+         inputs.Clear();
+         for (auto &input : todelete) {
+            std::lock_guard<std::mutex> lock(mutexes[input.second]);
+            delete input.first;
+         }
+         todelete.clear();
+      };
+      for (std::size_t i = 1; i < dirs.size(); ++i) {
+         if (!dirs[i])
+            continue;
+         TObject *hobj = nullptr;
+         Bool_t readError = kFALSE;
+         {
+            std::lock_guard<std::mutex> lock(mutexes[i]);
+            hobj = dirs[i]->GetList()->FindObject(keyname);
+            TKey *key2 = hobj ? nullptr : (TKey *)dirs[i]->GetListOfKeys()->FindObject(keyname);
+            if (key2) {
+               TDirectory::TContext ctxt(dirs[i]);
+               hobj = key2->ReadObj();
+               if (hobj)
+                  todelete.emplace_back(hobj, i);
+               else
+                  readError = kTRUE;
+            }
+         }
+         if (readError) {
+            Info("TFileMerger::MergeRecursive", "could not read object for key {%s, %s}; skipping file %s", keyname,
+                 key->GetTitle(), dirs[i]->GetFile()->GetName());
+            deleteInputs();
+            std::lock_guard<std::mutex> lock(mutexes[0]);
+            delete obj;
+            return nullptr;
+         }
+         if (!hobj)
+            continue;
+         // Set ownership for collections
+         if (hobj->InheritsFrom(TCollection::Class())) {
+            ((TCollection *)hobj)->SetOwner();
+         }
+         hobj->ResetBit(kMustCleanup);
+         inputs.Add(hobj);
+         if (!oneGo) {
+            Long64_t result = func(obj, &inputs, &info);
+            info.fIsFirst = kFALSE;
+            if (result < 0) {
+               Error("TFileMerger::MergeRecursive", "calling Merge() on '%s' with the corresponding object in '%s'",
+                     keyname, dirs[i]->GetFile()->GetName());
+            }
+            deleteInputs();
+         }
+      }
+      // Merge the list, if still to be done
+      if (oneGo || info.fIsFirst) {
+         func(obj, &inputs, &info);
+         deleteInputs();
+      }
+      return obj;
+   };
+
+   std::atomic<std::size_t> next{start};
+   auto work = [&]() {
+      for (std::size_t i = next++; i < stop; i = next++)
+         objs[i] = mergeKey(keys[i]);
+   };
+   std::vector<std::thread> threads;
+   const std::size_t nthreads = std::min<std::size_t>(nworkers, stop - start);
+   for (std::size_t i = 1; i < nthreads; ++i)
+      threads.emplace_back(work);
+   work();
+   for (auto &t : threads)
+      t.join();
+}
+
 } // anonymous namespace
 
 Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type, TFileMergeInfo &info,
@@ -622,6 +773,12 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
       TList todelete;
       Bool_t oneGo = fHistoOneGo && cl->InheritsFrom(R__TH1_Class);
 
+      // Reading the inputs concurrently is only done for objects that are fully
+      // loaded in memory by ReadObj (a TTree still reads from its file while merging).
+      const UInt_t nworkers = (fParallel && ROOT::IsImplicitMTEnabled() && !cl->InheritsFrom(R__TTree_Class))
+                                 ? ROOT::GetThreadPoolSize()
+                                 : 1;
+
       // Loop over all source files and merge same-name object
       TFile *nextsource = current_file ? (TFile*)sourcelist->After( current_file ) : (TFile*)sourcelist->First();
       if (nextsource == 0) {
@@ -629,6 +786,69 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
          ROOT::MergeFunc_t func = cl->GetMerge();
          func(obj, &inputs, &info);
          info.fIsFirst = kFALSE;
+      } else if (nworkers > 1) {
+         // Locate the objects serially (this updates the list of directories to delete),
+         // then read them from the different source files in parallel. The merge itself
+         // is done in the order of the source list, so the result does not depend on
+         // the number of threads.
+         std::vector<TObject *> hobjs;
+         std::vector<TKey *> keys;
+         std::vector<TFile *> sources;
+         do {
+            TDirectory *ndir = getDirectory(nextsource, target->GetName(), path);
+            if (ndir) {
+               TObject *hobj = ndir->GetList()->FindObject(keyname);
+               TKey *key2 = hobj ? nullptr : (TKey *)ndir->GetListOfKeys()->FindObject(keyname);
+               if (hobj || key2) {
+                  hobjs.push_back(hobj);
+                  keys.push_back(key2);
+                  sources.push_back(nextsource);
+               }
+            }
+            nextsource = (TFile*)sourcelist->After( nextsource );
+         } while (nextsource);
+
+         // Without one-go merging, bound the number of objects held in memory at once.
+         const std::size_t batch = oneGo ? std::max<std::size_t>(hobjs.size(), 1) : nworkers;
+         ROOT::MergeFunc_t func = cl->GetMerge();
+         for (std::size_t start = 0; start < hobjs.size(); start += batch) {
+            const std::size_t stop = std::min(hobjs.size(), start + batch);
+            ReadKeysConcurrently(keys, hobjs, start, stop, nworkers);
+            for (std::size_t i = start; i < stop; ++i) {
+               if (keys[i] && hobjs[i])
+                  todelete.Add(hobjs[i]);
+            }
+            for (std::size_t i = start; i < stop; ++i) {
+               if (!hobjs[i]) {
+                  Info("MergeRecursive", "could not read object for key {%s, %s}; skipping file %s",
+                       keyname, keytitle, sources[i]->GetName());
+                  todelete.Delete();
+                  return kTRUE;
+               }
+            }
+            for (std::size_t i = start; i < stop; ++i) {
+               TObject *hobj = hobjs[i];
+               // Set ownership for collections
+               if (hobj->InheritsFrom(TCollection::Class())) {
+                  ((TCollection*)hobj)->SetOwner();
+               }
+               hobj->ResetBit(kMustCleanup);
+               inputs.Add(hobj);
+            }
+            Long64_t result = func(obj, &inputs, &info);
+            info.fIsFirst = kFALSE;
+            if (result < 0) {
+               Error("MergeRecursive", "calling Merge() on '%s' with the corresponding objects in '%s' and following",
+                     keyname, sources[start]->GetName());
+            }
+            inputs.Clear();
+            todelete.Delete();
+         }
+         // Merge the (empty) list, if still to be done
+         if (info.fIsFirst) {
+            func(obj, &inputs, &info);
+            info.fIsFirst = kFALSE;
+         }
       } else {
          do {
             // make sure we are at the correct directory level by cd'ing to path
@@ -874,11 +1094,69 @@ Bool_t TFileMerger::MergeRecursive(TDirectory *target, TList *sourcelist, Int_t
                return kFALSE; // Stop completely in case of error.
          } // while ( (obj = (TKey*)nextobj()))
 
+         // With SetParallel(), select the keys of an input file that MergeOne would merge
+         // through their Merge function (highest cycle only), to merge them concurrently.
+         // The names already in the output (incremental merge) are in allNames. The keys
+         // are merged a batch at a time, when the loop below reaches them, to bound the
+         // number of merged objects held in memory.
+         const UInt_t nworkers = (fParallel && ROOT::IsImplicitMTEnabled() && current_file)
+                                    ? ROOT::GetThreadPoolSize()
+                                    : 1;
+         std::vector<TKey *> concurrentKeys;
+         if (nworkers > 1) {
+            TString lastname;
+            TIter nextcandidate(current_sourcedir->GetListOfKeys());
+            while (TKey *key = (TKey *)nextcandidate()) {
+               if (lastname == key->GetName())
+                  continue;
+               lastname = key->GetName();
+               if (allNames.FindObject(lastname))
+                  continue;
+               TClass *cl = TClass::GetClass(key->GetClassName());
+               if (!cl || !cl->IsTObject() || !cl->GetMerge() || cl->InheritsFrom(TDirectory::Class()) ||
+                   cl->InheritsFrom(R__TTree_Class))
+                  continue;
+               if ((type & kOnlyListed) && !fObjectNames.Contains(lastname + " "))
+                  continue;
+               if (!(type & kResetable && type & kNonResetable) &&
+                   ((!(type & kResetable) && cl->GetResetAfterMerge()) ||
+                    (!(type & kNonResetable) && !cl->GetResetAfterMerge())))
+                  continue;
+               concurrentKeys.push_back(key);
+            }
+            if (concurrentKeys.size() < 2)
+               concurrentKeys.clear();
+         }
+         std::vector<TDirectory *> dirs;
+         if (!concurrentKeys.empty()) {
+            for (TFile *source = current_file; source; source = (TFile *)sourcelist->After(source))
+               dirs.push_back(source == current_file ? current_sourcedir : source->GetDirectory(path));
+         }
+         std::vector<std::mutex> mutexes(dirs.size());
+         std::vector<TObject *> merged(concurrentKeys.size(), nullptr);
+         std::size_t nextConcurrent = 0;
+         std::size_t mergedUpTo = 0;
+
          // loop over all keys in this directory
          TIter nextkey( current_sourcedir->GetListOfKeys() );
          TKey *key;
 
          while ( (key = (TKey*)nextkey())) {
+            if (nextConcurrent < concurrentKeys.size() && key == concurrentKeys[nextConcurrent]) {
+               if (nextConcurrent == mergedUpTo) {
+                  mergedUpTo = std::min<std::size_t>(concurrentKeys.size(), nextConcurrent + 4 * nworkers);
+                  MergeKeysConcurrently(concurrentKeys, merged, nextConcurrent, mergedUpTo, dirs, mutexes, target,
+                                        info.fOptions, fIOFeatures, fHistoOneGo, nworkers);
+               }
+               // Same bookkeeping as MergeOne: skip the lower cycles, write the merged object.
+               allNames.Add(new TObjString(key->GetName()));
+               oldkeyname = key->GetName();
+               if (TObject *mergedobj = merged[nextConcurrent++]) {
+                  target->cd();
+                  status = WriteOneAndDelete(oldkeyname, mergedobj->IsA(), mergedobj, kTRUE, kTRUE, target) && status;
+               }
+               continue;
+            }
             auto result = MergeOne(target, sourcelist, type,
                                    info, oldkeyname, allNames, status, onlyListed, path,
                                    current_sourcedir, current_file,
@@ -886,6 +1164,9 @@ Bool_t TFileMerger::MergeRecursive(TDirectory *target, TList *sourcelist, Int_t
             if (!result)
                return kFALSE; // Stop completely in case of error.
          } // while ( ( TKey *key = (TKey*)nextkey() ) )
+         // Merged objects whose key was not reached (only if the list of keys changed).
+         for (std::size_t i = nextConcurrent; i < mergedUpTo; ++i)
+            delete merged[i];
       }
       current_file = current_file ? (TFile*)sourcelist->After(current_file) : (TFile*)sourcelist->First();
       if (current_file) {
@@ -12,6 +12,7 @@
 #include <future>
 #include <memory>
 #include <thread>
+#include <vector>
 #include <sys/stat.h>
 
 #include "gtest/gtest.h"
@@ -118,6 +119,114 @@ TEST(TBufferMerger, ParallelTreeFill)
    EXPECT_TRUE(FileExists("tbuffermerger_parallel.root"));
 }
 
+TEST(TBufferMerger, RepeatedWrites)
+{
+   // After the first Write(), the tree already exists in the output file and the
+   // following ones are merged directly into it.
+   const char *fname = "tbuffermerger_repeated.root";
+   int nwrites = 4;
+   int nevents = 256;
+
+   ROOT::EnableThreadSafety();
+
+   {
+      TBufferMerger merger(fname);
+      auto myfile = merger.GetFile();
+      auto mytree = new TTree("mytree", "mytree");
+      int n = 0;
+      mytree->Branch("n", &n, "n/I");
+      for (int w = 0; w < nwrites; ++w) {
+         for (int i = 0; i < nevents; ++i, ++n)
+            mytree->Fill();
+         myfile->Write();
+         EXPECT_EQ(mytree->GetEntries(), 0);
+      }
+      mytree->ResetBranchAddresses();
+   }
+
+   {
+      TFile f(fname);
+      auto t = f.Get<TTree>("mytree");
+      ASSERT_TRUE(t != nullptr);
+      EXPECT_EQ(t->GetEntries(), nwrites * nevents);
+
+      int n = -1;
+      t->SetBranchAddress("n", &n);
+      for (int i = 0; i < t->GetEntries(); ++i) {
+         t->GetEntry(i);
+         EXPECT_EQ(n, i);
+      }
+      t->ResetBranchAddresses();
+   }
+
+   RemoveFile(fname);
+}
+
+TEST(TBufferMerger, ParallelRepeatedWrites)
+{
+   // Each worker hands its compressed baskets over to the merge (see
+   // TBranch::PrepareBaskets), also for split object branches.
+   const char *fname = "tbuffermerger_parallelrepeated.root";
+   int nworkers = 4;
+   int nwrites = 8;
+   int nevents = 100;
+
+   ROOT::EnableThreadSafety();
+
+   {
+      TBufferMerger merger(fname);
+      std::vector<std::thread> workers;
+      for (int w = 0; w < nworkers; ++w) {
+         workers.emplace_back([&merger, w, nwrites, nevents]() {
+            auto myfile = merger.GetFile();
+            auto mytree = new TTree("mytree", "mytree");
+            int n = 0;
+            std::vector<int> v;
+            mytree->Branch("n", &n, "n/I");
+            mytree->Branch("v", &v);
+            for (int k = 0; k < nwrites; ++k) {
+               for (int i = 0; i < nevents; ++i) {
+                  n = (w * nwrites + k) * nevents + i;
+                  v.assign(n % 5, n);
+                  mytree->Fill();
+               }
+               myfile->Write();
+            }
+            mytree->ResetBranchAddresses();
+         });
+      }
+      for (auto &worker : workers)
+         worker.join();
+   }
+
+   {
+      TFile f(fname);
+      auto t = f.Get<TTree>("mytree");
+      ASSERT_TRUE(t != nullptr);
+      const int nentries = nworkers * nwrites * nevents;
+      EXPECT_EQ(t->GetEntries(), nentries);
+
+      int n = -1;
+      std::vector<int> *v = nullptr;
+      std::vector<bool> seen(nentries, false);
+      t->SetBranchAddress("n", &n);
+      t->SetBranchAddress("v", &v);
+      for (int i = 0; i < t->GetEntries(); ++i) {
+         t->GetEntry(i);
+         ASSERT_TRUE(n >= 0 && n < nentries);
+         EXPECT_FALSE(seen[n]);
+         seen[n] = true;
+         ASSERT_EQ(v->size(), (std::size_t)(n % 5));
+         for (int x : *v)
+            EXPECT_EQ(x, n);
+      }
+      t->ResetBranchAddresses();
+      delete v;
+   }
+
+   RemoveFile(fname);
+}
+
 TEST(TBufferMerger, CheckTreeFillResults)
 {
    int sum_s, sum_p;
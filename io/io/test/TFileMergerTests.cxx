@@ -2,9 +2,15 @@
 
 #include "TFileMerger.h"
 
+#include "TKey.h"
 #include "TMemFile.h"
 #include "TTree.h"
 #include "TH1.h"
+#include "TROOT.h"
+
+#include <memory>
+#include <string>
+#include <vector>
 
 static void CreateATuple(TMemFile &file, const char *name, double value)
 {
@@ -101,3 +107,122 @@ TEST(TFileMerger, MergeSingleOnlyListed)
    ASSERT_TRUE(output.get() && output->GetListOfKeys());
    EXPECT_EQ(output->GetListOfKeys()->GetSize(), 2);
 }
+
+TEST(TFileMerger, ParallelHistograms)
+{
+   ROOT::EnableImplicitMT(2);
+
+   constexpr int nFiles = 5;
+   std::vector<std::unique_ptr<TMemFile>> inputs;
+   for (int i = 0; i < nFiles; ++i) {
+      inputs.emplace_back(new TMemFile(("parallel_in" + std::to_string(i) + ".root").c_str(), "CREATE"));
+      // Only write the histograms, so that the merger has to read them back from the keys.
+      TH1F h1("h1", "h1", 4, 0, 4);
+      TH1F h2("h2", "h2", 4, 0, 4);
+      h1.SetDirectory(nullptr);
+      h2.SetDirectory(nullptr);
+      h1.Fill(i % 4);
+      h2.Fill(1, i + 1);
+      inputs.back()->WriteObject(&h1, "h1");
+      inputs.back()->WriteObject(&h2, "h2");
+   }
+
+   for (bool oneGo : {true, false}) {
+      TFileMerger merger(kFALSE, oneGo);
+      merger.SetParallel();
+      EXPECT_TRUE(merger.GetParallel());
+      ASSERT_TRUE(merger.OutputFile(std::unique_ptr<TMemFile>(new TMemFile("parallel_out.root", "CREATE"))));
+      for (auto &file : inputs)
+         merger.AddFile(file.get(), false);
+      ASSERT_TRUE(merger.PartialMerge());
+
+      auto output = merger.GetOutputFile();
+      auto h1 = output->Get<TH1>("h1");
+      auto h2 = output->Get<TH1>("h2");
+      ASSERT_TRUE(h1 && h2);
+      EXPECT_EQ(h1->GetEntries(), nFiles);
+      EXPECT_EQ(h1->GetBinContent(1), 2);
+      EXPECT_EQ(h1->GetBinContent(2), 1);
+      EXPECT_EQ(h2->GetBinContent(2), nFiles * (nFiles + 1) / 2);
+   }
+
+   ROOT::DisableImplicitMT();
+}
+
+TEST(TFileMerger, ParallelKeys)
+{
+   constexpr int nFiles = 4;
+   constexpr int nHistos = 10;
+   constexpr int nEntries = 1000;
+   std::vector<std::unique_ptr<TMemFile>> inputs;
+   for (int i = 0; i < nFiles; ++i) {
+      inputs.emplace_back(new TMemFile(("parallelkeys_in" + std::to_string(i) + ".root").c_str(), "CREATE"));
+      for (int j = 0; j < nHistos; ++j) {
+         TH1F h("h", "h", 4, 0, 4);
+         h.SetDirectory(nullptr);
+         h.Fill(j % 4, i + 1);
+         inputs.back()->WriteObject(&h, ("h" + std::to_string(j)).c_str());
+      }
+      auto sub = inputs.back()->mkdir("sub");
+      TH1F hs("hs", "hs", 4, 0, 4);
+      hs.SetDirectory(nullptr);
+      hs.Fill(3);
+      sub->WriteObject(&hs, "hs");
+
+      auto tree = new TTree("t", "t");
+      // See CreateATuple.
+      tree->SetImplicitMT(false);
+      tree->SetDirectory(inputs.back().get());
+      double x = 0;
+      tree->Branch("x", &x, 1000);
+      for (int e = 0; e < nEntries; ++e) {
+         x = i * nEntries + e;
+         tree->Fill();
+      }
+      inputs.back()->Write();
+      tree->ResetBranchAddresses();
+   }
+
+   // The output is not compressed, so that the baskets of the tree are recompressed.
+   auto merge = [&](bool parallel) {
+      TFileMerger merger(kFALSE, kFALSE);
+      merger.SetParallel(parallel);
+      merger.OutputFile(std::unique_ptr<TMemFile>(new TMemFile("parallelkeys_out.root", "CREATE", "", 0)));
+      for (auto &file : inputs)
+         merger.AddFile(file.get(), false);
+      EXPECT_TRUE(merger.HasCompressionChange());
+      EXPECT_TRUE(merger.PartialMerge());
+      std::vector<std::string> names;
+      auto output = merger.GetOutputFile();
+      for (auto key : TRangeDynCast<TKey>(output->GetListOfKeys()))
+         names.emplace_back(key->GetName());
+      for (int j = 0; j < nHistos; ++j) {
+         auto h = output->Get<TH1>(("h" + std::to_string(j)).c_str());
+         EXPECT_TRUE(h != nullptr);
+         if (h)
+            EXPECT_EQ(h->GetBinContent(j % 4 + 1), nFiles * (nFiles + 1) / 2);
+      }
+      auto hs = output->Get<TH1>("sub/hs");
+      EXPECT_TRUE(hs != nullptr);
+      if (hs)
+         EXPECT_EQ(hs->GetBinContent(4), nFiles);
+      auto tree = output->Get<TTree>("t");
+      EXPECT_TRUE(tree != nullptr);
+      if (tree) {
+         EXPECT_EQ(tree->GetEntries(), nFiles * nEntries);
+         double x = -1;
+         tree->SetBranchAddress("x", &x);
+         for (Long64_t e = 0; e < tree->GetEntries(); ++e) {
+            tree->GetEntry(e);
+            EXPECT_EQ(x, e);
+         }
+         tree->ResetBranchAddresses();
+      }
+      return names;
+   };
+
+   const auto serialNames = merge(false);
+   ROOT::EnableImplicitMT(2);
+   EXPECT_EQ(merge(true), serialNames);
+   ROOT::DisableImplicitMT();
+}
@@ -1,4 +1,6 @@
 #include <memory>
+#include <numeric>
+#include <string>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -89,6 +91,47 @@ TEST(TFile, ReadFromSameFile)
    EXPECT_TRUE(o1 != o2) << "Same objects read from two different files have the same pointer!";
 }
 
+TEST(TFile, ReadBuffersScattered)
+{
+   const auto filename = "tfile_readbuffers_scattered.root";
+   {
+      TFile f{filename, "RECREATE", "", 0 /*no compression*/};
+      for (int i = 0; i < 50; ++i) {
+         std::vector<int> v(1000 * (i % 7 + 1), i);
+         f.WriteObject(&v, ("v" + std::to_string(i)).c_str());
+      }
+   }
+
+   TFile f{filename};
+   ASSERT_FALSE(f.IsZombie());
+   // Adjacent, gapped, far apart and larger-than-readahead blocks, in file order
+   const Long64_t end = f.GetEND();
+   std::vector<Long64_t> pos{100, 150, 170, 1000, 5000, 20000, 20100, end - 300000, end - 1000};
+   std::vector<Int_t> len{50, 20, 30, 1000, 3000, 100, 400, 290000, 900};
+   const Int_t oldReadahead = TFile::GetReadaheadSize();
+   TFile::SetReadaheadSize(16000);
+
+   const auto total = std::accumulate(len.begin(), len.end(), 0);
+   std::vector<char> vectored(total);
+   EXPECT_FALSE(f.ReadBuffers(vectored.data(), pos.data(), len.data(), pos.size()));
+   EXPECT_GE(f.GetBytesRead(), total);
+
+   std::vector<char> blockwise(total);
+   Long64_t k = 0;
+   for (std::size_t i = 0; i < pos.size(); ++i) {
+      EXPECT_FALSE(f.ReadBuffer(&blockwise[k], pos[i], len[i]));
+      k += len[i];
+   }
+   EXPECT_EQ(vectored, blockwise);
+
+   // Reading past the end of the file fails
+   pos.back() = end + 10;
+   EXPECT_TRUE(f.ReadBuffers(vectored.data(), pos.data(), len.data(), pos.size()));
+
+   TFile::SetReadaheadSize(oldReadahead);
+   gSystem->Unlink(filename);
+}
+
 TEST(TFile, ReadWithoutGlobalRegistrationLocal)
 {
    const auto localFile = "TFileTestReadWithoutGlobalRegistrationLocal.root";
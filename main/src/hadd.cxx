@@ -28,6 +28,7 @@
   \param -T   Do not merge Trees
   \param -v   Explicitly set the verbosity level: 0 request no output, 99 is the default
   \param -j   Parallelise the execution in `J` processes. If the number of processes is not specified, use the system maximum.
+  \param -threads Merge the objects of the input files on `N` threads (implicit multi-threading). If the number of threads is not specified, use the system maximum. Not combined with -j.
   \param -dbg Enable verbosity. If -j was specified, do not not delete partial files stored inside working directory.
   \param -d   Carry out the partial multiprocess execution in the specified directory
   \param -n   Open at most `N` files at once (use 0 to request to use the system maximum)
@@ -99,6 +100,7 @@
 #include "THashList.h"
 #include "TKey.h"
 #include "TClass.h"
+#include "TROOT.h"
 #include "TSystem.h"
 #include "TUUID.h"
 #include "ROOT/StringConv.hxx"
@@ -135,6 +137,8 @@ int main( int argc, char **argv )
    Bool_t keepCompressionAsIs = kFALSE;
    Bool_t useFirstInputCompression = kFALSE;
    Bool_t multiproc = kFALSE;
+   Bool_t multithread = kFALSE;
+   UInt_t nThreads = 0;
    Bool_t debug = kFALSE;
    Int_t maxopenedfiles = 0;
    Int_t verbosity = 99;
@@ -209,6 +213,23 @@ int main( int argc, char **argv )
          }
          multiproc = kTRUE;
          ++ffirst;
+      } else if (strcmp(argv[a], "-threads") == 0) {
+         // If the number of threads is not specified, use the system maximum.
+         // The next argument is only taken as the number of threads if it is a number,
+         // since it may as well be the target file.
+         if (a + 1 != argc && argv[a + 1][0] != '\0' && strspn(argv[a + 1], "0123456789") == strlen(argv[a + 1])) {
+            Long_t request = strtol(argv[a + 1], 0, 10);
+            if (request < kMaxInt && request >= 0) {
+               nThreads = (UInt_t)request;
+               ++a;
+               ++ffirst;
+            } else {
+               std::cerr << "Error: could not parse the number of threads passed after -threads: " << argv[a + 1]
+                         << ". We will use the system maximum.\n";
+            }
+         }
+         multithread = kTRUE;
+         ++ffirst;
       } else if ( strcmp(argv[a],"-cachesize=") == 0 ) {
          int size;
          static const size_t arglen = strlen("-cachesize=");
@@ -459,6 +480,18 @@ int main( int argc, char **argv )
    if (nProcesses == 1)
       multiproc = kFALSE;
 
+   if (multithread) {
+      if (multiproc) {
+         // The thread pool would have to be created after forking the processes.
+         std::cerr << "hadd: -threads is ignored together with -j" << std::endl;
+         multithread = kFALSE;
+      } else {
+         ROOT::EnableImplicitMT(nThreads);
+         if (verbosity > 1)
+            std::cout << "hadd merging with " << ROOT::GetThreadPoolSize() << " threads" << std::endl;
+      }
+   }
+
    std::vector<std::string> partialFiles;
 
 #ifndef R__WIN32
@@ -487,6 +520,7 @@ int main( int argc, char **argv )
          }
       }
       merger.SetNotrees(noTrees);
+      merger.SetParallel(multithread);
       merger.SetMergeOptions(cacheSize);
       merger.SetIOFeatures(features);
       Bool_t status;
@@ -88,6 +88,8 @@
 
 
 #pragma link C++ class TStatistic+;
+#pragma link C++ class TQuantileSketch+;
+#pragma link C++ class THyperLogLog+;
 
 
 #pragma link C++ class TKDTree<Int_t, Double_t>+;
@@ -24,6 +24,7 @@
 
 #include <cassert>
 #include <string>
+#include <vector>
 
 /**
    @defgroup ParamFunc Parametric Function Evaluation Interfaces.
@@ -130,6 +131,33 @@ namespace ROOT {
             return DoEval(x);
          }
 
+         /**
+         Evaluate the function at n points for the given parameters p, writing the values in result.
+         The coordinates are passed per dimension: x[j][i] is the j-th coordinate of the i-th point,
+         as in the ROOT::Fit::FitData classes.
+         Use the virtual function DoEvalParBatch to re-implement it
+         */
+         void EvalParBatch(unsigned int n, const T *const *x, const double *p, T *result) const
+         {
+            DoEvalParBatch(n, x, p, result);
+         }
+
+      protected:
+         /**
+            Implementation of the batch evaluation. The default calls DoEvalPar for each point;
+            derived classes which can evaluate many points at once should re-implement it
+         */
+         virtual void DoEvalParBatch(unsigned int n, const T *const *x, const double *p, T *result) const
+         {
+            const unsigned int ndim = this->NDim();
+            std::vector<T> point(ndim);
+            for (unsigned int i = 0; i < n; ++i) {
+               for (unsigned int j = 0; j < ndim; ++j)
+                  point[j] = x[j][i];
+               result[i] = DoEvalPar(point.data(), p);
+            }
+         }
+
       private:
          /**
             Implementation of the evaluation function using the x values and the parameters.
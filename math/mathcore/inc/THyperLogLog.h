@@ -0,0 +1,72 @@
+// @(#)root/mathcore:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_THyperLogLog
+#define ROOT_THyperLogLog
+
+
+//////////////////////////////////////////////////////////////////////////
+//                                                                      //
+// THyperLogLog                                                         //
+//                                                                      //
+// Approximate number of distinct values of a stream in fixed memory.   //
+// Named, streamable, storable and mergeable.                           //
+//                                                                      //
+//////////////////////////////////////////////////////////////////////////
+
+#include "TObject.h"
+
+#include "TString.h"
+
+#include <string>
+#include <vector>
+
+class TCollection;
+
+class THyperLogLog : public TObject {
+
+private:
+   TString     fName;       ///< Name given to the THyperLogLog object
+   Int_t       fPrecision;  ///< Number of hash bits selecting the register
+   Long64_t    fN;          ///< Number of fills
+   std::vector<UChar_t> fRegisters; ///< Largest number of leading zeros + 1 seen by each register
+
+public:
+
+   THyperLogLog(const char *name = "", Int_t precision = 14);
+   ~THyperLogLog() override;
+
+   // Getters
+   const char    *GetName() const override { return fName; }
+   ULong_t        Hash() const override { return fName.Hash(); }
+
+   inline       Long64_t GetN() const { return fN; }
+   inline       Int_t    GetPrecision() const { return fPrecision; }
+   Double_t     GetCount() const;
+   Double_t     GetRelativeError() const;
+
+   // Merging
+   void  Add(const THyperLogLog &other);
+   Int_t Merge(TCollection *in);
+
+   // Fill
+   void Fill(Double_t val);
+   void Fill(const std::string &val);
+   void FillHash(ULong64_t hash);
+   void Reset();
+
+   // Print
+   void Print(Option_t * = "") const override;
+   void ls(Option_t *opt = "") const override { Print(opt); }
+
+   ClassDefOverride(THyperLogLog,1)  // Mergeable approximate distinct count
+};
+
+#endif
@@ -48,9 +48,11 @@ public:
    Index   GetBucketSize() {return fBucketSize;}
 
    void    FindNearestNeighbors(const Value *point, Int_t k, Index *ind, Value *dist);
+   void    FindNearestNeighbors(Index nQueries, const Value *points, Int_t k, Index *ind, Value *dist);
    Index   FindNode(const Value * point) const;
    void    FindPoint(Value * point, Index &index, Int_t &iter);
    void    FindInRange(Value *point, Value range, std::vector<Index> &res);
+   void    FindInRange(Index nQueries, const Value *points, Value range, std::vector<std::vector<Index>> &res);
    void    FindBNodeA(Value * point, Value * delta, Int_t &inode);
 
    Bool_t  IsTerminal(Index inode) const {return (inode>=fNNodes);}
@@ -69,9 +71,16 @@ public:
    TKDTree(const TKDTree &); // not implemented
    TKDTree<Index, Value>& operator=(const TKDTree<Index, Value>&); // not implemented
    void CookBoundaries(const Int_t node, Bool_t left);
-
+   void BuildNodes(Int_t node, Int_t row, Int_t pos, Int_t npoints, Int_t stopRow, std::vector<Int_t> *subtrees);
+
+   /// Coordinate idim of the point at position ipos of fIndPoints
+   Value PointCoordinate(Index ipos, Index idim) const
+   {
+      return fPoints.empty() ? fData[idim][fIndPoints[ipos]] : fPoints[ipos * fNDim + idim];
+   }
+   Double_t DistanceToPosition(const Value *point, Index ipos) const;
    void UpdateNearestNeighbors(Index inode, const Value *point, Int_t kNN, Index *ind, Value *dist);
-   void UpdateRange(Index inode, Value *point, Value range, std::vector<Index> &res);
+   void UpdateRange(Index inode, const Value *point, Value range, std::vector<Index> &res);
 
  protected:
    Int_t   fDataOwner;  ///<! 0 - not owner, 2 - owner of the pointer array, 1 - owner of the whole 2-d array
@@ -89,15 +98,16 @@ public:
    Value   *fBoundaries;///<! nodes boundaries
 
 
-   Index   *fIndPoints; ///<! array of points indexes
-   Int_t   fRowT0;      ///<! smallest terminal row - first row that contains terminal nodes
-   Int_t   fCrossNode;  ///<! cross node - node that begins the last row (with terminal nodes only)
-   Int_t   fOffset;     ///<! offset in fIndPoints - if there are 2 rows, that contain terminal nodes
+   Index   *fIndPoints; ///<[fNPoints] array of points indexes
+   Int_t   fRowT0;      ///< smallest terminal row - first row that contains terminal nodes
+   Int_t   fCrossNode;  ///< cross node - node that begins the last row (with terminal nodes only)
+   Int_t   fOffset;     ///< offset in fIndPoints - if there are 2 rows, that contain terminal nodes
                         ///<  fOffset returns the index in the fIndPoints array of the first point
                         ///<  that belongs to the first node on the second row.
+   std::vector<Value> fPoints; ///< point coordinates, point by point in the order of fIndPoints
 
 
-   ClassDefOverride(TKDTree, 1)  // KD tree
+   ClassDefOverride(TKDTree, 2)  // KD tree
 };
 
 
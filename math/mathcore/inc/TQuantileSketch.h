@@ -0,0 +1,88 @@
+// @(#)root/mathcore:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TQuantileSketch
+#define ROOT_TQuantileSketch
+
+
+//////////////////////////////////////////////////////////////////////////
+//                                                                      //
+// TQuantileSketch                                                      //
+//                                                                      //
+// Approximate quantiles of a stream of values in bounded memory (KLL   //
+// sketch). Named, streamable, storable and mergeable.                  //
+//                                                                      //
+//////////////////////////////////////////////////////////////////////////
+
+#include "TObject.h"
+
+#include "TMath.h"
+
+#include "TString.h"
+
+#include <utility>
+#include <vector>
+
+class TCollection;
+
+class TQuantileSketch : public TObject {
+
+private:
+   TString     fName;       ///< Name given to the TQuantileSketch object
+   Int_t       fK;          ///< Accuracy parameter: capacity of the top compactor
+   Long64_t    fN;          ///< Number of fills
+   Double_t    fMin;        ///< Minimum value filled
+   Double_t    fMax;        ///< Maximum value filled
+   ULong64_t   fSeed;       ///< State of the generator choosing the items kept by a compaction
+   std::vector<std::vector<Double_t>> fCompactors; ///< Retained items; those at level h stand for 2^h values
+   Long64_t    fSize = -1;    ///<! Number of retained items, -1 if not computed yet
+   Long64_t    fMaxSize = 0;  ///<! Number of retained items triggering a compression
+
+   Int_t    GetCapacity(Int_t level) const;
+   void     UpdateSize();
+   void     Compress();
+   void     AddLevel();
+   std::vector<std::pair<Double_t, Long64_t>> GetWeightedItems() const;
+
+public:
+
+   TQuantileSketch(const char *name = "", Int_t k = 200);
+   ~TQuantileSketch() override;
+
+   // Getters
+   const char    *GetName() const override { return fName; }
+   ULong_t        Hash() const override { return fName.Hash(); }
+
+   inline       Long64_t GetN() const { return fN; }
+   inline       Int_t    GetK() const { return fK; }
+   inline       Double_t GetMin() const { return fMin; }
+   inline       Double_t GetMax() const { return fMax; }
+   Long64_t     GetNRetained() const;
+   Double_t     GetNormalizedRankError() const;
+   Double_t     GetQuantile(Double_t prob) const;
+   Int_t        GetQuantiles(Int_t nprob, Double_t *q, const Double_t *prob = nullptr) const;
+   Double_t     GetRank(Double_t x) const;
+
+   // Merging
+   void  Add(const TQuantileSketch &other);
+   Int_t Merge(TCollection *in);
+
+   // Fill
+   void Fill(Double_t val);
+   void Reset();
+
+   // Print
+   void Print(Option_t * = "") const override;
+   void ls(Option_t *opt = "") const override { Print(opt); }
+
+   ClassDefOverride(TQuantileSketch,1)  // Mergeable approximate quantiles
+};
+
+#endif
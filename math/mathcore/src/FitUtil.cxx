@@ -213,6 +213,85 @@ namespace ROOT {
             }
          }
 
+         // number of points in the blocks used to sum the contributions of the data points to the
+         // objective functions and their gradients. The blocks and the order in which their partial sums
+         // are added do not depend on the execution policy or on the number of threads, so the results
+         // are identical for sequential and multi-threaded evaluations
+         constexpr unsigned int kReductionBlockSize = 1024;
+
+         // sum nComp quantities over the n data points and store the results in result.
+         // blockFunction(begin, end, sums) must add the contributions of the points in [begin, end)
+         // to the nComp compensated sums. The blocks are processed in parallel in case of
+         // multi-threaded execution policy, and their partial sums are then added in block order
+         template <class BlockFunction>
+         void ReduceBlocks(unsigned int n, unsigned int nComp, const BlockFunction &blockFunction, double *result,
+                           ROOT::EExecutionPolicy executionPolicy, unsigned nChunks)
+         {
+            const unsigned int nBlocks = (n + kReductionBlockSize - 1) / kReductionBlockSize;
+            std::vector<ROOT::Math::KahanSum<double>> partialSums(std::size_t(nBlocks) * nComp);
+
+            auto processBlock = [&](unsigned int block) {
+               const unsigned int begin = block * kReductionBlockSize;
+               const unsigned int end = std::min(n, begin + kReductionBlockSize);
+               blockFunction(begin, end, &partialSums[std::size_t(block) * nComp]);
+            };
+
+#ifdef R__USE_IMT
+            if (executionPolicy == ROOT::EExecutionPolicy::kMultiThread && nBlocks > 1) {
+               ROOT::TThreadExecutor pool;
+               pool.Foreach(processBlock, ROOT::TSeq<unsigned>(0, nBlocks), std::min(nChunks, nBlocks));
+            } else
+#else
+            (void)executionPolicy;
+            (void)nChunks;
+#endif
+            {
+               for (unsigned int block = 0; block < nBlocks; ++block)
+                  processBlock(block);
+            }
+
+            for (unsigned int k = 0; k < nComp; ++k) {
+               ROOT::Math::KahanSum<double> sum;
+               for (unsigned int block = 0; block < nBlocks; ++block)
+                  sum += partialSums[std::size_t(block) * nComp + k];
+               result[k] = sum.Sum();
+            }
+         }
+
+         // evaluate the model function with one batch call at the points [begin, end) of the data.
+         // In case of bin volume the function is evaluated at the bin centers and multiplied by the
+         // bin volume normalized with wrefVolume, as it is done point by point in the objective functions
+         static void EvaluateModelBatch(const IModelFunction &func, const BinData &data, const double *p,
+                                        unsigned int begin, unsigned int end, bool useBinVolume, double wrefVolume,
+                                        double *fval)
+         {
+            const unsigned int ndim = data.NDim();
+            const unsigned int nPoints = end - begin;
+            std::vector<const double *> x(ndim);
+            if (!useBinVolume) {
+               for (unsigned int j = 0; j < ndim; ++j)
+                  x[j] = data.GetCoordComponent(begin, j);
+               func.EvalParBatch(nPoints, x.data(), p, fval);
+               return;
+            }
+
+            std::vector<double> centers(std::size_t(ndim) * nPoints);
+            std::vector<double> binVolume(nPoints, 1.0);
+            for (unsigned int j = 0; j < ndim; ++j) {
+               double *xc = &centers[std::size_t(j) * nPoints];
+               for (unsigned int i = 0; i < nPoints; ++i) {
+                  double x1_j = *data.GetCoordComponent(begin + i, j);
+                  double x2_j = data.GetBinUpEdgeComponent(begin + i, j);
+                  binVolume[i] *= std::abs(x2_j - x1_j);
+                  xc[i] = 0.5 * (x2_j + x1_j);
+               }
+               x[j] = xc;
+            }
+            func.EvalParBatch(nPoints, x.data(), p, fval);
+            for (unsigned int i = 0; i < nPoints; ++i)
+               fval[i] *= binVolume[i] * wrefVolume;
+         }
+
 
 
       } // end namespace  FitUtil
@@ -276,16 +355,9 @@ double FitUtil::EvaluateChi2(const IModelFunction &func, const BinData &data, co
 
    (const_cast<IModelFunction &>(func)).SetParameters(p);
 
-   auto mapFunction = [&](const unsigned i){
-
-      double chi2{};
-      double fval{};
-
+   // evaluate the model function for the point i, used when the integral of the bins is requested
+   auto evalFunction = [&](const unsigned i) {
       const auto x1 = data.GetCoordComponent(i, 0);
-      const auto y = data.Value(i);
-      auto invError = data.InvError(i);
-
-      //invError = (invError!= 0.0) ? 1.0/invError :1;
 
       const double * x = nullptr;
       std::vector<double> xc;
@@ -315,7 +387,7 @@ double FitUtil::EvaluateChi2(const IModelFunction &func, const BinData &data, co
             x = x1;
       }
 
-
+      double fval{};
       if (!useBinIntegral) {
 #ifdef USE_PARAMCACHE
          fval = func ( x );
@@ -333,6 +405,16 @@ double FitUtil::EvaluateChi2(const IModelFunction &func, const BinData &data, co
       // normalize result if requested according to bin volume
       // we need to multiply by the bin volume (e.g. for variable bins histograms)
       if (useBinVolume) fval *= binVolume;
+      return fval;
+   };
+
+   // chi2 contribution of the point i given the function value fval
+   auto mapFunction = [&](const unsigned i, double fval){
+
+      double chi2{};
+
+      const auto y = data.Value(i);
+      auto invError = data.InvError(i);
 
       // expected errors
       if (useExpErrors) {
@@ -355,10 +437,10 @@ double FitUtil::EvaluateChi2(const IModelFunction &func, const BinData &data, co
       }
 
 #ifdef DEBUG
-      std::cout << x[0] << "  " << y << "  " << 1./invError << " params : ";
+      std::cout << *data.GetCoordComponent(i, 0) << "  " << y << "  " << 1./invError << " params : ";
       for (unsigned int ipar = 0; ipar < func.NPar(); ++ipar)
          std::cout << p[ipar] << "\t";
-      std::cout << "\tfval = " << fval << " bin volume " << binVolume << " ref " << wrefVolume << std::endl;
+      std::cout << "\tfval = " << fval << " ref " << wrefVolume << std::endl;
 #endif
 
       if (invError > 0) {
@@ -378,13 +460,21 @@ double FitUtil::EvaluateChi2(const IModelFunction &func, const BinData &data, co
       return chi2;
   };
 
-#ifdef R__USE_IMT
-  auto redFunction = [](const std::vector<double> & objs){
-                          return std::accumulate(objs.begin(), objs.end(), double{});
+  // the function values of a block of points are computed with a single batch call of the model
+  // function, apart when using the bin integrals which are computed point by point
+  auto blockFunction = [&](unsigned int begin, unsigned int end, ROOT::Math::KahanSum<double> *sums) {
+     std::vector<double> fval(end - begin);
+     if (useBinIntegral) {
+        for (unsigned int i = begin; i < end; ++i)
+           fval[i - begin] = evalFunction(i);
+     } else {
+        EvaluateModelBatch(func, data, p, begin, end, useBinVolume, wrefVolume, fval.data());
+     }
+     for (unsigned int i = begin; i < end; ++i)
+        sums[0].Add(mapFunction(i, fval[i - begin]));
   };
-#else
-  (void)nChunks;
 
+#ifndef R__USE_IMT
   // If IMT is disabled, force the execution policy to the serial case
   if (executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
      Warning("FitUtil::EvaluateChi2", "Multithread execution policy requires IMT, which is disabled. Changing "
@@ -394,19 +484,9 @@ double FitUtil::EvaluateChi2(const IModelFunction &func, const BinData &data, co
 #endif
 
   double res{};
-  if(executionPolicy == ROOT::EExecutionPolicy::kSequential){
-    for (unsigned int i=0; i<n; ++i) {
-      res += mapFunction(i);
-    }
-#ifdef R__USE_IMT
-  } else if(executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
-    ROOT::TThreadExecutor pool;
-    auto chunks = nChunks !=0? nChunks: setAutomaticChunking(data.Size());
-    res = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, n), redFunction, chunks);
-#endif
-//   } else if(executionPolicy == ROOT::Fit::kMultitProcess){
-    // ROOT::TProcessExecutor pool;
-    // res = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, n), redFunction);
+  if (executionPolicy == ROOT::EExecutionPolicy::kSequential ||
+      executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
+     ReduceBlocks(n, 1, blockFunction, &res, executionPolicy, nChunks);
   } else{
     Error("FitUtil::EvaluateChi2","Execution policy unknown. Available choices:\n ROOT::EExecutionPolicy::kSequential (default)\n ROOT::EExecutionPolicy::kMultiThread (requires IMT)\n");
   }
@@ -715,12 +795,13 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
    unsigned int npar = func.NPar();
    unsigned initialNPoints = data.Size();
 
-   std::vector<bool> isPointRejected(initialNPoints);
+   // not a std::vector<bool>, whose elements cannot be written concurrently
+   std::vector<char> isPointRejected(initialNPoints);
 
-   auto mapFunction = [&](const unsigned int i) {
+   auto mapFunction = [&](const unsigned int i, double *gradFunc, double *pointContribution) {
       // set all vector values to zero
-      std::vector<double> gradFunc(npar);
-      std::vector<double> pointContribution(npar);
+      std::fill(gradFunc, gradFunc + npar, 0.);
+      std::fill(pointContribution, pointContribution + npar, 0.);
 
       const auto x1 = data.GetCoordComponent(i, 0);
       const auto y = data.Value(i);
@@ -760,14 +841,14 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
 
       if (!useBinIntegral) {
          fval = func(x, p);
-         func.ParameterGradient(x, p, &gradFunc[0]);
+         func.ParameterGradient(x, p, gradFunc);
       } else {
          std::vector<double> x2(data.NDim());
          data.GetBinUpEdgeCoordinates(i, x2.data());
          // calculate normalized integral and gradient (divided by bin volume)
          // need to set function and parameters here in case loop is parallelized
          fval = igEval(x, x2.data());
-         CalculateGradientIntegral(func, x, x2.data(), p, &gradFunc[0]);
+         CalculateGradientIntegral(func, x, x2.data(), p, gradFunc);
       }
       if (useBinVolume)
          fval *= binVolume;
@@ -781,7 +862,7 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
       if (!CheckInfNaNValue(fval)) {
          isPointRejected[i] = true;
          // Return a zero contribution to all partial derivatives on behalf of the current point
-         return pointContribution;
+         return;
       }
 
       // loop on the parameters
@@ -808,19 +889,18 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
          isPointRejected[i] = true;
       }
 
-      return pointContribution;
+      return;
    };
 
-   // Vertically reduce the set of vectors by summing its equally-indexed components
-   auto redFunction = [&](const std::vector<std::vector<double>> &pointContributions) {
-      std::vector<double> result(npar);
-
-      for (auto const &pointContribution : pointContributions) {
-         for (unsigned int parameterIndex = 0; parameterIndex < npar; parameterIndex++)
-            result[parameterIndex] += pointContribution[parameterIndex];
+   // sum the contributions of the points of each block, reusing the same buffers for all points
+   auto blockFunction = [&](unsigned int begin, unsigned int end, ROOT::Math::KahanSum<double> *sums) {
+      std::vector<double> gradFunc(npar);
+      std::vector<double> pointContribution(npar);
+      for (unsigned int i = begin; i < end; ++i) {
+         mapFunction(i, gradFunc.data(), pointContribution.data());
+         for (unsigned int ipar = 0; ipar < npar; ++ipar)
+            sums[ipar].Add(pointContribution[ipar]);
       }
-
-      return result;
    };
 
    std::vector<double> g(npar);
@@ -834,38 +914,19 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
    }
 #endif
 
-   if (executionPolicy == ROOT::EExecutionPolicy::kSequential) {
-      std::vector<std::vector<double>> allGradients(initialNPoints);
-      for (unsigned int i = 0; i < initialNPoints; ++i) {
-         allGradients[i] = mapFunction(i);
-      }
-      g = redFunction(allGradients);
-   }
-#ifdef R__USE_IMT
-   else if (executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
-      ROOT::TThreadExecutor pool;
-      auto chunks = nChunks != 0 ? nChunks : setAutomaticChunking(initialNPoints);
-      g = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, initialNPoints), redFunction, chunks);
-   }
-#endif
-   // else if(executionPolicy == ROOT::Fit::kMultiprocess){
-   //    ROOT::TProcessExecutor pool;
-   //    g = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, n), redFunction);
-   // }
-   else {
-      Error("FitUtil::EvaluateChi2Gradient",
-            "Execution policy unknown. Available choices:\n 0: Serial (default)\n 1: MultiThread (requires IMT)\n");
+   if (executionPolicy == ROOT::EExecutionPolicy::kSequential ||
+       executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
+      ReduceBlocks(initialNPoints, npar, blockFunction, g.data(), executionPolicy, nChunks);
+   } else {
+      Error("FitUtil::EvaluateChi2Gradient", "Execution policy unknown. Available choices:\n "
+                                             "ROOT::EExecutionPolicy::kSequential (default)\n "
+                                             "ROOT::EExecutionPolicy::kMultiThread (requires IMT)\n");
    }
 
-#ifndef R__USE_IMT
-   //to fix compiler warning
-   (void)nChunks;
-#endif
-
    // correct the number of points
    nPoints = initialNPoints;
 
-   if (std::any_of(isPointRejected.begin(), isPointRejected.end(), [](bool point) { return point; })) {
+   if (std::any_of(isPointRejected.begin(), isPointRejected.end(), [](char point) { return point != 0; })) {
       unsigned nRejected = std::accumulate(isPointRejected.begin(), isPointRejected.end(), 0);
       assert(nRejected <= initialNPoints);
       nPoints = initialNPoints - nRejected;
@@ -1000,31 +1061,9 @@ double FitUtil::EvaluateLogL(const IModelFunction &func, const UnBinData &data,
 
          // needed to compute effective global weight in case of extended likelihood
 
-         auto mapFunction = [&](const unsigned i) {
-            double W = 0;
-            double W2 = 0;
-            double fval = 0;
-
-            if (data.NDim() > 1) {
-               std::vector<double> x(data.NDim());
-               for (unsigned int j = 0; j < data.NDim(); ++j)
-                  x[j] = *data.GetCoordComponent(i, j);
-#ifdef USE_PARAMCACHE
-               fval = func(x.data());
-#else
-               fval = func(x.data(), p);
-#endif
-
-               // one -dim case
-            } else {
-               const auto x = data.GetCoordComponent(i, 0);
-#ifdef USE_PARAMCACHE
-               fval = func(x);
-#else
-               fval = func(x, p);
-#endif
-            }
-
+         // log-likelihood contribution of the point i given the function value fval:
+         // the log of the function value and the weight and the squared weight of the point
+         auto mapFunction = [&](const unsigned i, double fval, ROOT::Math::KahanSum<double> *sums) {
             if (normalizeFunc)
                fval = fval * (1 / norm);
 
@@ -1037,32 +1076,26 @@ double FitUtil::EvaluateLogL(const IModelFunction &func, const UnBinData &data,
                   logval *= weight; // use square of weights in likelihood
                   if (!extended) {
                      // needed sum of weights and sum of weight square if likelkihood is extended
-                     W = weight;
-                     W2 = weight * weight;
+                     sums[1].Add(weight);
+                     sums[2].Add(weight * weight);
                   }
                }
             }
-            return LikelihoodAux<double>(logval, W, W2);
+            sums[0].Add(logval);
          };
 
-#ifdef R__USE_IMT
-  // auto redFunction = [](const std::vector<LikelihoodAux<double>> & objs){
-  //          return std::accumulate(objs.begin(), objs.end(), LikelihoodAux<double>(0.0,0.0,0.0),
-  //                      [](const LikelihoodAux<double> &l1, const LikelihoodAux<double> &l2){
-  //                          return l1+l2;
-  //                 });
-  // };
-  // do not use std::accumulate to be sure to maintain always the same order
-  auto redFunction = [](const std::vector<LikelihoodAux<double>> & objs){
-     auto l0 =  LikelihoodAux<double>(0.0,0.0,0.0);
-     for ( auto & l : objs ) {
-        l0 = l0 + l;
-     }
-     return l0;
-  };
-#else
-  (void)nChunks;
+         // the function values of a block of points are computed with a single batch call of the model function
+         auto blockFunction = [&](unsigned int begin, unsigned int end, ROOT::Math::KahanSum<double> *sums) {
+            std::vector<double> fval(end - begin);
+            std::vector<const double *> x(data.NDim());
+            for (unsigned int j = 0; j < data.NDim(); ++j)
+               x[j] = data.GetCoordComponent(begin, j);
+            func.EvalParBatch(end - begin, x.data(), p, fval.data());
+            for (unsigned int i = begin; i < end; ++i)
+               mapFunction(i, fval[i - begin], sums);
+         };
 
+#ifndef R__USE_IMT
   // If IMT is disabled, force the execution policy to the serial case
   if (executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
      Warning("FitUtil::EvaluateLogL", "Multithread execution policy requires IMT, which is disabled. Changing "
@@ -1071,31 +1104,17 @@ double FitUtil::EvaluateLogL(const IModelFunction &func, const UnBinData &data,
   }
 #endif
 
-  double logl{};
-  double sumW{};
-  double sumW2{};
-  if(executionPolicy == ROOT::EExecutionPolicy::kSequential){
-    for (unsigned int i=0; i<n; ++i) {
-      auto resArray = mapFunction(i);
-      logl+=resArray.logvalue;
-      sumW+=resArray.weight;
-      sumW2+=resArray.weight2;
-    }
-#ifdef R__USE_IMT
-  } else if(executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
-    ROOT::TThreadExecutor pool;
-    auto chunks = nChunks !=0? nChunks: setAutomaticChunking(data.Size());
-    auto resArray = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, n), redFunction, chunks);
-    logl=resArray.logvalue;
-    sumW=resArray.weight;
-    sumW2=resArray.weight2;
-#endif
-//   } else if(executionPolicy == ROOT::Fit::kMultiProcess){
-    // ROOT::TProcessExecutor pool;
-    // res = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, n), redFunction);
+  // sums of the log of the function values, of the weights and of the squared weights
+  double sums[3] = {0., 0., 0.};
+  if (executionPolicy == ROOT::EExecutionPolicy::kSequential ||
+      executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
+     ReduceBlocks(n, 3, blockFunction, sums, executionPolicy, nChunks);
   } else{
     Error("FitUtil::EvaluateLogL","Execution policy unknown. Available choices:\n ROOT::EExecutionPolicy::kSequential (default)\n ROOT::EExecutionPolicy::kMultiThread (requires IMT)\n");
   }
+  double logl = sums[0];
+  double sumW = sums[1];
+  double sumW2 = sums[2];
 
   if (extended) {
       // add Poisson extended term
@@ -1181,9 +1200,10 @@ void FitUtil::EvaluateLogLGradient(const IModelFunction &f, const UnBinData &dat
    const double kdmax1 = std::sqrt(std::numeric_limits<double>::max());
    const double kdmax2 = std::numeric_limits<double>::max() / (4 * initialNPoints);
 
-   auto mapFunction = [&](const unsigned int i) {
-      std::vector<double> gradFunc(npar);
-      std::vector<double> pointContribution(npar);
+   auto mapFunction = [&](const unsigned int i, double *gradFunc, double *pointContribution) {
+      // set all vector values to zero
+      std::fill(gradFunc, gradFunc + npar, 0.);
+      std::fill(pointContribution, pointContribution + npar, 0.);
 
 
       const double * x = nullptr;
@@ -1198,7 +1218,7 @@ void FitUtil::EvaluateLogLGradient(const IModelFunction &f, const UnBinData &dat
       }
 
       double fval = func(x, p);
-      func.ParameterGradient(x, p, &gradFunc[0]);
+      func.ParameterGradient(x, p, gradFunc);
 
 #ifdef DEBUG
       {
@@ -1225,19 +1245,18 @@ void FitUtil::EvaluateLogLGradient(const IModelFunction &f, const UnBinData &dat
          // if func derivative is zero term is also zero so do not add in g[kpar]
       }
 
-      return pointContribution;
+      return;
    };
 
-   // Vertically reduce the set of vectors by summing its equally-indexed components
-   auto redFunction = [&](const std::vector<std::vector<double>> &pointContributions) {
-      std::vector<double> result(npar);
-
-      for (auto const &pointContribution : pointContributions) {
-         for (unsigned int parameterIndex = 0; parameterIndex < npar; parameterIndex++)
-            result[parameterIndex] += pointContribution[parameterIndex];
+   // sum the contributions of the points of each block, reusing the same buffers for all points
+   auto blockFunction = [&](unsigned int begin, unsigned int end, ROOT::Math::KahanSum<double> *sums) {
+      std::vector<double> gradFunc(npar);
+      std::vector<double> pointContribution(npar);
+      for (unsigned int i = begin; i < end; ++i) {
+         mapFunction(i, gradFunc.data(), pointContribution.data());
+         for (unsigned int ipar = 0; ipar < npar; ++ipar)
+            sums[ipar].Add(pointContribution[ipar]);
       }
-
-      return result;
    };
 
    std::vector<double> g(npar);
@@ -1251,31 +1270,15 @@ void FitUtil::EvaluateLogLGradient(const IModelFunction &f, const UnBinData &dat
    }
 #endif
 
-   if (executionPolicy == ROOT::EExecutionPolicy::kSequential) {
-      std::vector<std::vector<double>> allGradients(initialNPoints);
-      for (unsigned int i = 0; i < initialNPoints; ++i) {
-         allGradients[i] = mapFunction(i);
-      }
-      g = redFunction(allGradients);
-   }
-#ifdef R__USE_IMT
-   else if (executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
-      ROOT::TThreadExecutor pool;
-      auto chunks = nChunks != 0 ? nChunks : setAutomaticChunking(initialNPoints);
-      g = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, initialNPoints), redFunction, chunks);
-   }
-#endif
-   else {
+   if (executionPolicy == ROOT::EExecutionPolicy::kSequential ||
+       executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
+      ReduceBlocks(initialNPoints, npar, blockFunction, g.data(), executionPolicy, nChunks);
+   } else {
       Error("FitUtil::EvaluateLogLGradient", "Execution policy unknown. Available choices:\n "
                                              "ROOT::EExecutionPolicy::kSequential (default)\n "
                                              "ROOT::EExecutionPolicy::kMultiThread (requires IMT)\n");
    }
 
-#ifndef R__USE_IMT
-   // to fix compiler warning
-   (void)nChunks;
-#endif
-
    // copy result
    std::copy(g.begin(), g.end(), grad);
    nPoints = data.Size();  // npoints
@@ -1493,9 +1496,9 @@ double FitUtil::EvaluatePoissonLogL(const IModelFunction &func, const BinData &d
    IntegralEvaluator<> igEval(func, p, useBinIntegral, igType);
 #endif
 
-   auto mapFunction = [&](const unsigned i) {
+   // evaluate the model function for the point i, used when the integral of the bins is requested
+   auto evalFunction = [&](const unsigned i) {
       auto x1 = data.GetCoordComponent(i, 0);
-      auto y = *data.ValuePtr(i);
 
       const double *x = nullptr;
       std::vector<double> xc;
@@ -1539,14 +1542,18 @@ double FitUtil::EvaluatePoissonLogL(const IModelFunction &func, const BinData &d
          fval = igEval(x, x2.data());
       }
       if (useBinVolume) fval *= binVolume;
+      return fval;
+   };
 
-
+   // negative log-likelihood contribution of the point i given the function value fval
+   auto mapFunction = [&](const unsigned i, double fval) {
+      auto y = *data.ValuePtr(i);
 
 #ifdef DEBUG
       int NSAMPLE = 100;
       if (i % NSAMPLE == 0) {
          std::cout << "evt " << i << " x = [ ";
-         for (unsigned int j = 0; j < func.NDim(); ++j) std::cout << x[j] << " , ";
+         for (unsigned int j = 0; j < func.NDim(); ++j) std::cout << *data.GetCoordComponent(i, j) << " , ";
          std::cout << "]  ";
          if (fitOpt.fIntegral) {
             std::cout << "x2 = [ ";
@@ -1605,13 +1612,21 @@ double FitUtil::EvaluatePoissonLogL(const IModelFunction &func, const BinData &d
       return nloglike;
    };
 
-#ifdef R__USE_IMT
-   auto redFunction = [](const std::vector<double> &objs) {
-      return std::accumulate(objs.begin(), objs.end(), double{});
+   // the function values of a block of points are computed with a single batch call of the model
+   // function, apart when using the bin integrals which are computed point by point
+   auto blockFunction = [&](unsigned int begin, unsigned int end, ROOT::Math::KahanSum<double> *sums) {
+      std::vector<double> fval(end - begin);
+      if (useBinIntegral) {
+         for (unsigned int i = begin; i < end; ++i)
+            fval[i - begin] = evalFunction(i);
+      } else {
+         EvaluateModelBatch(func, data, p, begin, end, useBinVolume, wrefVolume, fval.data());
+      }
+      for (unsigned int i = begin; i < end; ++i)
+         sums[0].Add(mapFunction(i, fval[i - begin]));
    };
-#else
-   (void)nChunks;
 
+#ifndef R__USE_IMT
    // If IMT is disabled, force the execution policy to the serial case
    if (executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
       Warning("FitUtil::EvaluatePoissonLogL", "Multithread execution policy requires IMT, which is disabled. Changing "
@@ -1621,19 +1636,9 @@ double FitUtil::EvaluatePoissonLogL(const IModelFunction &func, const BinData &d
 #endif
 
    double res{};
-   if (executionPolicy == ROOT::EExecutionPolicy::kSequential) {
-      for (unsigned int i = 0; i < n; ++i) {
-         res += mapFunction(i);
-      }
-#ifdef R__USE_IMT
-   } else if (executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
-      ROOT::TThreadExecutor pool;
-      auto chunks = nChunks != 0 ? nChunks : setAutomaticChunking(data.Size());
-      res = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, n), redFunction, chunks);
-#endif
-      //   } else if(executionPolicy == ROOT::Fit::kMultitProcess){
-      // ROOT::TProcessExecutor pool;
-      // res = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, n), redFunction);
+   if (executionPolicy == ROOT::EExecutionPolicy::kSequential ||
+       executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
+      ReduceBlocks(n, 1, blockFunction, &res, executionPolicy, nChunks);
    } else {
       Error("FitUtil::EvaluatePoissonLogL",
             "Execution policy unknown. Available choices:\n ROOT::EExecutionPolicy::kSequential (default)\n ROOT::EExecutionPolicy::kMultiThread (requires IMT)\n");
@@ -1679,10 +1684,10 @@ void FitUtil::EvaluatePoissonLogLGradient(const IModelFunction &f, const BinData
    unsigned int npar = func.NPar();
    unsigned initialNPoints = data.Size();
 
-   auto mapFunction = [&](const unsigned int i) {
+   auto mapFunction = [&](const unsigned int i, double *gradFunc, double *pointContribution) {
       // set all vector values to zero
-      std::vector<double> gradFunc(npar);
-      std::vector<double> pointContribution(npar);
+      std::fill(gradFunc, gradFunc + npar, 0.);
+      std::fill(pointContribution, pointContribution + npar, 0.);
 
       const auto x1 = data.GetCoordComponent(i, 0);
       const auto y = data.Value(i);
@@ -1724,14 +1729,14 @@ void FitUtil::EvaluatePoissonLogLGradient(const IModelFunction &f, const BinData
 
       if (!useBinIntegral) {
          fval = func(x, p);
-         func.ParameterGradient(x, p, &gradFunc[0]);
+         func.ParameterGradient(x, p, gradFunc);
       } else {
          // calculate integral (normalized by bin volume)
          // need to set function and parameters here in case loop is parallelized
          std::vector<double> x2(data.NDim());
          data.GetBinUpEdgeCoordinates(i, x2.data());
          fval = igEval(x, x2.data());
-         CalculateGradientIntegral(func, x, x2.data(), p, &gradFunc[0]);
+         CalculateGradientIntegral(func, x, x2.data(), p, gradFunc);
       }
       if (useBinVolume)
          fval *= binVolume;
@@ -1770,19 +1775,18 @@ void FitUtil::EvaluatePoissonLogLGradient(const IModelFunction &f, const BinData
       }
 
 
-      return pointContribution;
+      return;
    };
 
-   // Vertically reduce the set of vectors by summing its equally-indexed components
-   auto redFunction = [&](const std::vector<std::vector<double>> &pointContributions) {
-      std::vector<double> result(npar);
-
-      for (auto const &pointContribution : pointContributions) {
-         for (unsigned int parameterIndex = 0; parameterIndex < npar; parameterIndex++)
-            result[parameterIndex] += pointContribution[parameterIndex];
+   // sum the contributions of the points of each block, reusing the same buffers for all points
+   auto blockFunction = [&](unsigned int begin, unsigned int end, ROOT::Math::KahanSum<double> *sums) {
+      std::vector<double> gradFunc(npar);
+      std::vector<double> pointContribution(npar);
+      for (unsigned int i = begin; i < end; ++i) {
+         mapFunction(i, gradFunc.data(), pointContribution.data());
+         for (unsigned int ipar = 0; ipar < npar; ++ipar)
+            sums[ipar].Add(pointContribution[ipar]);
       }
-
-      return result;
    };
 
    std::vector<double> g(npar);
@@ -1790,42 +1794,21 @@ void FitUtil::EvaluatePoissonLogLGradient(const IModelFunction &f, const BinData
 #ifndef R__USE_IMT
    // If IMT is disabled, force the execution policy to the serial case
    if (executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
-      Warning("FitUtil::EvaluatePoissonLogLGradient",
-              "Multithread execution policy requires IMT, which is disabled. Changing "
-              "to ROOT::EExecutionPolicy::kSequential.");
+      Warning("FitUtil::EvaluatePoissonLogLGradient", "Multithread execution policy requires IMT, which is disabled. Changing "
+                                                      "to ROOT::EExecutionPolicy::kSequential.");
       executionPolicy = ROOT::EExecutionPolicy::kSequential;
    }
 #endif
 
-   if (executionPolicy == ROOT::EExecutionPolicy::kSequential) {
-      std::vector<std::vector<double>> allGradients(initialNPoints);
-      for (unsigned int i = 0; i < initialNPoints; ++i) {
-         allGradients[i] = mapFunction(i);
-      }
-      g = redFunction(allGradients);
-   }
-#ifdef R__USE_IMT
-   else if (executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
-      ROOT::TThreadExecutor pool;
-      auto chunks = nChunks != 0 ? nChunks : setAutomaticChunking(initialNPoints);
-      g = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, initialNPoints), redFunction, chunks);
-   }
-#endif
-
-   // else if(executionPolicy == ROOT::Fit::kMultiprocess){
-   //    ROOT::TProcessExecutor pool;
-   //    g = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, n), redFunction);
-   // }
-   else {
-      Error("FitUtil::EvaluatePoissonLogLGradient",
-            "Execution policy unknown. Available choices:\n 0: Serial (default)\n 1: MultiThread (requires IMT)\n");
+   if (executionPolicy == ROOT::EExecutionPolicy::kSequential ||
+       executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
+      ReduceBlocks(initialNPoints, npar, blockFunction, g.data(), executionPolicy, nChunks);
+   } else {
+      Error("FitUtil::EvaluatePoissonLogLGradient", "Execution policy unknown. Available choices:\n "
+                                                    "ROOT::EExecutionPolicy::kSequential (default)\n "
+                                                    "ROOT::EExecutionPolicy::kMultiThread (requires IMT)\n");
    }
 
-#ifndef R__USE_IMT
-   //to fix compiler warning
-   (void)nChunks;
-#endif
-
    // copy result
    std::copy(g.begin(), g.end(), grad);
 
@@ -0,0 +1,197 @@
+// @(#)root/mathcore:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "THyperLogLog.h"
+
+#include "TROOT.h"
+#include "TList.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// clang-format off
+/**
+* \class THyperLogLog
+* \ingroup MathCore
+* \brief Approximate number of distinct values of a stream in fixed memory. Named, streamable, storable and mergeable.
+*
+* Implements the HyperLogLog algorithm (Flajolet, Fusy, Gandouet, Meunier, 2007) with
+* 64 bit hashes, which need no correction for large counts, and the linear counting
+* correction for small counts. The first `precision` bits of the hash of a value select
+* one of \f$2^{precision}\f$ one-byte registers, which keeps the largest number of leading
+* zeros seen in the remaining bits. The relative standard error of GetCount() is
+* \f$1.04 / \sqrt{2^{precision}}\f$, i.e. 0.8% for the default precision of 14 (16 kB).
+*
+* Sketches filled with different parts of a data set can be merged with Merge() or
+* Add(): the result is exactly the sketch of all the data. They can be written to a
+* TFile and merged by hadd. RDataFrame fills them with the CountDistinct() action.
+*/
+// clang-format on
+
+ClassImp(THyperLogLog);
+
+namespace {
+
+/// Finalizer of the MurmurHash3 64 bit hash, spreading all input bits over the output.
+ULong64_t MixBits(ULong64_t h)
+{
+   h ^= h >> 33;
+   h *= 0xFF51AFD7ED558CCDULL;
+   h ^= h >> 33;
+   h *= 0xC4CEB9FE1A85EC53ULL;
+   h ^= h >> 33;
+   return h;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Constructor
+/// \param[in] name The name given to the object
+/// \param[in] precision Number of bits of the hash selecting a register, between 4 and 18.
+///                      The memory used is 2^precision bytes.
+THyperLogLog::THyperLogLog(const char *name, Int_t precision)
+   : fName(name), fPrecision(std::min(std::max(precision, 4), 18)), fN(0), fRegisters(std::size_t(1) << fPrecision)
+{
+   if (fPrecision != precision)
+      Warning("THyperLogLog", "Precision %d out of range, using %d", precision, fPrecision);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// THyperLogLog destructor.
+THyperLogLog::~THyperLogLog()
+{
+   // Required since we overload TObject::Hash.
+   ROOT::CallRecursiveRemoveIfNeeded(*this);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Count a value given by its 64 bit hash.
+///
+/// The hash must be well mixed, i.e. all its bits must depend on all the bits
+/// of the value. Use this to count values of types not supported by Fill().
+void THyperLogLog::FillHash(ULong64_t hash)
+{
+   fN++;
+   const std::size_t index = hash >> (64 - fPrecision);
+   ULong64_t rest = hash << fPrecision;
+   UChar_t rank = 1;
+   const UChar_t maxRank = 64 - fPrecision + 1;
+   while (rank < maxRank && !(rest & (ULong64_t(1) << 63))) {
+      ++rank;
+      rest <<= 1;
+   }
+   fRegisters[index] = std::max(fRegisters[index], rank);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Count a numerical value.
+///
+/// Values are compared as doubles: integers are counted exactly up to 2^53, and
+/// 0 and -0 are the same value.
+void THyperLogLog::Fill(Double_t val)
+{
+   if (val == 0)
+      val = 0; // -0 to 0
+   ULong64_t bits;
+   std::memcpy(&bits, &val, sizeof(bits));
+   FillHash(MixBits(bits));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Count a string.
+void THyperLogLog::Fill(const std::string &val)
+{
+   // FNV-1a, then mixed to make all bits depend on the whole string
+   ULong64_t h = 0xCBF29CE484222325ULL;
+   for (unsigned char c : val) {
+      h ^= c;
+      h *= 0x100000001B3ULL;
+   }
+   FillHash(MixBits(h));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove all the values from the sketch.
+void THyperLogLog::Reset()
+{
+   fN = 0;
+   std::fill(fRegisters.begin(), fRegisters.end(), 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the estimated number of distinct values filled.
+Double_t THyperLogLog::GetCount() const
+{
+   const Double_t m = fRegisters.size();
+   Double_t sum = 0;
+   Int_t nZeros = 0;
+   for (UChar_t r : fRegisters) {
+      sum += std::ldexp(1., -r);
+      nZeros += (r == 0);
+   }
+   const Double_t alpha = 0.7213 / (1. + 1.079 / m);
+   const Double_t estimate = alpha * m * m / sum;
+   // linear counting is more accurate for small counts
+   if (estimate <= 2.5 * m && nZeros > 0)
+      return m * std::log(m / nZeros);
+   return estimate;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Relative standard error of GetCount().
+Double_t THyperLogLog::GetRelativeError() const
+{
+   return 1.04 / std::sqrt(Double_t(fRegisters.size()));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Add the values of another sketch to this one.
+///
+/// Both sketches must have the same precision.
+void THyperLogLog::Add(const THyperLogLog &other)
+{
+   if (other.fPrecision != fPrecision) {
+      Error("Add", "Cannot add sketches with different precisions (%d and %d)", fPrecision, other.fPrecision);
+      return;
+   }
+   fN += other.fN;
+   for (std::size_t i = 0; i < fRegisters.size(); ++i)
+      fRegisters[i] = std::max(fRegisters[i], other.fRegisters[i]);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Merge implementation of THyperLogLog
+/// \param[in] in Other THyperLogLog objects to be added to the current one
+/// \return The number of objects merged, including this one.
+Int_t THyperLogLog::Merge(TCollection *in)
+{
+   Int_t nMerged = 1;
+   for (auto o : *in) {
+      if (auto sketch = dynamic_cast<THyperLogLog *>(o)) {
+         Add(*sketch);
+         ++nMerged;
+      }
+   }
+   return nMerged;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Print the content of the object
+///
+/// Prints the estimated number of distinct values with its standard error and
+/// the number of values filled in one line.
+void THyperLogLog::Print(Option_t *) const
+{
+   TROOT::IndentLevel();
+   Printf(" OBJ: THyperLogLog\t %s \t Distinct = %.6g +- %.2g%% \t Count = %lld", fName.Data(), GetCount(),
+          100 * GetRelativeError(), GetN());
+}
@@ -11,13 +11,47 @@
 
 #include "TKDTree.h"
 #include "TRandom.h"
+#include "TROOT.h"
 
 #include "TString.h"
+#include <algorithm>
 #include <cstring>
 #include <limits>
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
 templateClassImp(TKDTree);
 
+namespace {
+
+/// Call query(i) for i in [0, nQueries), in parallel with implicit multi-threading.
+template <typename Index, class Query>
+void ForEachQuery(Index nQueries, const Query &query)
+{
+#ifdef R__USE_IMT
+   // number of queries processed by one task
+   constexpr Index kQueriesPerTask = 64;
+   if (ROOT::IsImplicitMTEnabled() && nQueries > kQueriesPerTask) {
+      const UInt_t nTasks = (nQueries + kQueriesPerTask - 1) / kQueriesPerTask;
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(
+         [&](UInt_t task) {
+            const Index end = std::min<Index>(nQueries, (task + 1) * kQueriesPerTask);
+            for (Index iq = task * kQueriesPerTask; iq < end; iq++)
+               query(iq);
+         },
+         ROOT::TSeq<UInt_t>(0, nTasks));
+      return;
+   }
+#endif
+   for (Index iq = 0; iq < nQueries; iq++)
+      query(iq);
+}
+
+} // namespace
+
 
 /**
 \class TKDTree
@@ -159,6 +193,24 @@ in the 2 subtrees as close as possible. The following section gives more details
     part of the index array. To find the number of point in the node
     (not only terminal), call TKDTree::GetNpointsNode(Index inode).
 
+#### 3c. Searching many points and storing the tree
+
+    FindNearestNeighbors() and FindInRange() have versions taking an array of query points,
+    given point by point. With implicit multi-threading enabled (ROOT::EnableImplicitMT()),
+    those queries, as well as the division of the large trees in Build(), run in parallel.
+
+    Build() keeps a copy of the coordinates of the points in the order of the terminal nodes,
+    so that the points of a bucket are contiguous in memory. The searches use this copy, so they
+    don't need the original data. Since the copy and the index array are persistent, a built tree
+    written to a file (or any other buffer) can be read back and searched directly:
+
+\code{.cpp}
+    kdtree->Write("kdtree");
+    ...
+    auto kdtree = file->Get<TKDTreeID>("kdtree");
+    kdtree->FindNearestNeighbors(nqueries, queries, k, indices, distances);
+\endcode
+
 ### 4.  TKDtree implementation details - internal information, not needed to use the kd-tree.
 
 ####  4a. Order of nodes in the node information arrays:
@@ -401,8 +453,8 @@ TKDTree<Index, Value>::~TKDTree()
 /// 1. calculate number of nodes
 /// 2. calculate first terminal row
 /// 3. initialize index array
-/// 4. non recursive building of the binary tree
-///
+/// 4. non recursive building of the binary tree, in parallel if implicit multi-threading is enabled
+/// 5. copy of the points in the order of the terminal nodes
 ///
 /// The tree is divided recursively. See class description, section 4b for the details
 /// of the division algorithm
@@ -449,20 +501,62 @@ void TKDTree<Index, Value>::Build()
    //
    //
    //4.
+   // With implicit multi-threading the rows down to stopRow are divided first, and the
+   // subtrees starting at stopRow, which use disjoint parts of fIndPoints, are then
+   // divided in parallel. The resulting tree is the same as with a sequential build.
+   Int_t stopRow = -1;
+   std::vector<Int_t> subtrees;
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && fNPoints >= (1 << 16)) {
+      const UInt_t nTasks = 4 * ROOT::GetThreadPoolSize();
+      for (stopRow = 1; stopRow < fRowT0 && (1u << stopRow) < nTasks; stopRow++) {}
+   }
+#endif
+   BuildNodes(0, 0, 0, fNPoints, stopRow, &subtrees);
+#ifdef R__USE_IMT
+   if (!subtrees.empty()) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(
+         [&](UInt_t i) {
+            BuildNodes(subtrees[4 * i], subtrees[4 * i + 1], subtrees[4 * i + 2], subtrees[4 * i + 3], -1, nullptr);
+         },
+         ROOT::TSeq<UInt_t>(0, subtrees.size() / 4));
+   }
+#endif
+
+   //5.
+   // copy the points in the order of the terminal nodes, so that the points of a bucket are
+   // contiguous in memory and the tree can be used without the original data
+   fPoints.resize(std::size_t(fNPoints) * fNDim);
+   for (Index ipos = 0; ipos < fNPoints; ipos++) {
+      for (Index idim = 0; idim < fNDim; idim++)
+         fPoints[std::size_t(ipos) * fNDim + idim] = fData[idim][fIndPoints[ipos]];
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Divide the npoints points starting at position pos of fIndPoints, which belong to
+/// the node `node` on row `row`, until the terminal nodes. Nodes on row stopRow are
+/// not divided but appended to subtrees as (node, row, pos, npoints) instead.
+
+template <typename  Index, typename Value>
+void TKDTree<Index, Value>::BuildNodes(Int_t node, Int_t row, Int_t pos, Int_t npoints, Int_t stopRow,
+                                       std::vector<Int_t> *subtrees)
+{
    //    stack for non recursive build - size 128 bytes enough
    Int_t rowStack[128];
    Int_t nodeStack[128];
    Int_t npointStack[128];
    Int_t posStack[128];
    Int_t currentIndex = 0;
-   rowStack[0]    = 0;
-   nodeStack[0]   = 0;
-   npointStack[0] = fNPoints;
-   posStack[0]   = 0;
+   rowStack[0]    = row;
+   nodeStack[0]   = node;
+   npointStack[0] = npoints;
+   posStack[0]   = pos;
    //
    while (currentIndex>=0){
       //
-      Int_t npoints  = npointStack[currentIndex];
+      npoints  = npointStack[currentIndex];
       if (npoints<=fBucketSize) {
          currentIndex--;
          continue; // terminal node
@@ -470,6 +564,12 @@ void TKDTree<Index, Value>::Build()
       Int_t crow     = rowStack[currentIndex];
       Int_t cpos     = posStack[currentIndex];
       Int_t cnode    = nodeStack[currentIndex];
+      if (crow == stopRow) {
+         // left to be divided later
+         subtrees->insert(subtrees->end(), {cnode, crow, cpos, npoints});
+         currentIndex--;
+         continue;
+      }
       //printf("currentIndex %d npoints %d node %d\n", currentIndex, npoints, cnode);
       //
       // divide points
@@ -556,6 +656,35 @@ void TKDTree<Index, Value>::FindNearestNeighbors(const Value *point, const Int_t
 
 }
 
+////////////////////////////////////////////////////////////////////////////////
+///Find the kNN nearest neighbors of each of the nQueries points in the array points,
+///which contains the coordinates point by point (nQueries*GetNDim() values).
+///The indices and distances of the neighbors of the query i are returned in
+///ind[i*kNN ... (i+1)*kNN-1] and dist[i*kNN ... (i+1)*kNN-1], arrays which must be
+///allocated by the user. The queries are processed in parallel if implicit
+///multi-threading is enabled.
+
+template <typename  Index, typename Value>
+void TKDTree<Index, Value>::FindNearestNeighbors(Index nQueries, const Value *points, const Int_t kNN, Index *ind,
+                                                 Value *dist)
+{
+   if (!ind || !dist) {
+      Error("FindNearestNeighbors", "Working arrays must be allocated by the user!");
+      return;
+   }
+   // make the boundaries before processing the queries, which then only read the tree
+   MakeBoundariesExact();
+   ForEachQuery(nQueries, [&](Index iq) {
+      Index *qind = ind + std::size_t(iq) * kNN;
+      Value *qdist = dist + std::size_t(iq) * kNN;
+      for (Int_t i=0; i<kNN; i++){
+         qdist[i]=std::numeric_limits<Value>::max();
+         qind[i]=-1;
+      }
+      UpdateNearestNeighbors(0, points + std::size_t(iq) * fNDim, kNN, qind, qdist);
+   });
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///Update the nearest neighbors values by examining the node inode
 
@@ -574,7 +703,7 @@ void TKDTree<Index, Value>::UpdateNearestNeighbors(Index inode, const Value *poi
       Index f1, l1, f2, l2;
       GetNodePointsIndexes(inode, f1, l1, f2, l2);
       for (Int_t ipoint=f1; ipoint<=l1; ipoint++){
-         Double_t d = Distance(point, fIndPoints[ipoint]);
+         Double_t d = DistanceToPosition(point, ipoint);
          if (d<dist[kNN-1]){
             //found a closer point
             Int_t ishift=0;
@@ -626,6 +755,26 @@ Double_t TKDTree<Index, Value>::Distance(const Value *point, Index ind, Int_t ty
 
 }
 
+////////////////////////////////////////////////////////////////////////////////
+///Find the L2 distance between point of the first argument and the point at position ipos
+///of the index array, using the coordinates stored in the order of the terminal nodes
+
+template <typename Index, typename Value>
+Double_t TKDTree<Index, Value>::DistanceToPosition(const Value *point, Index ipos) const
+{
+   Double_t dist = 0;
+   if (fPoints.empty()) {
+      const Index ind = fIndPoints[ipos];
+      for (Int_t idim=0; idim<fNDim; idim++)
+         dist+=(point[idim]-fData[idim][ind])*(point[idim]-fData[idim][ind]);
+   } else {
+      const Value *x = &fPoints[std::size_t(ipos) * fNDim];
+      for (Int_t idim=0; idim<fNDim; idim++)
+         dist+=(point[idim]-x[idim])*(point[idim]-x[idim]);
+   }
+   return TMath::Sqrt(dist);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///Find the minimal and maximal distance from a given point to a given node.
 ///Type argument specifies the metric: type=2 - L2 metric, type=1 - L1 metric
@@ -752,11 +901,30 @@ void TKDTree<Index, Value>::FindInRange(Value * point, Value range, std::vector<
    UpdateRange(0, point, range, res);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+///Find the points in the sphere of radius "range" around each of the nQueries points in
+///the array points, which contains the coordinates point by point (nQueries*GetNDim() values).
+///res is resized to nQueries and res[i] contains the indices of the points found for the query i.
+///The queries are processed in parallel if implicit multi-threading is enabled.
+
+template <typename  Index, typename Value>
+void TKDTree<Index, Value>::FindInRange(Index nQueries, const Value *points, Value range,
+                                        std::vector<std::vector<Index>> &res)
+{
+   res.resize(nQueries);
+   // make the boundaries before processing the queries, which then only read the tree
+   MakeBoundariesExact();
+   ForEachQuery(nQueries, [&](Index iq) {
+      res[iq].clear();
+      UpdateRange(0, points + std::size_t(iq) * fNDim, range, res[iq]);
+   });
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///Internal recursive function with the implementation of range searches
 
 template <typename  Index, typename Value>
-void TKDTree<Index, Value>::UpdateRange(Index inode, Value* point, Value range, std::vector<Index> &res)
+void TKDTree<Index, Value>::UpdateRange(Index inode, const Value* point, Value range, std::vector<Index> &res)
 {
    Value min, max;
    DistanceToNode(point, inode, min, max);
@@ -786,7 +954,7 @@ void TKDTree<Index, Value>::UpdateRange(Index inode, Value* point, Value range,
       Double_t d;
       GetNodePointsIndexes(inode, f1, l1, f2, l2);
       for (Int_t ipoint=f1; ipoint<=l1; ipoint++){
-         d = Distance(point, fIndPoints[ipoint]);
+         d = DistanceToPosition(point, ipoint);
          if (d <= range){
             res.push_back(fIndPoints[ipoint]);
          }
@@ -1129,15 +1297,16 @@ void TKDTree<Index, Value>::MakeBoundariesExact()
          min[idim]= std::numeric_limits<Value>::max();
          max[idim]=-std::numeric_limits<Value>::max();
       }
-      Index *points = GetPointsIndexes(inode);
+      Index first = GetPointsIndexes(inode) - fIndPoints;
       Index npoints = GetNPointsNode(inode);
       //find max and min in each dimension
-      for (Index ipoint=0; ipoint<npoints; ipoint++){
+      for (Index ipoint=first; ipoint<first+npoints; ipoint++){
          for (Index idim=0; idim<fNDim; idim++){
-            if (fData[idim][points[ipoint]]<min[idim])
-               min[idim]=fData[idim][points[ipoint]];
-            if (fData[idim][points[ipoint]]>max[idim])
-               max[idim]=fData[idim][points[ipoint]];
+            const Value x = PointCoordinate(ipoint, idim);
+            if (x<min[idim])
+               min[idim]=x;
+            if (x>max[idim])
+               max[idim]=x;
          }
       }
       for (Index idim=0; idim<fNDimm; idim+=2){
@@ -0,0 +1,308 @@
+// @(#)root/mathcore:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "TQuantileSketch.h"
+
+#include "TROOT.h"
+#include "TList.h"
+
+#include <algorithm>
+#include <cmath>
+
+// clang-format off
+/**
+* \class TQuantileSketch
+* \ingroup MathCore
+* \brief Approximate quantiles of a stream of values in bounded memory. Named, streamable, storable and mergeable.
+*
+* The values are summarized by a KLL sketch (Karnin, Lang, Liberty: Optimal Quantile
+* Approximation in Streams, 2016). Filled values enter the compactor of level 0; when
+* the sketch holds too many items, the sorted content of a full compactor is halved by
+* keeping every other item, chosen at random, in the compactor of the next level. An
+* item in the compactor of level h thus stands for \f$2^h\f$ values.
+*
+* The memory used grows only logarithmically with the number of values. The rank of the
+* value returned by GetQuantile() differs from the requested one by less than
+* GetNormalizedRankError() times the number of values, with 99% probability. It is about
+* 1.3% for the default accuracy parameter k = 200, 0.2% for k = 1600.
+*
+* Sketches filled with different parts of a data set, for instance by different
+* threads or jobs, can be merged with Merge() or Add(): the result has the same
+* accuracy as a sketch filled with all the data. They can be written to a TFile
+* and merged by hadd. RDataFrame fills them with the Quantiles() action.
+*/
+// clang-format on
+
+ClassImp(TQuantileSketch);
+
+namespace {
+
+/// Ratio of the capacities of consecutive compactors.
+constexpr Double_t kCapacityRatio = 2. / 3.;
+
+/// Next value of a splitmix64 generator.
+ULong64_t NextRandom(ULong64_t &state)
+{
+   ULong64_t z = (state += 0x9E3779B97F4A7C15ULL);
+   z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+   z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+   return z ^ (z >> 31);
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Constructor
+/// \param[in] name The name given to the object
+/// \param[in] k The accuracy parameter, i.e. the capacity of the compactor of
+///              highest level. The memory used and the accuracy grow linearly with k.
+TQuantileSketch::TQuantileSketch(const char *name, Int_t k)
+   : fName(name), fK(std::max(k, 8)), fN(0), fMin(TMath::Limits<Double_t>::Max()),
+     fMax(-TMath::Limits<Double_t>::Max()), fSeed(0x2545F4914F6CDD1DULL)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// TQuantileSketch destructor.
+TQuantileSketch::~TQuantileSketch()
+{
+   // Required since we overload TObject::Hash.
+   ROOT::CallRecursiveRemoveIfNeeded(*this);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Number of items the compactor of the given level can hold.
+Int_t TQuantileSketch::GetCapacity(Int_t level) const
+{
+   const Int_t depth = fCompactors.size() - level - 1;
+   return Int_t(std::ceil(fK * std::pow(kCapacityRatio, depth))) + 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Recompute the number of retained items and the size triggering a compression.
+void TQuantileSketch::UpdateSize()
+{
+   fSize = 0;
+   fMaxSize = 0;
+   for (std::size_t level = 0; level < fCompactors.size(); ++level) {
+      fSize += fCompactors[level].size();
+      fMaxSize += GetCapacity(level);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add a compactor on top of the existing ones.
+void TQuantileSketch::AddLevel()
+{
+   fCompactors.emplace_back();
+   UpdateSize();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Halve the content of the full compactors, starting from the lowest level,
+/// until the number of retained items is below the maximum.
+void TQuantileSketch::Compress()
+{
+   for (std::size_t level = 0; level < fCompactors.size(); ++level) {
+      if (Long64_t(fCompactors[level].size()) < GetCapacity(level))
+         continue;
+      if (level + 1 == fCompactors.size())
+         AddLevel();
+      auto &items = fCompactors[level];
+      auto &next = fCompactors[level + 1];
+      std::sort(items.begin(), items.end());
+      // an odd item out stays at this level; of each following pair one item is kept
+      const std::size_t first = items.size() % 2;
+      const std::size_t offset = NextRandom(fSeed) >> 63;
+      for (std::size_t i = first + offset; i < items.size(); i += 2)
+         next.push_back(items[i]);
+      items.resize(first);
+      UpdateSize();
+      if (fSize < fMaxSize)
+         break;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Add a value to the sketch
+/// \param[in] val Value to fill the sketch with; NaN values are ignored.
+void TQuantileSketch::Fill(Double_t val)
+{
+   if (std::isnan(val))
+      return;
+   fN++;
+   fMin = (val < fMin) ? val : fMin;
+   fMax = (val > fMax) ? val : fMax;
+
+   if (fCompactors.empty())
+      AddLevel();
+   else if (fSize < 0)
+      UpdateSize();
+   fCompactors[0].push_back(val);
+   if (++fSize >= fMaxSize)
+      Compress();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove all the values from the sketch.
+void TQuantileSketch::Reset()
+{
+   fN = 0;
+   fMin = TMath::Limits<Double_t>::Max();
+   fMax = -TMath::Limits<Double_t>::Max();
+   fCompactors.clear();
+   fSize = -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Number of values kept by the sketch to represent all the values filled.
+Long64_t TQuantileSketch::GetNRetained() const
+{
+   Long64_t size = 0;
+   for (const auto &items : fCompactors)
+      size += items.size();
+   return size;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Relative error on the rank of the quantiles, valid with 99% probability.
+/// This is the empirical bound of the Apache DataSketches KLL implementation,
+/// which uses the same compaction scheme.
+Double_t TQuantileSketch::GetNormalizedRankError() const
+{
+   return 2.296 / std::pow(fK, 0.9723);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Retained items sorted by value, with their cumulative weight.
+std::vector<std::pair<Double_t, Long64_t>> TQuantileSketch::GetWeightedItems() const
+{
+   std::vector<std::pair<Double_t, Long64_t>> items;
+   items.reserve(GetNRetained());
+   for (std::size_t level = 0; level < fCompactors.size(); ++level) {
+      for (Double_t x : fCompactors[level])
+         items.emplace_back(x, Long64_t(1) << level);
+   }
+   std::sort(items.begin(), items.end());
+   Long64_t sum = 0;
+   for (auto &item : items)
+      item.second = (sum += item.second);
+   return items;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Compute quantiles
+/// \param[in] nprob The number of quantiles to compute
+/// \param[out] q Array of size nprob receiving the quantiles
+/// \param[in] prob Array of size nprob with the probabilities; if nullptr,
+///                 the quantiles for (i+1)/nprob are computed, as TH1::GetQuantiles does.
+/// \return The number of quantiles computed.
+///
+/// Probabilities <= 0 (>= 1) give the minimum (maximum) value filled. All
+/// quantiles are 0 if the sketch is empty.
+Int_t TQuantileSketch::GetQuantiles(Int_t nprob, Double_t *q, const Double_t *prob) const
+{
+   const auto items = GetWeightedItems();
+   for (Int_t i = 0; i < nprob; ++i) {
+      const Double_t p = prob ? prob[i] : Double_t(i + 1) / nprob;
+      if (items.empty()) {
+         q[i] = 0;
+      } else if (p <= 0) {
+         q[i] = fMin;
+      } else if (p >= 1) {
+         q[i] = fMax;
+      } else {
+         const Double_t target = p * items.back().second;
+         auto pos = std::lower_bound(items.begin(), items.end(), target,
+                                     [](const std::pair<Double_t, Long64_t> &item, Double_t w) { return item.second < w; });
+         q[i] = (pos == items.end()) ? fMax : pos->first;
+      }
+   }
+   return nprob;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the approximate quantile for probability prob, e.g. the median for 0.5.
+/// See GetQuantiles().
+Double_t TQuantileSketch::GetQuantile(Double_t prob) const
+{
+   Double_t q = 0;
+   GetQuantiles(1, &q, &prob);
+   return q;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the approximate fraction of the values that are <= x.
+Double_t TQuantileSketch::GetRank(Double_t x) const
+{
+   if (fN == 0)
+      return 0;
+   Long64_t weight = 0;
+   for (std::size_t level = 0; level < fCompactors.size(); ++level) {
+      for (Double_t item : fCompactors[level]) {
+         if (item <= x)
+            weight += Long64_t(1) << level;
+      }
+   }
+   return Double_t(weight) / fN;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Add the values of another sketch to this one.
+///
+/// Both sketches must have the same accuracy parameter k.
+void TQuantileSketch::Add(const TQuantileSketch &other)
+{
+   if (other.fK != fK) {
+      Error("Add", "Cannot add sketches with different accuracy parameters (%d and %d)", fK, other.fK);
+      return;
+   }
+   if (other.fN == 0)
+      return;
+   fN += other.fN;
+   fMin = (other.fMin < fMin) ? other.fMin : fMin;
+   fMax = (other.fMax > fMax) ? other.fMax : fMax;
+   while (fCompactors.size() < other.fCompactors.size())
+      fCompactors.emplace_back();
+   for (std::size_t level = 0; level < other.fCompactors.size(); ++level)
+      fCompactors[level].insert(fCompactors[level].end(), other.fCompactors[level].begin(),
+                                other.fCompactors[level].end());
+   UpdateSize();
+   while (fSize >= fMaxSize)
+      Compress();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Merge implementation of TQuantileSketch
+/// \param[in] in Other TQuantileSketch objects to be added to the current one
+/// \return The number of objects merged, including this one.
+Int_t TQuantileSketch::Merge(TCollection *in)
+{
+   Int_t nMerged = 1;
+   for (auto o : *in) {
+      if (auto sketch = dynamic_cast<TQuantileSketch *>(o)) {
+         Add(*sketch);
+         ++nMerged;
+      }
+   }
+   return nMerged;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Print the content of the object
+///
+/// Prints the median, the number of values and retained items, the minimum
+/// and the maximum in one line.
+void TQuantileSketch::Print(Option_t *) const
+{
+   TROOT::IndentLevel();
+   Printf(" OBJ: TQuantileSketch\t %s \t Median = %.5g \t Count = %lld \t Retained = %lld \t Min = %.5g \t Max = %.5g",
+          fName.Data(), GetQuantile(0.5), GetN(), GetNRetained(), GetMin(), GetMax());
+}
@@ -5,7 +5,9 @@
 #include "Fit/BinData.h"
 #include "Fit/UnBinData.h"
 #include "Fit/Fitter.h"
+#include "Fit/FitUtil.h"
 #include "HFitInterface.h"
+#include "Math/WrappedMultiTF1.h"
 #include "TH2.h"
 #include "TF2.h"
 #include "TROOT.h"
@@ -291,6 +293,57 @@ REGISTER_TYPED_TEST_SUITE_P(GradientFittingTest,Sequential);
 
 INSTANTIATE_TYPED_TEST_SUITE_P(GradientFitting, GradientFittingTest, TestTypes);
 
+// The objective functions are summed in fixed blocks of points, so that their values and gradients
+// are the same for all execution policies
+TEST(FitUtil, ReproducibleEvaluation)
+{
+   TF2 f2("fReproducible", "[0]*(1 + [1]*x + [2]*y*y)", 0, 1, 0, 1);
+   f2.SetParameters(10, 0.5, 0.2);
+   TH2D h2("hReproducible", "h", 150, 0, 1, 150, 0, 1);
+   gRandom->SetSeed(111);
+   h2.FillRandom("fReproducible", 200000);
+
+   ROOT::Fit::DataOptions opt;
+   ROOT::Fit::DataRange range;
+   ROOT::Fit::BinData data(opt, range);
+   ROOT::Fit::FillData(data, &h2, &f2);
+   ASSERT_GT(data.Size(), 10000u);
+
+   ROOT::Math::WrappedMultiTF1 func(f2, 2);
+   const double p[] = {8.5, 0.4, 0.3};
+   unsigned int nPoints = 0;
+
+   // reference chi2 computed point by point
+   double chi2Ref = 0;
+   for (unsigned int i = 0; i < data.Size(); ++i) {
+      const double x[] = {*data.GetCoordComponent(i, 0), *data.GetCoordComponent(i, 1)};
+      const double res = (data.Value(i) - f2.EvalPar(x, p)) * data.InvError(i);
+      chi2Ref += res * res;
+   }
+
+   const double chi2 = ROOT::Fit::FitUtil::EvaluateChi2(func, data, p, nPoints, ROOT::EExecutionPolicy::kSequential);
+   EXPECT_NEAR(chi2, chi2Ref, 1.E-10 * chi2Ref);
+   const double logL =
+      ROOT::Fit::FitUtil::EvaluatePoissonLogL(func, data, p, 0, true, nPoints, ROOT::EExecutionPolicy::kSequential);
+   std::vector<double> grad(3);
+   ROOT::Fit::FitUtil::EvaluateChi2Gradient(func, data, p, grad.data(), nPoints, ROOT::EExecutionPolicy::kSequential);
+
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT(4);
+   for (unsigned nChunks : {0u, 3u, 16u}) {
+      EXPECT_EQ(chi2, ROOT::Fit::FitUtil::EvaluateChi2(func, data, p, nPoints, ROOT::EExecutionPolicy::kMultiThread,
+                                                       nChunks));
+      EXPECT_EQ(logL, ROOT::Fit::FitUtil::EvaluatePoissonLogL(func, data, p, 0, true, nPoints,
+                                                              ROOT::EExecutionPolicy::kMultiThread, nChunks));
+      std::vector<double> gradMT(3);
+      ROOT::Fit::FitUtil::EvaluateChi2Gradient(func, data, p, gradMT.data(), nPoints,
+                                               ROOT::EExecutionPolicy::kMultiThread, nChunks);
+      EXPECT_EQ(grad, gradMT);
+   }
+   ROOT::DisableImplicitMT();
+#endif
+}
+
 int main(int argc, char** argv) {
 
    // Disables elapsed time by default.
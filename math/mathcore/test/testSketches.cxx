@@ -0,0 +1,135 @@
+#include "TQuantileSketch.h"
+#include "THyperLogLog.h"
+#include "TBufferFile.h"
+#include "TList.h"
+#include "TRandom3.h"
+
+#include "ROOT/TestSupport.hxx"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+TEST(TQuantileSketch, Quantiles)
+{
+   const Int_t n = 1000000;
+   TRandom3 rndm(1);
+   std::vector<Double_t> values(n);
+   TQuantileSketch sketch("sketch");
+   for (auto &x : values) {
+      x = rndm.Gaus(10, 2);
+      sketch.Fill(x);
+   }
+   EXPECT_EQ(sketch.GetN(), n);
+   EXPECT_LT(sketch.GetNRetained(), 2000);
+   EXPECT_EQ(sketch.GetMin(), *std::min_element(values.begin(), values.end()));
+   EXPECT_EQ(sketch.GetMax(), *std::max_element(values.begin(), values.end()));
+
+   std::sort(values.begin(), values.end());
+   const Double_t eps = sketch.GetNormalizedRankError();
+   for (Double_t p : {0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99}) {
+      // the rank of the approximate quantile is close to the requested one
+      const Double_t q = sketch.GetQuantile(p);
+      const Double_t rank = Double_t(std::upper_bound(values.begin(), values.end(), q) - values.begin()) / n;
+      EXPECT_NEAR(rank, p, eps) << "p = " << p;
+      EXPECT_NEAR(sketch.GetRank(q), rank, eps) << "p = " << p;
+   }
+}
+
+TEST(TQuantileSketch, Merge)
+{
+   const Int_t n = 200000, nParts = 4;
+   TRandom3 rndm(2);
+   TQuantileSketch all("all");
+   std::vector<std::unique_ptr<TQuantileSketch>> parts;
+   TList list;
+   for (Int_t i = 0; i < nParts; ++i) {
+      parts.emplace_back(std::make_unique<TQuantileSketch>("part"));
+      if (i > 0)
+         list.Add(parts.back().get());
+   }
+   for (Int_t i = 0; i < n; ++i) {
+      const Double_t x = rndm.Exp(1.);
+      all.Fill(x);
+      parts[i % nParts]->Fill(x);
+   }
+   EXPECT_EQ(parts[0]->Merge(&list), nParts);
+   list.Clear("nodelete");
+
+   EXPECT_EQ(parts[0]->GetN(), n);
+   EXPECT_EQ(parts[0]->GetMin(), all.GetMin());
+   EXPECT_EQ(parts[0]->GetMax(), all.GetMax());
+   const Double_t eps = all.GetNormalizedRankError();
+   for (Double_t p : {0.1, 0.5, 0.9}) {
+      // median of the exponential distribution is log(2), etc.
+      const Double_t expected = -std::log(1 - p);
+      EXPECT_NEAR(all.GetRank(parts[0]->GetQuantile(p)), p, 2 * eps) << "p = " << p;
+      EXPECT_NEAR(parts[0]->GetQuantile(p), expected, 0.05) << "p = " << p;
+   }
+}
+
+TEST(TQuantileSketch, Streaming)
+{
+   TQuantileSketch sketch("sketch", 100);
+   for (Int_t i = 0; i < 10000; ++i)
+      sketch.Fill(i);
+
+   TBufferFile buf(TBuffer::kWrite);
+   buf.WriteObject(&sketch);
+   buf.SetReadMode();
+   buf.SetBufferOffset(0);
+   std::unique_ptr<TQuantileSketch> read(static_cast<TQuantileSketch *>(buf.ReadObject(TQuantileSketch::Class())));
+   ASSERT_NE(read, nullptr);
+   EXPECT_STREQ(read->GetName(), "sketch");
+   EXPECT_EQ(read->GetK(), 100);
+   EXPECT_EQ(read->GetN(), sketch.GetN());
+   EXPECT_EQ(read->GetQuantile(0.3), sketch.GetQuantile(0.3));
+
+   // both continue identically
+   for (Int_t i = 0; i < 10000; ++i) {
+      sketch.Fill(-i);
+      read->Fill(-i);
+   }
+   EXPECT_EQ(read->GetQuantile(0.3), sketch.GetQuantile(0.3));
+}
+
+TEST(THyperLogLog, Count)
+{
+   TRandom3 rndm(3);
+   for (Int_t nDistinct : {10, 1000, 100000, 1000000}) {
+      THyperLogLog hll("hll");
+      // each value several times
+      for (Int_t i = 0; i < 3 * nDistinct; ++i)
+         hll.Fill(Double_t(rndm.Integer(nDistinct)));
+      for (Int_t i = 0; i < nDistinct; ++i)
+         hll.Fill(Double_t(i));
+      EXPECT_NEAR(hll.GetCount(), nDistinct, 4 * hll.GetRelativeError() * nDistinct) << "n = " << nDistinct;
+   }
+
+   THyperLogLog strings("strings");
+   for (Int_t i = 0; i < 5000; ++i)
+      strings.Fill("key" + std::to_string(i % 2000));
+   EXPECT_NEAR(strings.GetCount(), 2000, 4 * strings.GetRelativeError() * 2000);
+}
+
+TEST(THyperLogLog, Merge)
+{
+   THyperLogLog all("all"), a("a"), b("b");
+   for (Int_t i = 0; i < 50000; ++i) {
+      all.Fill(i * 0.5);
+      (i % 2 ? a : b).Fill(i * 0.5);
+   }
+   TList list;
+   list.Add(&b);
+   EXPECT_EQ(a.Merge(&list), 2);
+   list.Clear("nodelete");
+   // merging is exact
+   EXPECT_EQ(a.GetCount(), all.GetCount());
+   EXPECT_EQ(a.GetN(), all.GetN());
+
+   THyperLogLog other("other", 10);
+   ROOT_EXPECT_ERROR(a.Add(other), "THyperLogLog::Add", "Cannot add sketches with different precisions (14 and 10)");
+   EXPECT_EQ(a.GetCount(), all.GetCount());
+}
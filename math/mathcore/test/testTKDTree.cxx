@@ -0,0 +1,122 @@
+#include "TKDTree.h"
+#include "TBufferFile.h"
+#include "TRandom3.h"
+#include "TROOT.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace {
+
+// column-wise random data as expected by TKDTree
+std::vector<std::vector<Double_t>> MakeData(Int_t npoints, Int_t ndim, UInt_t seed)
+{
+   TRandom3 rndm(seed);
+   std::vector<std::vector<Double_t>> data(ndim, std::vector<Double_t>(npoints));
+   for (auto &column : data)
+      for (auto &x : column)
+         x = rndm.Uniform(-1, 1);
+   return data;
+}
+
+std::unique_ptr<TKDTreeID> MakeTree(std::vector<std::vector<Double_t>> &data, UInt_t bsize)
+{
+   auto tree = std::make_unique<TKDTreeID>(data[0].size(), data.size(), bsize);
+   for (std::size_t idim = 0; idim < data.size(); ++idim)
+      tree->SetData(idim, data[idim].data());
+   tree->Build();
+   return tree;
+}
+
+} // namespace
+
+TEST(TKDTree, BatchQueries)
+{
+   const Int_t npoints = 20000, ndim = 3, nqueries = 200, k = 5;
+   auto data = MakeData(npoints, ndim, 1);
+   auto tree = MakeTree(data, 8);
+
+   TRandom3 rndm(2);
+   std::vector<Double_t> queries(nqueries * ndim);
+   for (auto &x : queries)
+      x = rndm.Uniform(-1, 1);
+
+   std::vector<Int_t> ind(nqueries * k);
+   std::vector<Double_t> dist(nqueries * k);
+   tree->FindNearestNeighbors(nqueries, queries.data(), k, ind.data(), dist.data());
+
+   std::vector<std::vector<Int_t>> inRange;
+   const Double_t range = 0.1;
+   tree->FindInRange(nqueries, queries.data(), range, inRange);
+   ASSERT_EQ(inRange.size(), std::size_t(nqueries));
+
+   for (Int_t iq = 0; iq < nqueries; ++iq) {
+      const Double_t *q = &queries[iq * ndim];
+      // brute force reference
+      std::vector<std::pair<Double_t, Int_t>> all(npoints);
+      std::vector<Int_t> expectedInRange;
+      for (Int_t i = 0; i < npoints; ++i) {
+         all[i] = {tree->Distance(q, i), i};
+         if (all[i].first <= range)
+            expectedInRange.push_back(i);
+      }
+      std::partial_sort(all.begin(), all.begin() + k, all.end());
+
+      std::vector<Int_t> singleInd(k);
+      std::vector<Double_t> singleDist(k);
+      tree->FindNearestNeighbors(q, k, singleInd.data(), singleDist.data());
+      for (Int_t j = 0; j < k; ++j) {
+         EXPECT_EQ(ind[iq * k + j], all[j].second);
+         EXPECT_DOUBLE_EQ(dist[iq * k + j], all[j].first);
+         EXPECT_EQ(ind[iq * k + j], singleInd[j]);
+      }
+
+      std::sort(inRange[iq].begin(), inRange[iq].end());
+      EXPECT_EQ(inRange[iq], expectedInRange);
+   }
+}
+
+TEST(TKDTree, Streaming)
+{
+   const Int_t npoints = 5000, ndim = 2, k = 4;
+   auto data = MakeData(npoints, ndim, 3);
+   auto tree = MakeTree(data, 4);
+
+   TBufferFile buf(TBuffer::kWrite);
+   buf.WriteObject(tree.get());
+   buf.SetReadMode();
+   buf.SetBufferOffset(0);
+   std::unique_ptr<TKDTreeID> readTree(static_cast<TKDTreeID *>(buf.ReadObject(TKDTreeID::Class())));
+   ASSERT_NE(readTree, nullptr);
+
+   // the tree read back does not have the original data
+   const Double_t queries[] = {0., 0., 0.5, -0.5, -0.9, 0.9};
+   std::vector<Int_t> ind(3 * k), readInd(3 * k);
+   std::vector<Double_t> dist(3 * k), readDist(3 * k);
+   tree->FindNearestNeighbors(3, queries, k, ind.data(), dist.data());
+   readTree->FindNearestNeighbors(3, queries, k, readInd.data(), readDist.data());
+   EXPECT_EQ(ind, readInd);
+   EXPECT_EQ(dist, readDist);
+}
+
+#ifdef R__USE_IMT
+TEST(TKDTree, ParallelBuild)
+{
+   const Int_t npoints = 1 << 17, ndim = 2;
+   auto data = MakeData(npoints, ndim, 4);
+   auto sequential = MakeTree(data, 10);
+   ROOT::EnableImplicitMT(4);
+   auto parallel = MakeTree(data, 10);
+   ROOT::DisableImplicitMT();
+
+   ASSERT_EQ(sequential->GetNNodes(), parallel->GetNNodes());
+   for (Int_t inode = 0; inode < sequential->GetNNodes(); ++inode) {
+      EXPECT_EQ(sequential->GetNodeAxis(inode), parallel->GetNodeAxis(inode));
+      EXPECT_EQ(sequential->GetNodeValue(inode), parallel->GetNodeValue(inode));
+   }
+   EXPECT_TRUE(std::equal(sequential->GetIndPoints(), sequential->GetIndPoints() + npoints, parallel->GetIndPoints()));
+}
+#endif
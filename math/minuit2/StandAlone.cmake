@@ -75,6 +75,10 @@ endif()
 add_library(Minuit2Common INTERFACE)
 add_library(Minuit2::Common ALIAS Minuit2Common)
 
+# Threads are used for the optional concurrent evaluation of numerical derivatives
+find_package(Threads REQUIRED)
+target_link_libraries(Minuit2Common INTERFACE Threads::Threads)
+
 # OpenMP support
 if(minuit2_omp)
     if(CMAKE_PROJECT_NAME STREQUAL PROJECT_NAME)
@@ -0,0 +1,31 @@
+// @(#)root/minuit2:$Id$
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2026 LCG ROOT Math team,  CERN/EP-SFT                *
+ *                                                                    *
+ **********************************************************************/
+
+#ifndef ROOT_Minuit2_MnParallelFor
+#define ROOT_Minuit2_MnParallelFor
+
+#include <functional>
+
+namespace ROOT {
+
+namespace Minuit2 {
+
+/**
+   Call func(i) for i = 0, ..., n - 1 using up to nThreads threads (the calling thread included).
+   The indices are distributed dynamically, so the calls must be independent of each other:
+   the result must not depend on the order or on the thread in which they are executed.
+   With nThreads <= 1 the calls are done sequentially in increasing order.
+   An exception thrown by func is rethrown in the calling thread once all threads are finished.
+ */
+void MnParallelFor(unsigned int n, unsigned int nThreads, const std::function<void(unsigned int)> &func);
+
+} // namespace Minuit2
+
+} // namespace ROOT
+
+#endif // ROOT_Minuit2_MnParallelFor
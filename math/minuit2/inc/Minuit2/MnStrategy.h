@@ -50,6 +50,8 @@ public:
 
    int StorageLevel() const { return fStoreLevel; }
 
+   unsigned int NumThreads() const { return fNumThreads; }
+
    bool IsLow() const { return fStrategy == 0; }
    bool IsMedium() const { return fStrategy == 1; }
    bool IsHigh() const { return fStrategy == 2; }
@@ -81,6 +83,12 @@ public:
    // 0 = store only last iterations 1 = full storage (default)
    void SetStorageLevel(unsigned int level) { fStoreLevel = level; }
 
+   // set number of threads used to evaluate the numerical derivatives (gradient and Hesse)
+   // 1 = sequential evaluation (default)
+   // n > 1 = evaluate the function calls of different parameters concurrently in n threads.
+   // This requires a thread-safe FCN, i.e. operator() must be callable concurrently.
+   void SetNumThreads(unsigned int n) { fNumThreads = n; }
+
 private:
    unsigned int fStrategy;
 
@@ -94,6 +102,7 @@ private:
    int fHessCFDG2;
    int fHessForcePosDef;
    int fStoreLevel;
+   unsigned int fNumThreads;
 };
 
 } // namespace Minuit2
@@ -23,6 +23,9 @@
 #include "Minuit2/FunctionMinimum.h"
 #include "Minuit2/MnPrint.h"
 #include "Minuit2/MPIProcess.h"
+#include "Minuit2/MnParallelFor.h"
+
+#include <vector>
 
 namespace ROOT {
 
@@ -228,15 +231,27 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
    print.Debug("Gradient is", st.Gradient().IsAnalytical() ? "analytical" : "numerical", "\n  point:", x,
                "\n  fcn  :", amin, "\n  grad :", grd, "\n  step :", gst, "\n  g2   :", g2);
 
-   for (unsigned int i = 0; i < n; i++) {
+   // result of the diagonal element calculation for one parameter
+   struct DiagonalResult {
+      bool ok;
+      double g2;
+      double grd;
+      double gst;
+      double yy;
+   };
+
+   // compute the second derivative with respect to parameter i around the point x (x(i) is restored on return)
+   auto computeDiagonal = [&](unsigned int i, MnAlgebraicVector &x, bool debug) {
+      DiagonalResult res{true, g2(i), grd(i), gst(i), yy(i)};
 
       double xtf = x(i);
       double dmin = 8. * prec.Eps2() * (std::fabs(xtf) + prec.Eps2());
-      double d = std::fabs(gst(i));
+      double d = std::fabs(res.gst);
       if (d < dmin)
          d = dmin;
 
-      print.Debug("Derivative parameter", i, "d =", d, "dmin =", dmin);
+      if (debug)
+         print.Debug("Derivative parameter", i, "d =", d, "dmin =", dmin);
 
       for (unsigned int icyc = 0; icyc < Ncycles(); icyc++) {
          double sag = 0.;
@@ -250,14 +265,15 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
             x(i) = xtf;
             sag = 0.5 * (fs1 + fs2 - 2. * amin);
 
-            print.Debug("cycle", icyc, "mul", multpy, "\tsag =", sag, "d =", d);
+            if (debug)
+               print.Debug("cycle", icyc, "mul", multpy, "\tsag =", sag, "d =", d);
 
             //  Now as F77 Minuit - check that sag is not zero
             if (sag != 0)
-               goto L30; // break
+               break;
             if (trafo.Parameter(i).HasLimits()) {
                if (d > 0.5)
-                  goto L26;
+                  break;
                d *= 10.;
                if (d > 0.5)
                   d = 0.51;
@@ -266,49 +282,77 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
             d *= 10.;
          }
 
-      L26:
-         // get parameter name for i
-         // (need separate scope for avoiding compl error when declaring name)
-         print.Warn("2nd derivative zero for parameter", trafo.Name(trafo.ExtOfInt(i)),
-                    "; MnHesse fails and will return diagonal matrix");
-
-         for (unsigned int j = 0; j < n; j++) {
-            double tmp = g2(j) < prec.Eps2() ? 1. : 1. / g2(j);
-            vhmat(j, j) = tmp < prec.Eps2() ? 1. : tmp;
+         if (sag == 0) {
+            res.ok = false;
+            return res;
          }
 
-         return MinimumState(st.Parameters(), MinimumError(vhmat, MinimumError::MnHesseFailed), st.Gradient(), st.Edm(),
-                             mfcn.NumOfCalls());
-
-      L30:
-         double g2bfor = g2(i);
-         g2(i) = 2. * sag / (d * d);
-         grd(i) = (fs1 - fs2) / (2. * d);
-         gst(i) = d;
-         dirin(i) = d;
-         yy(i) = fs1;
+         double g2bfor = res.g2;
+         res.g2 = 2. * sag / (d * d);
+         res.grd = (fs1 - fs2) / (2. * d);
+         res.gst = d;
+         res.yy = fs1;
          double dlast = d;
-         d = std::sqrt(2. * aimsag / std::fabs(g2(i)));
+         d = std::sqrt(2. * aimsag / std::fabs(res.g2));
          if (trafo.Parameter(i).HasLimits())
             d = std::min(0.5, d);
          if (d < dmin)
             d = dmin;
 
-         print.Debug("g1 =", grd(i), "g2 =", g2(i), "step =", gst(i), "d =", d, "diffd =", std::fabs(d - dlast) / d,
-                     "diffg2 =", std::fabs(g2(i) - g2bfor) / g2(i));
+         if (debug)
+            print.Debug("g1 =", res.grd, "g2 =", res.g2, "step =", res.gst, "d =", d,
+                        "diffd =", std::fabs(d - dlast) / d, "diffg2 =", std::fabs(res.g2 - g2bfor) / res.g2);
 
          // see if converged
          if (std::fabs((d - dlast) / d) < Tolerstp())
             break;
-         if (std::fabs((g2(i) - g2bfor) / g2(i)) < TolerG2())
+         if (std::fabs((res.g2 - g2bfor) / res.g2) < TolerG2())
             break;
          d = std::min(d, 10. * dlast);
          d = std::max(d, 0.1 * dlast);
       }
+      return res;
+   };
+
+   // With more than one thread (the FCN was declared thread-safe by the user) all parameters are
+   // computed concurrently first. The results are then checked in the same order as in the
+   // sequential case, only the call limit is checked after all parameters are done.
+   const unsigned int nThreads = fStrategy.NumThreads();
+   std::vector<DiagonalResult> diagonals;
+   if (nThreads > 1) {
+      diagonals.resize(n);
+      MnParallelFor(n, nThreads, [&](unsigned int i) {
+         MnAlgebraicVector xi = x;
+         diagonals[i] = computeDiagonal(i, xi, false);
+      });
+   }
+
+   for (unsigned int i = 0; i < n; i++) {
+
+      const DiagonalResult res = nThreads > 1 ? diagonals[i] : computeDiagonal(i, x, true);
+      g2(i) = res.g2;
+      grd(i) = res.grd;
+      gst(i) = res.gst;
+      dirin(i) = res.gst;
+      yy(i) = res.yy;
+
+      if (!res.ok) {
+         // get parameter name for i
+         print.Warn("2nd derivative zero for parameter", trafo.Name(trafo.ExtOfInt(i)),
+                    "; MnHesse fails and will return diagonal matrix");
+
+         for (unsigned int j = 0; j < n; j++) {
+            double tmp = g2(j) < prec.Eps2() ? 1. : 1. / g2(j);
+            vhmat(j, j) = tmp < prec.Eps2() ? 1. : tmp;
+         }
+
+         return MinimumState(st.Parameters(), MinimumError(vhmat, MinimumError::MnHesseFailed), st.Gradient(), st.Edm(),
+                             mfcn.NumOfCalls());
+      }
+
       vhmat(i, i) = g2(i);
       if (mfcn.NumOfCalls() > maxcalls) {
 
-         // std::cout<<"maxcalls " << maxcalls << " " << mfcn.NumOfCalls() << "  " <<   st.NFcn() << std::endl;
          print.Warn("Maximum number of allowed function calls exhausted; will return diagonal matrix");
 
          for (unsigned int j = 0; j < n; j++) {
@@ -335,7 +379,43 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
    // off-diagonal Elements
    // initial starting values
    bool doCentralFD = fStrategy.HessianCentralFDMixedDerivatives();
-   if (n > 0) {
+   // Mixed derivatives of row i. The point x is shifted and restored exactly like in the sequential loop
+   // below, so that it ends up in the same state. If evaluate is false only the point is updated.
+   auto computeOffDiagonalRow = [&](unsigned int i, MnAlgebraicVector &xi, bool evaluate) {
+      xi(i) += dirin(i);
+      for (unsigned int j = i + 1; j < n; j++) {
+         xi(j) += dirin(j);
+         double fs1 = evaluate ? mfcn(xi) : 0.;
+         if (!doCentralFD) {
+            if (evaluate)
+               vhmat(i, j) = (fs1 + amin - yy(i) - yy(j)) / (dirin(i) * dirin(j));
+            xi(j) -= dirin(j);
+         } else {
+            // three more function evaluations required for central fd
+            xi(i) -= dirin(i); xi(i) -= dirin(i); double fs3 = evaluate ? mfcn(xi) : 0.;
+            xi(j) -= dirin(j); xi(j) -= dirin(j); double fs4 = evaluate ? mfcn(xi) : 0.;
+            xi(i) += dirin(i); xi(i) += dirin(i); double fs2 = evaluate ? mfcn(xi) : 0.;
+            xi(j) += dirin(j);
+            if (evaluate)
+               vhmat(i, j) = (fs1 - fs2 - fs3 + fs4) / (4. * dirin(i) * dirin(j));
+         }
+      }
+      xi(i) -= dirin(i);
+   };
+
+   if (n > 1 && nThreads > 1 && MPIProcess::GetMPIGlobalSize() == 1) {
+      // Shifting a parameter back and forth is not exact in floating point, so the point at the start of
+      // each row is first computed as in the sequential loop. The rows are then evaluated concurrently,
+      // with a result that is identical to the sequential one.
+      std::vector<MnAlgebraicVector> rowStart;
+      rowStart.reserve(n - 1);
+      MnAlgebraicVector xs = x;
+      for (unsigned int i = 0; i < n - 1; i++) {
+         rowStart.push_back(xs);
+         computeOffDiagonalRow(i, xs, false);
+      }
+      MnParallelFor(n - 1, nThreads, [&](unsigned int i) { computeOffDiagonalRow(i, rowStart[i], true); });
+   } else if (n > 0) {
       MPIProcess mpiprocOffDiagonal(n * (n - 1) / 2, 0);
       unsigned int startParIndexOffDiagonal = mpiprocOffDiagonal.StartElementIndex();
       unsigned int endParIndexOffDiagonal = mpiprocOffDiagonal.EndElementIndex();
@@ -0,0 +1,62 @@
+// @(#)root/minuit2:$Id$
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2026 LCG ROOT Math team,  CERN/EP-SFT                *
+ *                                                                    *
+ **********************************************************************/
+
+#include "Minuit2/MnParallelFor.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ROOT {
+
+namespace Minuit2 {
+
+void MnParallelFor(unsigned int n, unsigned int nThreads, const std::function<void(unsigned int)> &func)
+{
+   nThreads = std::min(nThreads, n);
+   if (nThreads <= 1) {
+      for (unsigned int i = 0; i < n; ++i)
+         func(i);
+      return;
+   }
+
+   // std::thread is used instead of a ROOT thread pool, since Minuit2 can be built standalone
+   std::atomic<unsigned int> next{0};
+   std::exception_ptr error;
+   std::mutex errorMutex;
+
+   auto worker = [&]() {
+      try {
+         for (unsigned int i = next++; i < n; i = next++)
+            func(i);
+      } catch (...) {
+         std::lock_guard<std::mutex> lock(errorMutex);
+         if (!error)
+            error = std::current_exception();
+         next = n;
+      }
+   };
+
+   std::vector<std::thread> threads;
+   threads.reserve(nThreads - 1);
+   for (unsigned int i = 1; i < nThreads; ++i)
+      threads.emplace_back(worker);
+   worker();
+   for (auto &thread : threads)
+      thread.join();
+
+   if (error)
+      std::rethrow_exception(error);
+}
+
+} // namespace Minuit2
+
+} // namespace ROOT
@@ -16,6 +16,7 @@
 #include "Minuit2/FunctionGradient.h"
 #include "Minuit2/MnStrategy.h"
 #include "Minuit2/MnPrint.h"
+#include "Minuit2/MnParallelFor.h"
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -97,42 +98,15 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
 
    print.Debug("Calculating gradient around function value", fcnmin, "\n\t at point", par.Vec());
 
-#ifndef _OPENMP
-
-   MPIProcess mpiproc(n, 0);
-
-   // for serial execution this can be outside the loop
-   MnAlgebraicVector x = par.Vec();
-
-   unsigned int startElementIndex = mpiproc.StartElementIndex();
-   unsigned int endElementIndex = mpiproc.EndElementIndex();
-
-   for (unsigned int i = startElementIndex; i < endElementIndex; i++) {
-
-#else
-
-   // parallelize this loop using OpenMP
-//#define N_PARALLEL_PAR 5
-#pragma omp parallel
-#pragma omp for
-   //#pragma omp for schedule (static, N_PARALLEL_PAR)
-
-   for (int i = 0; i < int(n); i++) {
-
-#endif
-
-#ifdef _OPENMP
-      // create in loop since each thread will use its own copy
-      MnAlgebraicVector x = par.Vec();
-#endif
-
+   // compute the derivative with respect to parameter i around the point x (x(i) is restored on return),
+   // the per-cycle trace is printed only if trace is true
+   auto computeDerivative = [&](unsigned int i, MnAlgebraicVector &x, bool trace) {
       double xtf = x(i);
       double epspri = eps2 + std::fabs(grd(i) * eps2);
       double stepb4 = 0.;
       for (unsigned int j = 0; j < ncycle; j++) {
          double optstp = std::sqrt(dfmin / (std::fabs(g2(i)) + epspri));
          double step = std::max(optstp, std::fabs(0.1 * gstep(i)));
-         //       std::cout<<"step: "<<step;
          if (Trafo().Parameter(Trafo().ExtOfInt(i)).HasLimits()) {
             if (step > 0.5)
                step = 0.5;
@@ -140,24 +114,14 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
          double stpmax = 10. * std::fabs(gstep(i));
          if (step > stpmax)
             step = stpmax;
-         //       std::cout<<" "<<step;
          double stpmin = std::max(vrysml, 8. * std::fabs(eps2 * x(i)));
          if (step < stpmin)
             step = stpmin;
-         //       std::cout<<" "<<step<<std::endl;
-         //       std::cout<<"step: "<<step<<std::endl;
          if (std::fabs((step - stepb4) / step) < StepTolerance()) {
-            //    std::cout<<"(step-stepb4)/step"<<std::endl;
-            //    std::cout<<"j= "<<j<<std::endl;
-            //    std::cout<<"step= "<<step<<std::endl;
             break;
          }
          gstep(i) = step;
          stepb4 = step;
-         //       MnAlgebraicVector pstep(n);
-         //       pstep(i) = step;
-         //       double fs1 = Fcn()(pstate + pstep);
-         //       double fs2 = Fcn()(pstate - pstep);
 
          x(i) = xtf + step;
          double fs1 = Fcn()(x);
@@ -169,56 +133,78 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
          grd(i) = 0.5 * (fs1 - fs2) / step;
          g2(i) = (fs1 + fs2 - 2. * fcnmin) / step / step;
 
+         if (trace) {
 #ifdef _OPENMP
 #pragma omp critical
 #endif
-         {
+            {
 #ifdef _OPENMP
-            // must create thread-local MnPrint instances when printing inside threads
-            MnPrint printtl("Numerical2PGradientCalculator[OpenMP]");
-#endif
-            if (i == 0 && j == 0) {
-#ifdef _OPENMP
-               printtl.Trace([&](std::ostream &os) {
+               // must create thread-local MnPrint instances when printing inside threads
+               MnPrint printtl("Numerical2PGradientCalculator[OpenMP]");
 #else
-               print.Trace([&](std::ostream &os) {
+               MnPrint &printtl = print;
 #endif
-                  os << std::setw(10) << "parameter" << std::setw(6) << "cycle" << std::setw(15) << "x" << std::setw(15)
-                     << "step" << std::setw(15) << "f1" << std::setw(15) << "f2" << std::setw(15) << "grd"
-                     << std::setw(15) << "g2" << std::endl;
+               if (i == 0 && j == 0) {
+                  printtl.Trace([&](std::ostream &os) {
+                     os << std::setw(10) << "parameter" << std::setw(6) << "cycle" << std::setw(15) << "x"
+                        << std::setw(15) << "step" << std::setw(15) << "f1" << std::setw(15) << "f2" << std::setw(15)
+                        << "grd" << std::setw(15) << "g2" << std::endl;
+                  });
+               }
+               printtl.Trace([&](std::ostream &os) {
+                  const int pr = os.precision(13);
+                  const int iext = Trafo().ExtOfInt(i);
+                  os << std::setw(10) << Trafo().Name(iext) << std::setw(5) << j << "  " << x(i) << " " << step << " "
+                     << fs1 << " " << fs2 << " " << grd(i) << " " << g2(i) << std::endl;
+                  os.precision(pr);
                });
             }
-#ifdef _OPENMP
-            printtl.Trace([&](std::ostream &os) {
-#else
-            print.Trace([&](std::ostream &os) {
-#endif
-               const int pr = os.precision(13);
-               const int iext = Trafo().ExtOfInt(i);
-               os << std::setw(10) << Trafo().Name(iext) << std::setw(5) << j << "  " << x(i) << " " << step << " "
-                  << fs1 << " " << fs2 << " " << grd(i) << " " << g2(i) << std::endl;
-               os.precision(pr);
-            });
          }
 
          if (std::fabs(grdb4 - grd(i)) / (std::fabs(grd(i)) + dfmin / step) < GradTolerance()) {
-            //    std::cout<<"j= "<<j<<std::endl;
-            //    std::cout<<"step= "<<step<<std::endl;
-            //    std::cout<<"fs1, fs2: "<<fs1<<" "<<fs2<<std::endl;
-            //    std::cout<<"fs1-fs2: "<<fs1-fs2<<std::endl;
             break;
          }
       }
+   };
+
+#ifndef _OPENMP
 
-      //     vgrd(i) = grd;
-      //     vgrd2(i) = g2;
-      //     vgstp(i) = gstep;
+   MPIProcess mpiproc(n, 0);
+
+   if (Strategy().NumThreads() > 1 && mpiproc.GetMPISize() == 1) {
+      // The FCN was declared thread-safe by the user: the parameters are processed concurrently.
+      // Each parameter only writes its own elements, so the result does not depend on the number of threads.
+      MnParallelFor(n, Strategy().NumThreads(), [&](unsigned int i) {
+         MnAlgebraicVector x = par.Vec();
+         computeDerivative(i, x, false);
+      });
+   } else {
+      // for serial execution this can be outside the loop
+      MnAlgebraicVector x = par.Vec();
+
+      unsigned int startElementIndex = mpiproc.StartElementIndex();
+      unsigned int endElementIndex = mpiproc.EndElementIndex();
+
+      for (unsigned int i = startElementIndex; i < endElementIndex; i++) {
+         computeDerivative(i, x, true);
+      }
    }
 
-#ifndef _OPENMP
    mpiproc.SyncVector(grd);
    mpiproc.SyncVector(g2);
    mpiproc.SyncVector(gstep);
+
+#else
+
+   // parallelize this loop using OpenMP
+#pragma omp parallel
+#pragma omp for
+   for (int i = 0; i < int(n); i++) {
+      // create in loop since each thread will use its own copy
+      MnAlgebraicVector x = par.Vec();
+      computeDerivative(i, x, true);
+   }
+
 #endif
 
    // print after parallel processing to avoid synchronization issues
@@ -18,6 +18,10 @@ namespace Minuit2 {
 /** Inverts a symmetric matrix. Matrix is first scaled to have all ones on
     the diagonal (equivalent to change of units) but no pivoting is done
     since matrix is positive-definite.
+
+    The packed storage of the upper triangle is accessed directly, column by
+    column, so that the inner loops run over contiguous memory and can be
+    vectorized. The operations are the same as in the element-wise version.
  */
 
 int mnvert(MnAlgebraicSymMatrix &a)
@@ -28,47 +32,55 @@ int mnvert(MnAlgebraicSymMatrix &a)
    MnAlgebraicVector q(nrow);
    MnAlgebraicVector pp(nrow);
 
+   // element (i, j) with i <= j is stored at ap[i + j * (j + 1) / 2]
+   double *ap = a.Data();
+   auto column = [ap](unsigned int j) { return ap + j * (j + 1) / 2; };
+
    for (unsigned int i = 0; i < nrow; i++) {
-      double si = a(i, i);
+      double si = column(i)[i];
       if (si < 0.)
          return 1;
       s(i) = 1. / std::sqrt(si);
    }
 
-   for (unsigned int i = 0; i < nrow; i++)
-      for (unsigned int j = i; j < nrow; j++)
-         a(i, j) *= (s(i) * s(j));
+   for (unsigned int j = 0; j < nrow; j++) {
+      double *col = column(j);
+      for (unsigned int i = 0; i <= j; i++)
+         col[i] *= (s(i) * s(j));
+   }
 
-   for (unsigned i = 0; i < nrow; i++) {
-      unsigned int k = i;
-      if (a(k, k) == 0.)
+   const double *ppData = pp.Data();
+   for (unsigned int k = 0; k < nrow; k++) {
+      double *colk = column(k);
+      if (colk[k] == 0.)
          return 1;
-      q(k) = 1. / a(k, k);
+      q(k) = 1. / colk[k];
       pp(k) = 1.;
-      a(k, k) = 0.;
-      unsigned int kp1 = k + 1;
-      if (k != 0) {
-         for (unsigned int j = 0; j < k; j++) {
-            pp(j) = a(j, k);
-            q(j) = a(j, k) * q(k);
-            a(j, k) = 0.;
-         }
+      colk[k] = 0.;
+      for (unsigned int j = 0; j < k; j++) {
+         pp(j) = colk[j];
+         q(j) = colk[j] * q(k);
+         colk[j] = 0.;
       }
-      if (k != nrow - 1) {
-         for (unsigned int j = kp1; j < nrow; j++) {
-            pp(j) = a(k, j);
-            q(j) = -a(k, j) * q(k);
-            a(k, j) = 0.;
-         }
+      for (unsigned int j = k + 1; j < nrow; j++) {
+         double &akj = column(j)[k];
+         pp(j) = akj;
+         q(j) = -akj * q(k);
+         akj = 0.;
+      }
+      for (unsigned int m = 0; m < nrow; m++) {
+         double *col = column(m);
+         const double qm = q(m);
+         for (unsigned int j = 0; j <= m; j++)
+            col[j] += (ppData[j] * qm);
       }
-      for (unsigned int j = 0; j < nrow; j++)
-         for (k = j; k < nrow; k++)
-            a(j, k) += (pp(j) * q(k));
    }
 
-   for (unsigned int j = 0; j < nrow; j++)
-      for (unsigned int k = j; k < nrow; k++)
-         a(j, k) *= (s(j) * s(k));
+   for (unsigned int j = 0; j < nrow; j++) {
+      double *col = column(j);
+      for (unsigned int i = 0; i <= j; i++)
+         col[i] *= (s(i) * s(j));
+   }
 
    return 0;
 }
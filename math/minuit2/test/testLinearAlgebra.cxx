@@ -0,0 +1,142 @@
+// @(#)root/minuit2:$Id$
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2026 LCG ROOT Math team,  CERN/EP-SFT                *
+ *                                                                    *
+ **********************************************************************/
+
+// test the matrix inversion (mnvert) and the eigenvalue computation (mneigen)
+// on random matrices of the size of fits with many parameters
+
+#include "Minuit2/MnEigen.h"
+#include "Minuit2/MnMatrix.h"
+#include "Minuit2/MnUserCovariance.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace ROOT::Minuit2;
+
+// invert a random positive-definite matrix and check that A * A^-1 = I
+int testInversion(unsigned int n)
+{
+   std::mt19937 gen(4357);
+   std::uniform_real_distribution<double> dist(-1., 1.);
+
+   // A = M M^T / n + I is positive definite and well conditioned
+   std::vector<double> m(n * n);
+   for (auto &x : m)
+      x = dist(gen);
+   MnAlgebraicSymMatrix a(n);
+   for (unsigned int i = 0; i < n; ++i) {
+      for (unsigned int j = 0; j <= i; ++j) {
+         double s = 0.;
+         for (unsigned int k = 0; k < n; ++k)
+            s += m[i * n + k] * m[j * n + k];
+         a(i, j) = s / n + (i == j ? 1. : 0.);
+      }
+   }
+
+   MnAlgebraicSymMatrix ainv = a;
+   if (Invert(ainv) != 0) {
+      std::cerr << "testInversion: inversion of a " << n << "x" << n << " matrix failed" << std::endl;
+      return 1;
+   }
+
+   double maxDiff = 0.;
+   for (unsigned int i = 0; i < n; ++i) {
+      for (unsigned int j = 0; j < n; ++j) {
+         double s = 0.;
+         for (unsigned int k = 0; k < n; ++k)
+            s += a(i, k) * ainv(k, j);
+         maxDiff = std::max(maxDiff, std::abs(s - (i == j ? 1. : 0.)));
+      }
+   }
+   if (maxDiff > 1.E-10) {
+      std::cerr << "testInversion: A * A^-1 differs from the identity by " << maxDiff << std::endl;
+      return 1;
+   }
+   return 0;
+}
+
+// compute the eigenvalues of a matrix with known eigenvalues and of a random
+// indefinite matrix, where the trace and the Frobenius norm are checked
+int testEigenvalues(unsigned int n)
+{
+   int iret = 0;
+
+   // tridiagonal matrix with the eigenvalues 2 - sqrt(2), 2 and 2 + sqrt(2)
+   MnUserCovariance tri(3);
+   for (unsigned int i = 0; i < 3; ++i)
+      tri(i, i) = 2.;
+   tri(0, 1) = 1.;
+   tri(1, 2) = 1.;
+   std::vector<double> eigen = MnEigen()(tri);
+   std::sort(eigen.begin(), eigen.end());
+   const double ref[3] = {2. - std::sqrt(2.), 2., 2. + std::sqrt(2.)};
+   for (unsigned int i = 0; i < 3; ++i) {
+      if (std::abs(eigen[i] - ref[i]) > 1.E-12) {
+         std::cerr << "testEigenvalues: eigenvalue " << i << " is " << eigen[i] << " instead of " << ref[i]
+                   << std::endl;
+         iret = 1;
+      }
+   }
+
+   std::mt19937 gen(65539);
+   std::uniform_real_distribution<double> dist(-1., 1.);
+   MnUserCovariance a(n);
+   double trace = 0.;
+   double norm2 = 0.;
+   for (unsigned int i = 0; i < n; ++i) {
+      for (unsigned int j = 0; j <= i; ++j) {
+         a(i, j) = dist(gen);
+         norm2 += (i == j ? 1. : 2.) * a(i, j) * a(i, j);
+      }
+      trace += a(i, i);
+   }
+
+   eigen = MnEigen()(a);
+   if (eigen.size() != n) {
+      std::cerr << "testEigenvalues: got " << eigen.size() << " eigenvalues instead of " << n << std::endl;
+      return 1;
+   }
+   double sum = 0.;
+   double sum2 = 0.;
+   for (double x : eigen) {
+      sum += x;
+      sum2 += x * x;
+   }
+   if (std::abs(sum - trace) > 1.E-10 * n) {
+      std::cerr << "testEigenvalues: sum of the eigenvalues " << sum << " differs from the trace " << trace
+                << std::endl;
+      iret = 1;
+   }
+   if (std::abs(sum2 - norm2) > 1.E-10 * norm2) {
+      std::cerr << "testEigenvalues: sum of the squared eigenvalues " << sum2 << " differs from the norm " << norm2
+                << std::endl;
+      iret = 1;
+   }
+   // the random matrix is indefinite
+   auto minmax = std::minmax_element(eigen.begin(), eigen.end());
+   if (!(*minmax.first < 0. && *minmax.second > 0.)) {
+      std::cerr << "testEigenvalues: expected eigenvalues of both signs, got the range [" << *minmax.first << ", "
+                << *minmax.second << "]" << std::endl;
+      iret = 1;
+   }
+   return iret;
+}
+
+int main()
+{
+   int iret = 0;
+   iret |= testInversion(200);
+   iret |= testEigenvalues(200);
+
+   if (iret == 0)
+      std::cout << "testLinearAlgebra: OK" << std::endl;
+   return iret;
+}
@@ -0,0 +1,110 @@
+// @(#)root/minuit2:$Id$
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2026 LCG ROOT Math team,  CERN/EP-SFT                *
+ *                                                                    *
+ **********************************************************************/
+
+// test that the numerical gradient and Hessian computed concurrently with
+// MnStrategy::SetNumThreads give the same result as the sequential computation
+
+#include "Minuit2/FCNBase.h"
+#include "Minuit2/FunctionMinimum.h"
+#include "Minuit2/MnHesse.h"
+#include "Minuit2/MnMigrad.h"
+#include "Minuit2/MnStrategy.h"
+#include "Minuit2/MnUserParameterState.h"
+#include "Minuit2/MnUserParameters.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace ROOT::Minuit2;
+
+// thread-safe function with correlated parameters
+class CorrelatedQuarticFcn : public FCNBase {
+public:
+   double operator()(const std::vector<double> &par) const override
+   {
+      double f = 0.;
+      for (unsigned int i = 0; i < par.size(); ++i) {
+         const double d = par[i] - 0.1 * i;
+         f += (i + 1) * d * d + 0.3 * d * d * d * d;
+         if (i > 0)
+            f += 0.2 * d * (par[i - 1] - 0.1 * (i - 1));
+      }
+      return f;
+   }
+   double Up() const override { return 1.; }
+};
+
+int main()
+{
+   const unsigned int npar = 30;
+   MnUserParameters upar;
+   for (unsigned int i = 0; i < npar; ++i) {
+      // some parameters with limits to test the transformation
+      if (i % 5 == 0)
+         upar.Add("p" + std::to_string(i), 1., 0.1, -5., 5.);
+      else
+         upar.Add("p" + std::to_string(i), 1., 0.1);
+   }
+
+   CorrelatedQuarticFcn fcn;
+   int iret = 0;
+
+   for (unsigned int centralFD = 0; centralFD < 2; ++centralFD) {
+      std::vector<double> refValues;
+      std::vector<double> refCov;
+      for (unsigned int nThreads : {1u, 2u, 4u}) {
+         MnStrategy strategy(1);
+         strategy.SetNumThreads(nThreads);
+         strategy.SetHessianCentralFDMixedDerivatives(centralFD);
+
+         MnMigrad migrad(fcn, upar, strategy);
+         FunctionMinimum min = migrad();
+         MnHesse hesse(strategy);
+         MnUserParameterState state = hesse(fcn, min.UserState().Params(), min.UserState().Errors());
+
+         if (!min.IsValid() || !state.HasCovariance()) {
+            std::cerr << "testNumThreads: fit with " << nThreads << " threads failed" << std::endl;
+            iret = 1;
+            continue;
+         }
+
+         std::vector<double> values = min.UserState().Params();
+         std::vector<double> cov;
+         for (unsigned int i = 0; i < npar; ++i)
+            for (unsigned int j = 0; j <= i; ++j)
+               cov.push_back(state.Covariance()(i, j));
+
+         if (nThreads == 1) {
+            refValues = values;
+            refCov = cov;
+            continue;
+         }
+
+         // the results must be identical, not only compatible
+         for (unsigned int i = 0; i < npar; ++i) {
+            if (values[i] != refValues[i]) {
+               std::cerr << "testNumThreads: parameter " << i << " differs with " << nThreads
+                         << " threads: " << values[i] << " != " << refValues[i] << std::endl;
+               iret = 1;
+            }
+         }
+         for (unsigned int k = 0; k < cov.size(); ++k) {
+            if (cov[k] != refCov[k]) {
+               std::cerr << "testNumThreads: covariance element " << k << " differs with " << nThreads
+                         << " threads: " << cov[k] << " != " << refCov[k] << std::endl;
+               iret = 1;
+            }
+         }
+      }
+   }
+
+   if (iret == 0)
+      std::cout << "testNumThreads: OK" << std::endl;
+   return iret;
+}
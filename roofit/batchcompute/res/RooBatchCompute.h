@@ -57,9 +57,14 @@ public:
    bool useCuda() const { return _cudaStream != nullptr; }
    void setCudaStream(CudaInterface::CudaStream *cudaStream) { _cudaStream = cudaStream; }
    CudaInterface::CudaStream *cudaStream() const { return _cudaStream; }
+   /// Whether CPU computations may be split in chunks of events that are
+   /// processed on the ROOT implicit multi-threading pool.
+   bool useMultiThreading() const { return _useMultiThreading; }
+   void setUseMultiThreading(bool flag) { _useMultiThreading = flag; }
 
 private:
    CudaInterface::CudaStream *_cudaStream = nullptr;
+   bool _useMultiThreading = false;
 };
 
 enum class Architecture { AVX512, AVX2, AVX, SSE4, GENERIC, CUDA };
@@ -91,6 +96,7 @@ enum Computer {
    NegativeLogarithms,
    NormalizedPdf,
    Novosibirsk,
+   PiecewiseInterpolation,
    Poisson,
    Polynomial,
    Power,
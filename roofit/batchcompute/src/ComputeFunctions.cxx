@@ -705,6 +705,81 @@ __rooglobal__ void computeNovosibirsk(Batches &batches)
       batches.output[i] = fast_exp(batches.output[i]);
 }
 
+/* Actual computation of PiecewiseInterpolation::evaluate(), for the
+ * interpolation codes 0 to 4: the nominal values in batches.args[0] are
+ * shifted by the interpolation of each parameter p between the low and high
+ * variations in batches.args[1 + 2 * p] and batches.args[2 + 2 * p].
+ * batches.extra holds the positive-definite flag, then the interpolation code
+ * and the value of each parameter. All parameters are applied to a block of
+ * bins before moving to the next block, so the block stays in the cache.
+ */
+__rooglobal__ void computePiecewiseInterpolation(Batches &batches)
+{
+   Batch nominal = batches.args[0];
+   const bool positiveDefinite = batches.extra[0];
+   const std::size_t nParams = (batches.nExtra - 1) / 2;
+
+   for (size_t i = BEGIN; i < batches.nEvents; i += STEP) {
+      batches.output[i] = nominal[i];
+   }
+
+   for (std::size_t p = 0; p < nParams; ++p) {
+      Batch low = batches.args[1 + 2 * p];
+      Batch high = batches.args[2 + 2 * p];
+      const int code = batches.extra[1 + 2 * p];
+      const double x = batches.extra[2 + 2 * p];
+
+      if (code == 0) {
+         // piece-wise linear
+         for (size_t i = BEGIN; i < batches.nEvents; i += STEP) {
+            batches.output[i] += x > 0 ? x * (high[i] - nominal[i]) : x * (nominal[i] - low[i]);
+         }
+      } else if (code == 1) {
+         // piece-wise log
+         for (size_t i = BEGIN; i < batches.nEvents; i += STEP) {
+            const double mod = x >= 0 ? std::pow(high[i] / nominal[i], +x) : std::pow(low[i] / nominal[i], -x);
+            batches.output[i] += batches.output[i] * (mod - 1);
+         }
+      } else if (code == 2 || code == 3) {
+         // parabolic with linear extrapolation
+         for (size_t i = BEGIN; i < batches.nEvents; i += STEP) {
+            const double a = 0.5 * (high[i] + low[i]) - nominal[i];
+            const double b = 0.5 * (high[i] - low[i]);
+            if (x > 1) {
+               batches.output[i] += (2 * a + b) * (x - 1) + high[i] - nominal[i];
+            } else if (x < -1) {
+               batches.output[i] += -1 * (2 * a - b) * (x + 1) + low[i] - nominal[i];
+            } else {
+               batches.output[i] += a * (x * x) + b * x + 0;
+            }
+         }
+      } else {
+         // 6th order polynomial with linear extrapolation
+         const double t = x;
+         const double poly = 15 + t * t * (-10 + t * t * 3);
+         for (size_t i = BEGIN; i < batches.nEvents; i += STEP) {
+            const double epsPlus = high[i] - nominal[i];
+            const double epsMinus = nominal[i] - low[i];
+            if (x >= 1) {
+               batches.output[i] += x * epsPlus;
+            } else if (x <= -1) {
+               batches.output[i] += x * epsMinus;
+            } else {
+               const double S = 0.5 * (epsPlus + epsMinus);
+               const double A = 0.0625 * (epsPlus - epsMinus);
+               batches.output[i] += x * (S + t * A * poly);
+            }
+         }
+      }
+   }
+
+   if (positiveDefinite) {
+      for (size_t i = BEGIN; i < batches.nEvents; i += STEP) {
+         batches.output[i] = batches.output[i] < 0. ? 0. : batches.output[i];
+      }
+   }
+}
+
 __rooglobal__ void computePoisson(Batches &batches)
 {
    Batch x = batches.args[0];
@@ -946,6 +1021,7 @@ std::vector<void (*)(Batches &)> getFunctions()
            computeNegativeLogarithms,
            computeNormalizedPdf,
            computeNovosibirsk,
+           computePiecewiseInterpolation,
            computePoisson,
            computePolynomial,
            computePower,
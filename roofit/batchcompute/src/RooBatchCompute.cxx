@@ -26,7 +26,9 @@ This file contains the code for cpu computations using the RooBatchCompute libra
 #include <ROOT/RConfig.hxx>
 
 #ifdef ROOBATCHCOMPUTE_USE_IMT
-#include <ROOT/TExecutor.hxx>
+#include <ROOT/TSeq.hxx>
+#include <ROOT/TThreadExecutor.hxx>
+#include <TROOT.h>
 #endif
 
 #include <Math/Util.h>
@@ -75,6 +77,30 @@ inline void advance(Batches &batches, std::size_t nEvents)
    batches.output += nEvents;
 }
 
+/// Number of events in the chunks that multi-threaded computations are split
+/// into. It must not depend on the number of threads: the reductions add up
+/// the partial sums of the chunks in order, so their results are the same for
+/// any number of threads.
+constexpr std::size_t nEventsPerChunk = 16 * 1024;
+
+/// Call `task(iChunk)` for every chunk of `nEvents` events, in parallel if
+/// implicit multi-threading is enabled.
+template <class Task>
+void forEachChunk(std::size_t nEvents, Task &&task)
+{
+   const std::size_t nChunks = nEvents / nEventsPerChunk + (nEvents % nEventsPerChunk > 0);
+#ifdef ROOBATCHCOMPUTE_USE_IMT
+   if (nChunks > 1 && ROOT::IsImplicitMTEnabled()) {
+      ROOT::TThreadExecutor ex;
+      ex.Foreach([&](std::size_t iChunk) { task(iChunk); }, ROOT::TSeq<std::size_t>(nChunks));
+      return;
+   }
+#endif
+   for (std::size_t iChunk = 0; iChunk < nChunks; ++iChunk) {
+      task(iChunk);
+   }
+}
+
 } // namespace
 
 std::vector<void (*)(Batches &)> getFunctions();
@@ -125,117 +151,57 @@ public:
    bool cudaStreamIsActive(CudaInterface::CudaStream *) const override { throw std::bad_function_call(); }
 
 private:
-#ifdef ROOBATCHCOMPUTE_USE_IMT
-   void computeIMT(Computer computer, std::span<double> output, VarSpan vars, ArgSpan extraArgs);
-#endif
+   void computeRange(Computer computer, std::span<double> output, VarSpan vars, ArgSpan extraArgs, std::size_t begin,
+                     std::size_t end) const;
 
    const std::vector<void (*)(Batches &)> _computeFunctions;
 };
 
-#ifdef ROOBATCHCOMPUTE_USE_IMT
-void RooBatchComputeClass::computeIMT(Computer computer, std::span<double> output, VarSpan vars, ArgSpan extraArgs)
+/// Compute the values of the events in the range [begin, end) of the output.
+void RooBatchComputeClass::computeRange(Computer computer, std::span<double> output, VarSpan vars, ArgSpan extraArgs,
+                                        std::size_t begin, std::size_t end) const
 {
-   std::size_t nEvents = output.size();
-
-   if (nEvents == 0)
-      return;
-   ROOT::Internal::TExecutor ex;
-   std::size_t nThreads = ex.GetPoolSize();
-
-   std::size_t nEventsPerThread = nEvents / nThreads + (nEvents % nThreads > 0);
-
-   // Reset the number of threads to the number we actually need given nEventsPerThread
-   nThreads = nEvents / nEventsPerThread + (nEvents % nEventsPerThread > 0);
-
-   auto task = [&](std::size_t idx) -> int {
-      // Fill a std::vector<Batches> with the same object and with ~nEvents/nThreads
-      // Then advance every object but the first to split the work between threads
-      Batches batches;
-      std::vector<Batch> arrays(vars.size());
-      fillBatches(batches, output.data(), nEventsPerThread, vars.size(), extraArgs);
-      fillArrays(arrays, vars, nEvents);
-      batches.args = arrays.data();
-      advance(batches, batches.nEvents * idx);
-
-      // Set the number of events of the last Batches object as the remaining events
-      if (idx == nThreads - 1) {
-         batches.nEvents = nEvents - idx * batches.nEvents;
-      }
+   Batches batches;
+   std::vector<Batch> arrays(vars.size());
+   fillBatches(batches, output.data(), output.size(), vars.size(), extraArgs);
+   fillArrays(arrays, vars, output.size());
+   batches.args = arrays.data();
+   advance(batches, begin);
 
-      std::size_t events = batches.nEvents;
-      batches.nEvents = bufferSize;
-      while (events > bufferSize) {
-         _computeFunctions[computer](batches);
-         advance(batches, bufferSize);
-         events -= bufferSize;
-      }
-      batches.nEvents = events;
+   std::size_t events = end - begin;
+   batches.nEvents = bufferSize;
+   while (events > bufferSize) {
       _computeFunctions[computer](batches);
-      return 0;
-   };
-
-   std::vector<std::size_t> indices(nThreads);
-   for (unsigned int i = 1; i < nThreads; i++) {
-      indices[i] = i;
+      advance(batches, bufferSize);
+      events -= bufferSize;
    }
-   ex.Map(task, indices);
+   batches.nEvents = events;
+   _computeFunctions[computer](batches);
 }
-#endif
 
 /** Compute multiple values using optimized functions.
 This method creates a Batches object and passes it to the correct compute function.
-In case Implicit Multithreading is enabled, the events to be processed are equally
-divided among the tasks to be generated and computed in parallel.
+If multi-threading is requested in the configuration and implicit multi-threading is
+enabled, the events are split in chunks that are computed in parallel.
+\param cfg The configuration of the node that is computed.
 \param computer An enum specifying the compute function to be used.
 \param output The array where the computation results are stored.
 \param vars A std::span containing pointers to the variables involved in the computation.
 \param extraArgs An optional std::span containing extra double values that may participate in the computation. **/
-void RooBatchComputeClass::compute(Config const &, Computer computer, std::span<double> output, VarSpan vars,
+void RooBatchComputeClass::compute(Config const &cfg, Computer computer, std::span<double> output, VarSpan vars,
                                    ArgSpan extraArgs)
 {
-   // In the original implementation of this library, the evaluation was done
-   // multi-threaded in implicit multi-threading was enabled in ROOT with
-   // ROOT::EnableImplicitMT().
-   //
-   // However, this multithreaded mode was not carefully validated and is
-   // therefore not production ready. One would first have to study the
-   // overhead for different numbers of cores, number of events, and model
-   // complexity. The, we should only consider implicit multithreading here if
-   // there is no performance penalty for any scenario, to not surprise the
-   // users with unexpected slowdows!
-   //
-   // Note that the priority of investigating this is not high, because RooFit
-   // R & D efforts currently go in the direction of parallelization at the
-   // level of the gradient components, or achieving single-threaded speedup
-   // with automatic differentiation. Furthermore, the single-threaded
-   // performance of the new CPU evaluation backend with the RooBatchCompute
-   // library, is generally much faster than the legacy evaluation backend
-   // already, even if the latter uses multi-threading.
-#ifdef ROOBATCHCOMPUTE_USE_IMT
-   if (ROOT::IsImplicitMTEnabled()) {
-      computeIMT(computer, output, vars, extraArgs);
-   }
-#endif
-
-   std::size_t nEvents = output.size();
-
-   // Fill a std::vector<Batches> with the same object and with ~nEvents/nThreads
-   // Then advance every object but the first to split the work between threads
-   Batches batches;
-   std::vector<Batch> arrays(vars.size());
-   fillBatches(batches, output.data(), nEvents, vars.size(), extraArgs);
-   fillArrays(arrays, vars, nEvents);
-   batches.args = arrays.data();
-
-   std::size_t events = batches.nEvents;
-   batches.nEvents = bufferSize;
-   while (events > bufferSize) {
-      _computeFunctions[computer](batches);
-      advance(batches, bufferSize);
-      events -= bufferSize;
+   // Multi-threading is only used if the caller asks for it, because the
+   // overhead is only worth it for large datasets. The RooFit::Evaluator
+   // requests it if implicit multi-threading is enabled.
+   if (cfg.useMultiThreading() && output.size() > nEventsPerChunk) {
+      forEachChunk(output.size(), [&](std::size_t iChunk) {
+         const std::size_t begin = iChunk * nEventsPerChunk;
+         computeRange(computer, output, vars, extraArgs, begin, std::min(begin + nEventsPerChunk, output.size()));
+      });
+      return;
    }
-   batches.nEvents = events;
-   _computeFunctions[computer](batches);
+   computeRange(computer, output, vars, extraArgs, 0, output.size());
 }
 
 namespace {
@@ -259,23 +225,22 @@ inline std::pair<double, double> getLog(double prob, ReduceNLLOutput &out)
    return {std::log(prob), 0.0};
 }
 
-} // namespace
-
-double RooBatchComputeClass::reduceSum(Config const &, InputArr input, size_t n)
-{
-   return ROOT::Math::KahanSum<double, 4u>::Accumulate(input, input + n).Sum();
-}
-
-ReduceNLLOutput RooBatchComputeClass::reduceNLL(Config const &, std::span<const double> probas,
-                                                std::span<const double> weights, std::span<const double> offsetProbas)
-{
-   ReduceNLLOutput out;
-
+/// Partial result of the NLL reduction over a range of events.
+struct NLLPartialSum {
+   ROOT::Math::KahanSum<double> nllSum;
    double badness = 0.0;
+   ReduceNLLOutput out;
+};
 
-   ROOT::Math::KahanSum<double> nllSum;
+/// Add the NLL terms of the events in the range [begin, end) to a partial sum.
+void accumulateNLL(NLLPartialSum &partial, std::span<const double> probas, std::span<const double> weights,
+                   std::span<const double> offsetProbas, std::size_t begin, std::size_t end)
+{
+   ReduceNLLOutput &out = partial.out;
+   double &badness = partial.badness;
+   ROOT::Math::KahanSum<double> &nllSum = partial.nllSum;
 
-   for (std::size_t i = 0; i < probas.size(); ++i) {
+   for (std::size_t i = begin; i < end; ++i) {
 
       const double eventWeight = weights.size() > 1 ? weights[i] : weights[0];
 
@@ -294,9 +259,61 @@ ReduceNLLOutput RooBatchComputeClass::reduceNLL(Config const &, std::span<const
 
       nllSum.Add(term);
    }
+}
+
+} // namespace
+
+/// Sum of the input values. With multi-threading, the partial sums of fixed-size
+/// chunks are added in order, so the result doesn't depend on the number of threads.
+double RooBatchComputeClass::reduceSum(Config const &cfg, InputArr input, size_t n)
+{
+   if (!cfg.useMultiThreading()) {
+      return ROOT::Math::KahanSum<double, 4u>::Accumulate(input, input + n).Sum();
+   }
+   std::vector<ROOT::Math::KahanSum<double>> partialSums(n / nEventsPerChunk + (n % nEventsPerChunk > 0));
+   forEachChunk(n, [&](std::size_t iChunk) {
+      const std::size_t begin = iChunk * nEventsPerChunk;
+      const std::size_t end = std::min(begin + nEventsPerChunk, n);
+      partialSums[iChunk] = ROOT::Math::KahanSum<double, 4u>::Accumulate(input + begin, input + end);
+   });
+   ROOT::Math::KahanSum<double> sum;
+   for (auto const &partialSum : partialSums) {
+      sum += partialSum;
+   }
+   return sum.Sum();
+}
+
+/// Negative log-likelihood of the events, from their probabilities and weights.
+/// With multi-threading, the partial sums of fixed-size chunks are added in
+/// order, so the result doesn't depend on the number of threads.
+ReduceNLLOutput RooBatchComputeClass::reduceNLL(Config const &cfg, std::span<const double> probas,
+                                                std::span<const double> weights, std::span<const double> offsetProbas)
+{
+   NLLPartialSum total;
+
+   if (!cfg.useMultiThreading()) {
+      accumulateNLL(total, probas, weights, offsetProbas, 0, probas.size());
+   } else {
+      const std::size_t n = probas.size();
+      std::vector<NLLPartialSum> partials(n / nEventsPerChunk + (n % nEventsPerChunk > 0));
+      forEachChunk(n, [&](std::size_t iChunk) {
+         const std::size_t begin = iChunk * nEventsPerChunk;
+         accumulateNLL(partials[iChunk], probas, weights, offsetProbas, begin, std::min(begin + nEventsPerChunk, n));
+      });
+      for (auto const &partial : partials) {
+         total.nllSum += partial.nllSum;
+         total.badness += partial.badness;
+         total.out.nLargeValues += partial.out.nLargeValues;
+         total.out.nNonPositiveValues += partial.out.nNonPositiveValues;
+         total.out.nNaNValues += partial.out.nNaNValues;
+      }
+   }
+
+   ReduceNLLOutput &out = total.out;
+   const double badness = total.badness;
 
-   out.nllSum = nllSum.Sum();
-   out.nllSumCarry = nllSum.Carry();
+   out.nllSum = total.nllSum.Sum();
+   out.nllSumCarry = total.nllSum.Carry();
 
    if (badness != 0.) {
       // Some events with evaluation errors. Return "badness" of errors.
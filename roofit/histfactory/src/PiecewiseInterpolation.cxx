@@ -21,6 +21,7 @@
 #include "RooStats/HistFactory/PiecewiseInterpolation.h"
 
 #include <RooFit/Detail/MathFuncs.h>
+#include <RooBatchCompute.h>
 
 #include "Riostream.h"
 #include "TBuffer.h"
@@ -259,6 +260,36 @@ void PiecewiseInterpolation::doEval(RooFit::EvalContext & ctx) const
   std::span<double> sum = ctx.output();
 
   auto nominal = ctx.at(_nominal);
+
+  for (unsigned int i=0; i < _paramSet.size(); ++i) {
+    const int icode = _interpCode[i];
+    if (icode < 0 || icode > 5) {
+      coutE(InputArguments) << "PiecewiseInterpolation::doEval(): " << _paramSet[i].GetName()
+                       << " with unknown interpolation code" << icode << std::endl;
+      throw std::invalid_argument("PiecewiseInterpolation::doEval() got invalid interpolation code " + std::to_string(icode));
+    }
+  }
+
+  // All interpolation codes but the 6th order exponential one (5) are
+  // implemented by a vectorized RooBatchCompute function, which applies all
+  // parameters in a single pass over the bins.
+  if (std::find(_interpCode.begin(), _interpCode.end(), 5) == _interpCode.end()) {
+    std::vector<std::span<const double>> vars;
+    std::vector<double> extraArgs;
+    vars.reserve(1 + 2 * _paramSet.size());
+    extraArgs.reserve(1 + 2 * _paramSet.size());
+    vars.push_back(nominal);
+    extraArgs.push_back(_positiveDefinite);
+    for (unsigned int i=0; i < _paramSet.size(); ++i) {
+      vars.push_back(ctx.at(_lowSet.at(i)));
+      vars.push_back(ctx.at(_highSet.at(i)));
+      extraArgs.push_back(_interpCode[i]);
+      extraArgs.push_back(static_cast<RooAbsReal*>(_paramSet.at(i))->getVal());
+    }
+    RooBatchCompute::compute(ctx.config(this), RooBatchCompute::PiecewiseInterpolation, sum, vars, extraArgs);
+    return;
+  }
+
   for(unsigned int j=0; j < nominal.size(); ++j) {
     sum[j] = nominal[j];
   }
@@ -269,12 +300,6 @@ void PiecewiseInterpolation::doEval(RooFit::EvalContext & ctx) const
     auto high  = ctx.at(_highSet.at(i));
     const int icode = _interpCode[i];
 
-    if (icode < 0 || icode > 5) {
-      coutE(InputArguments) << "PiecewiseInterpolation::doEval(): " << _paramSet[i].GetName()
-                       << " with unknown interpolation code" << icode << std::endl;
-      throw std::invalid_argument("PiecewiseInterpolation::doEval() got invalid interpolation code " + std::to_string(icode));
-    }
-
     for (unsigned int j=0; j < nominal.size(); ++j) {
        using RooFit::Detail::MathFuncs::flexibleInterpSingle;
        sum[j] += flexibleInterpSingle(icode, low[j], high[j], 1.0, nominal[j], param, sum[j]);
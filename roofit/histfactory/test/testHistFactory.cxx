@@ -5,6 +5,7 @@
 #include <RooStats/HistFactory/Measurement.h>
 #include <RooStats/HistFactory/MakeModelAndMeasurementsFast.h>
 #include <RooStats/HistFactory/Sample.h>
+#include <RooStats/HistFactory/PiecewiseInterpolation.h>
 #include <RooFit/ModelConfig.h>
 
 #include <RooFitHS3/JSONIO.h>
@@ -14,6 +15,7 @@
 #include <RooDataHist.h>
 #include <RooWorkspace.h>
 #include <RooArgSet.h>
+#include <RooFormulaVar.h>
 #include <RooSimultaneous.h>
 #include <RooRealSumPdf.h>
 #include <RooRealVar.h>
@@ -84,6 +86,39 @@ TEST(Sample, CopyAssignment)
    ASSERT_EQ(hist->GetNbinsX(), 10);
 }
 
+// The vectorized PiecewiseInterpolation kernel of the CPU evaluation backend
+// must give the same result as the scalar evaluation, for all interpolation
+// codes and parameter values inside and outside the interpolation boundary.
+TEST(PiecewiseInterpolation, BatchedEvaluation)
+{
+   RooRealVar x("x", "x", 0.5, 0., 10.);
+   x.setBins(50);
+   RooRealVar alpha1("alpha1", "alpha1", 0., -5., 5.);
+   RooRealVar alpha2("alpha2", "alpha2", 0., -5., 5.);
+
+   RooFormulaVar nominal("nominal", "1.0 + 0.1 * x", {x});
+   RooFormulaVar low1("low1", "0.9 + 0.08 * x", {x});
+   RooFormulaVar high1("high1", "1.2 + 0.11 * x", {x});
+   RooFormulaVar low2("low2", "1.05 + 0.1 * x", {x});
+   RooFormulaVar high2("high2", "0.8 + 0.09 * x", {x});
+
+   PiecewiseInterpolation interp("interp", "interp", nominal, {low1, low2}, {high1, high2}, {alpha1, alpha2});
+   interp.setPositiveDefinite(true);
+
+   for (int code : {0, 1, 2, 3, 4}) {
+      interp.setAllInterpCodes(code);
+      for (double a1 : {-2.5, -0.7, 0., 0.3, 1.8}) {
+         alpha1.setVal(a1);
+         alpha2.setVal(-0.5 * a1 + 0.2);
+         std::vector<double> ref = getValues(interp, x, false, false);
+         std::vector<double> batch = getValues(interp, x, false, true);
+         for (std::size_t i = 0; i < ref.size(); ++i) {
+            EXPECT_DOUBLE_EQ(batch[i], ref[i]) << "code " << code << ", alpha1 = " << a1 << ", bin " << i;
+         }
+      }
+   }
+}
+
 TEST(HistFactory, Read_ROOT6_16_Model)
 {
    RooHelpers::LocalChangeMsgLevel chmsglvl{RooFit::WARNING, 0u, RooFit::NumIntegration, true};
@@ -25,6 +25,7 @@ namespace MultiProcess {
 class ProcessManager;
 class Messenger;
 class Queue;
+class ThreadPool;
 class Job;
 
 class JobManager {
@@ -42,6 +43,13 @@ public:
    Messenger &messenger() const;
    Queue *queue() const;
 
+   bool uses_threads() const;
+   bool is_master() const;
+   bool is_worker() const;
+   std::size_t worker_id() const;
+   std::size_t N_workers() const;
+   void add_task(JobTask job_task);
+
    void retrieve(std::size_t requesting_job_id);
 
    void activate();
@@ -53,6 +61,7 @@ private:
    std::unique_ptr<ProcessManager> process_manager_ptr_;
    std::unique_ptr<Messenger> messenger_ptr_;
    std::unique_ptr<Queue> queue_ptr_;
+   std::unique_ptr<ThreadPool> thread_pool_ptr_;
    bool activated_ = false;
 
    static std::map<std::size_t, Job *> job_objects_;
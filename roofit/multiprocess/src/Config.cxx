@@ -62,6 +62,21 @@ namespace MultiProcess {
  * can be set using either setTaskPriorities or suggestTaskOrder. If no priorities
  * are set, the Priority queue simply assumes equal priority for all tasks. The
  * resulting order then depends on the implementation of std::priority_queue.
+ *
+ * The backend determines how workers are run: as forked processes that communicate
+ * with the master over ZeroMQ (Backend::Processes, the default), or as threads in the
+ * master process (Backend::Threads). Threads share the Job objects with the master, so
+ * no state or results have to be serialized, but the Jobs must support concurrent
+ * evaluation of their tasks. Like the queue type, the backend must be set before the
+ * JobManager is instantiated. In thread mode, the queue type setting is ignored.
+ *
+ * \note With the thread backend, the partial derivatives of the gradient are spread
+ * over the threads like over the worker processes: each thread takes its derivatives
+ * on its own clone of the likelihood, with its own copy of the parameters (see
+ * RooAbsL::cloneWithParameters). A likelihood evaluation, however, is only spread
+ * over the components of a likelihood (the terms of a RooSumL, e.g. the channels of a
+ * simultaneous pdf and the constraint term), since the events of one component share
+ * a pdf and are therefore not split over threads.
  */
 
 void Config::setDefaultNWorkers(unsigned int N_workers)
@@ -77,7 +92,8 @@ void Config::setDefaultNWorkers(unsigned int N_workers)
 
 void Config::setTimingAnalysis(bool timingAnalysis)
 {
-   if (JobManager::is_instantiated() && JobManager::instance()->process_manager().is_initialized()) {
+   if (JobManager::is_instantiated() && !JobManager::instance()->uses_threads() &&
+       JobManager::instance()->process_manager().is_initialized()) {
       printf("Warning: Config::setTimingAnalysis cannot set logging of timings, forking has already taken place!\n");
    } else {
       timingAnalysis_ = timingAnalysis;
@@ -89,6 +105,21 @@ bool Config::getTimingAnalysis()
    return timingAnalysis_;
 }
 
+bool Config::setBackend(Backend backend)
+{
+   if (JobManager::is_instantiated()) {
+      printf("Warning: cannot set RooFit::MultiProcess backend after JobManager has been instantiated!\n");
+      return false;
+   }
+   backend_ = backend;
+   return true;
+}
+
+Config::Backend Config::getBackend()
+{
+   return backend_;
+}
+
 unsigned int Config::getDefaultNWorkers()
 {
    return defaultNWorkers_;
@@ -118,7 +149,7 @@ Config::Queue::QueueType Config::Queue::getQueueType()
 /// \param[in] task_priorities Task priority values, where vector index equals task ID.
 void Config::Queue::setTaskPriorities(std::size_t job_id, const std::vector<std::size_t>& task_priorities)
 {
-   if (queueType_ == QueueType::Priority) {
+   if (queueType_ == QueueType::Priority && backend_ == Backend::Processes) {
       dynamic_cast<PriorityQueue *>(JobManager::instance()->queue())->setTaskPriorities(job_id, task_priorities);
    }
 }
@@ -137,7 +168,7 @@ void Config::Queue::setTaskPriorities(std::size_t job_id, const std::vector<std:
 /// \param[in] task_order Task IDs in the desired order.
 void Config::Queue::suggestTaskOrder(std::size_t job_id, const std::vector<Task>& task_order)
 {
-   if (queueType_ == QueueType::Priority) {
+   if (queueType_ == QueueType::Priority && backend_ == Backend::Processes) {
       dynamic_cast<PriorityQueue *>(JobManager::instance()->queue())->suggestTaskOrder(job_id, task_order);
    }
 }
@@ -148,6 +179,7 @@ std::size_t Config::LikelihoodJob::defaultNEventTasks = Config::LikelihoodJob::a
 std::size_t Config::LikelihoodJob::defaultNComponentTasks = Config::LikelihoodJob::automaticNComponentTasks;
 Config::Queue::QueueType Config::Queue::queueType_ = Config::Queue::QueueType::FIFO;
 bool Config::timingAnalysis_ = false;
+Config::Backend Config::backend_ = Config::Backend::Processes;
 
 } // namespace MultiProcess
 } // namespace RooFit
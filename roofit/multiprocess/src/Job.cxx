@@ -83,6 +83,16 @@ namespace MultiProcess {
  * choose to have the master process perform other tasks in between any of
  * these three steps, or even skip steps completely.
  *
+ * ## Thread backend
+ *
+ * With Config::Backend::Threads, evaluate_task is called from worker threads
+ * on the very Job object of the master, concurrently for different tasks.
+ * update_state, send_back_task_result_from_worker and
+ * receive_task_result_on_master are then never called: evaluate_task must
+ * store its result per task in the Job, where the master picks it up after
+ * 'Job::gather_worker_results()' returns. Jobs that support this mode check
+ * JobManager::uses_threads() to skip sending state updates to the workers.
+ *
  * Child classes should refrain from direct access to the JobManager instance
  * (through JobManager::instance), but rather use the here provided
  * Job::get_manager(). This function starts the worker_loop on the worker when
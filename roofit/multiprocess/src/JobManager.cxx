@@ -18,6 +18,7 @@
 #include "RooFit/MultiProcess/Queue.h" // complete type for JobManager::queue()
 #include "FIFOQueue.h" // complete type for JobManager::queue()
 #include "PriorityQueue.h" // complete type for JobManager::queue()
+#include "ThreadPool.h"
 #include "RooFit/MultiProcess/worker.h"
 #include "RooFit/MultiProcess/util.h"
 #include "RooFit/MultiProcess/Config.h"
@@ -43,6 +44,14 @@ namespace MultiProcess {
  * The default number of processes is set using 'std::thread::hardware_concurrency()'.
  * To change it, use 'Config::setDefaultNWorkers()' to set it to a different value
  * before creation of a new JobManager instance.
+ *
+ * With 'Config::setBackend(Config::Backend::Threads)', the workers are threads of
+ * the master process instead (see ThreadPool). Nothing is forked and no messenger
+ * or queue process is created. Jobs that support both backends should use the
+ * backend-independent 'is_master()', 'is_worker()', 'N_workers()' and 'add_task()'
+ * of this class, and skip the ZeroMQ state updates when 'uses_threads()' is true:
+ * in that case, the worker threads evaluate tasks directly on the Job object of
+ * the master, so results must be stored per task in the Job itself.
  */
 
 // static function
@@ -50,6 +59,9 @@ JobManager *JobManager::instance()
 {
    if (!JobManager::is_instantiated()) {
       instance_.reset(new JobManager(Config::getDefaultNWorkers())); // can't use make_unique, because ctor is private
+      if (instance_->uses_threads()) {
+         return instance_.get();
+      }
       instance_->messenger().test_connections(instance_->process_manager());
       // set send to non blocking on all processes after checking the connections are working:
       instance_->messenger().set_send_flag(zmq::send_flags::dontwait);
@@ -68,6 +80,10 @@ bool JobManager::is_instantiated()
 /// you need to run multiple jobs.
 JobManager::JobManager(std::size_t N_workers)
 {
+   if (Config::getBackend() == Config::Backend::Threads) {
+      thread_pool_ptr_ = std::make_unique<ThreadPool>(N_workers);
+      return;
+   }
    switch (Config::Queue::getQueueType()) {
    case Config::Queue::QueueType::FIFO: {
       queue_ptr_ = std::make_unique<FIFOQueue>();
@@ -105,13 +121,14 @@ JobManager::~JobManager()
    messenger_ptr_.reset();
    process_manager_ptr_.reset();
    queue_ptr_.reset();
+   thread_pool_ptr_.reset();
 }
 
 // static function
 /// \return job_id for added job_object
 std::size_t JobManager::add_job_object(Job *job_object)
 {
-   if (JobManager::is_instantiated()) {
+   if (JobManager::is_instantiated() && !instance_->uses_threads()) {
       if (instance_->process_manager().is_initialized()) {
          std::stringstream ss;
          ss << "Cannot add Job to JobManager instantiation, forking has already taken place! Instance object at raw "
@@ -158,11 +175,54 @@ Queue *JobManager::queue() const
    return queue_ptr_.get();
 }
 
+/// Whether the workers are threads of this process, see Config::setBackend.
+bool JobManager::uses_threads() const
+{
+   return static_cast<bool>(thread_pool_ptr_);
+}
+
+/// Whether the caller runs as master, i.e. on the master process in process
+/// mode or on any thread other than the worker threads in thread mode.
+bool JobManager::is_master() const
+{
+   return uses_threads() ? !ThreadPool::is_worker_thread() : process_manager().is_master();
+}
+
+bool JobManager::is_worker() const
+{
+   return uses_threads() ? ThreadPool::is_worker_thread() : process_manager().is_worker();
+}
+
+/// Index of the calling worker (process or thread), from 0 to N_workers() - 1.
+std::size_t JobManager::worker_id() const
+{
+   return uses_threads() ? ThreadPool::worker_id() : process_manager().worker_id();
+}
+
+std::size_t JobManager::N_workers() const
+{
+   return uses_threads() ? thread_pool_ptr_->N_workers() : process_manager().N_workers();
+}
+
+/// Add a task to the queue of the workers, for either backend.
+void JobManager::add_task(JobTask job_task)
+{
+   if (uses_threads()) {
+      thread_pool_ptr_->add(get_job_object(job_task.job_id), job_task);
+   } else {
+      queue()->add(job_task);
+   }
+}
+
 /// Retrieve results for a Job
 ///
 /// \param requesting_job_id ID number of the Job in the JobManager's Job list
 void JobManager::retrieve(std::size_t requesting_job_id)
 {
+   if (uses_threads()) {
+      thread_pool_ptr_->wait(requesting_job_id);
+      return;
+   }
    if (process_manager().is_master()) {
       bool job_fully_retrieved = false;
       while (not job_fully_retrieved) {
@@ -215,6 +275,10 @@ void JobManager::activate()
 {
    activated_ = true;
 
+   if (uses_threads()) {
+      return;
+   }
+
    if (process_manager().is_queue()) {
       queue()->loop();
       std::_Exit(0);
@@ -0,0 +1,134 @@
+/*
+ * Project: RooFit
+ * Authors:
+ *   PB, Patrick Bos, Netherlands eScience Center, p.bos@esciencecenter.nl
+ *
+ * Copyright (c) 2026, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#include "ThreadPool.h"
+#include "RooFit/MultiProcess/Job.h"
+
+namespace RooFit {
+namespace MultiProcess {
+
+namespace {
+thread_local bool is_worker_thread_ = false;
+thread_local std::size_t worker_id_ = 0;
+} // namespace
+
+/** \class ThreadPool
+ *
+ * \brief In-process workers for the thread backend of JobManager
+ *
+ * In thread mode (see Config::setBackend), the JobManager runs its workers as
+ * threads of the master process instead of forking. Tasks are put in a FIFO
+ * queue and taken by the first idle thread, which calls Job::evaluate_task
+ * directly on the Job object that the master also uses. Jobs therefore need no
+ * state updates or result messages: a task writes its result in the Job and
+ * wait() returns once all tasks of a Job are done.
+ *
+ * An exception thrown by a task is rethrown on the master from wait().
+ */
+
+ThreadPool::ThreadPool(std::size_t N_workers)
+{
+   threads_.reserve(N_workers);
+   for (std::size_t ix = 0; ix < N_workers; ++ix) {
+      threads_.emplace_back([this, ix] { loop(ix); });
+   }
+}
+
+ThreadPool::~ThreadPool()
+{
+   {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+   }
+   task_available_.notify_all();
+   for (auto &thread : threads_) {
+      thread.join();
+   }
+}
+
+void ThreadPool::add(Job *job, JobTask job_task)
+{
+   {
+      std::lock_guard<std::mutex> lock(mutex_);
+      tasks_.push_back({job, job_task});
+      ++N_tasks_pending_[job_task.job_id];
+   }
+   task_available_.notify_one();
+}
+
+/// Block until all tasks of a Job added so far have been evaluated.
+void ThreadPool::wait(std::size_t job_id)
+{
+   std::exception_ptr error;
+   {
+      std::unique_lock<std::mutex> lock(mutex_);
+      task_done_.wait(lock, [&] { return N_tasks_pending_[job_id] == 0; });
+      N_tasks_pending_.erase(job_id);
+      auto error_it = errors_.find(job_id);
+      if (error_it != errors_.end()) {
+         error = error_it->second;
+         errors_.erase(error_it);
+      }
+   }
+   if (error) {
+      std::rethrow_exception(error);
+   }
+}
+
+bool ThreadPool::is_worker_thread()
+{
+   return is_worker_thread_;
+}
+
+/// Index of the calling worker thread, from 0 to N_workers() - 1. Jobs can use
+/// it to give each thread its own copy of the state that tasks modify.
+std::size_t ThreadPool::worker_id()
+{
+   return worker_id_;
+}
+
+void ThreadPool::loop(std::size_t worker_id)
+{
+   is_worker_thread_ = true;
+   worker_id_ = worker_id;
+   while (true) {
+      Entry entry;
+      {
+         std::unique_lock<std::mutex> lock(mutex_);
+         task_available_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+         if (tasks_.empty()) {
+            return;
+         }
+         entry = tasks_.front();
+         tasks_.pop_front();
+      }
+
+      std::exception_ptr error;
+      try {
+         entry.job->evaluate_task(entry.job_task.task_id);
+      } catch (...) {
+         error = std::current_exception();
+      }
+
+      {
+         std::lock_guard<std::mutex> lock(mutex_);
+         if (error && !errors_.count(entry.job_task.job_id)) {
+            errors_[entry.job_task.job_id] = error;
+         }
+         --N_tasks_pending_[entry.job_task.job_id];
+      }
+      task_done_.notify_all();
+   }
+}
+
+} // namespace MultiProcess
+} // namespace RooFit
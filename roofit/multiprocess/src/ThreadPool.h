@@ -0,0 +1,63 @@
+/*
+ * Project: RooFit
+ * Authors:
+ *   PB, Patrick Bos, Netherlands eScience Center, p.bos@esciencecenter.nl
+ *
+ * Copyright (c) 2026, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+#ifndef ROOT_ROOFIT_MultiProcess_ThreadPool
+#define ROOT_ROOFIT_MultiProcess_ThreadPool
+
+#include "RooFit/MultiProcess/types.h"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace RooFit {
+namespace MultiProcess {
+
+class Job;
+
+class ThreadPool {
+public:
+   explicit ThreadPool(std::size_t N_workers);
+   ~ThreadPool();
+
+   void add(Job *job, JobTask job_task);
+   void wait(std::size_t job_id);
+
+   std::size_t N_workers() const { return threads_.size(); }
+   static bool is_worker_thread();
+   static std::size_t worker_id();
+
+private:
+   void loop(std::size_t worker_id);
+
+   struct Entry {
+      Job *job;
+      JobTask job_task;
+   };
+
+   std::vector<std::thread> threads_;
+   std::mutex mutex_;
+   std::condition_variable task_available_;
+   std::condition_variable task_done_;
+   std::deque<Entry> tasks_;
+   std::map<std::size_t, std::size_t> N_tasks_pending_; // per job id
+   std::map<std::size_t, std::exception_ptr> errors_;   // per job id, first exception thrown by a task
+   bool stop_ = false;
+};
+
+} // namespace MultiProcess
+} // namespace RooFit
+
+#endif // ROOT_ROOFIT_MultiProcess_ThreadPool
@@ -26,9 +26,14 @@ class TDirectory;
 #include "RooAbsData.h"
 #include "RooDirItem.h"
 
+#include <ROOT/RSpan.hxx>
+
 #include <string_view>
 
 #include <list>
+#include <map>
+#include <memory>
+#include <string>
 
 class RooDataSet : public RooAbsData, public RooDirItem {
 public:
@@ -72,6 +77,10 @@ public:
   static RooDataSet *read(const char *filename, const RooArgList &variables,
            const char *opts= "", const char* commonPath="",
            const char *indexCatName=nullptr) ;
+  static std::unique_ptr<RooDataSet> fromSpans(RooStringView name, RooStringView title, const RooArgSet &vars,
+                                               std::map<std::string, std::span<const double>> const &columns,
+                                               const char *wgtVarName = nullptr,
+                                               std::shared_ptr<const void> owner = {});
   bool write(const char* filename) const;
   bool write(std::ostream & ofs) const;
 
@@ -44,6 +44,7 @@ public:
    void print(std::ostream &os);
 
    void setOffsetMode(RooFit::EvalContext::OffsetMode);
+   void setUseMultiThreading(bool flag);
 
 private:
    void processVariable(NodeInfo &nodeInfo);
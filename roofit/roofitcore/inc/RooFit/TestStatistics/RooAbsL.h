@@ -109,6 +109,12 @@ public:
    // necessary from MinuitFcnGrad to reach likelihood properties:
    virtual std::unique_ptr<RooArgSet> getParameters();
 
+   /// \brief Clone with its own pdf and dataset, attached to the parameters in \p parameters (matched by name).
+   ///
+   /// The clone does not share any RooAbsArg with this likelihood, so both can be evaluated concurrently, e.g. on the
+   /// worker threads of LikelihoodGradientJob. Returns nullptr if the likelihood class does not support this.
+   virtual std::unique_ptr<RooAbsL> cloneWithParameters(const RooArgSet & /*parameters*/) const { return nullptr; }
+
    /// \brief Interface function signaling a request to perform constant term optimization.
    ///
    /// The default implementation takes no action other than to forward the calls to all servers. May be overridden in
@@ -133,6 +139,9 @@ public:
    inline void setSimCount(std::size_t value) { sim_count_ = value; }
 
 protected:
+   std::unique_ptr<RooAbsPdf> clonePdfWithParameters(const RooArgSet &parameters) const;
+   void initConstOptimizationOfClone(const RooAbsL &other);
+
    // Note: pdf_ and data_ can be constructed in two ways, one of which implies ownership and the other does not.
    // Inspired by this: https://stackoverflow.com/a/61227865/1199693.
    // The owning variant is used for classes that need a pdf/data clone (RooBinnedL and RooUnbinnedL), whereas the
@@ -35,9 +35,13 @@ public:
    ROOT::Math::KahanSum<double>
    evaluatePartition(Section bins, std::size_t components_begin, std::size_t components_end) override;
 
+   std::unique_ptr<RooAbsL> cloneWithParameters(const RooArgSet &parameters) const override;
+
    std::string GetClassName() const override { return "RooBinnedL"; }
 
 private:
+   RooBinnedL(std::unique_ptr<RooAbsPdf> pdf, const RooBinnedL &other);
+
    mutable bool _first = true;        ///<!
    mutable std::vector<double> _binw; ///<!
    std::unique_ptr<RooChangeTracker> paramTracker_;
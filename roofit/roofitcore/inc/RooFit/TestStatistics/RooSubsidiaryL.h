@@ -49,10 +49,13 @@ public:
 
    void constOptimizeTestStatistic(RooAbsArg::ConstOpCode opcode, bool doAlsoTrackingOpt) override;
 
+   std::unique_ptr<RooAbsL> cloneWithParameters(const RooArgSet &parameters) const override;
+
 private:
    std::string parent_pdf_name_;
    RooArgList subsidiary_pdfs_{"subsidiary_pdfs"}; ///< Set of subsidiary PDF or "constraint" terms
    RooArgSet parameter_set_{"parameter_set"};      ///< Set of parameters to which constraints apply
+   RooArgSet owned_clones_{"owned_clones"};        ///< Owns the subsidiary PDFs of a clone from cloneWithParameters()
 };
 
 } // namespace TestStatistics
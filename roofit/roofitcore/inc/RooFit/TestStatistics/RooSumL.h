@@ -37,6 +37,8 @@ public:
 
    void constOptimizeTestStatistic(RooAbsArg::ConstOpCode opcode, bool doAlsoTrackingOpt) override;
 
+   std::unique_ptr<RooAbsL> cloneWithParameters(const RooArgSet &parameters) const override;
+
    std::string GetClassName() const override { return "RooSumL"; }
 
    const std::vector<std::unique_ptr<RooAbsL>> &GetComponents() const { return components_; };
@@ -41,9 +41,13 @@ public:
    ROOT::Math::KahanSum<double>
    evaluatePartition(Section events, std::size_t components_begin, std::size_t components_end) override;
 
+   std::unique_ptr<RooAbsL> cloneWithParameters(const RooArgSet &parameters) const override;
+
    std::string GetClassName() const override { return "RooUnbinnedL"; }
 
 private:
+   RooUnbinnedL(std::unique_ptr<RooAbsPdf> pdf, const RooUnbinnedL &other);
+
    bool apply_weight_squared = false; ///< Apply weights squared?
    mutable bool _first = true;        ///<!
    std::unique_ptr<RooChangeTracker> paramTracker_;
@@ -64,6 +64,9 @@ public:
 
    std::string buildCode(RooAbsReal const &head);
 
+   static void setCacheDirectory(std::string const &dir);
+   static std::string const &cacheDirectory();
+
 protected:
    double evaluate() const override;
 
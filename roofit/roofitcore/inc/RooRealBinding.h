@@ -45,6 +45,10 @@ public:
   std::list<double>* binBoundaries(Int_t) const override ;
   /// Return a pointer to the observable that defines the `i`-th dimension of the function.
   RooAbsRealLValue* observable(unsigned int i) const { return i < _vars.size() ? _vars[i] : nullptr; }
+  /// Return the bound function.
+  const RooAbsReal& function() const { return *_func; }
+  /// Return the normalization set with which the bound function is evaluated.
+  const RooArgSet* normSet() const { return _nset; }
   std::list<double>* plotSamplingHint(RooAbsRealLValue& /*obs*/, double /*xlo*/, double /*xhi*/) const override ;
 
 protected:
@@ -26,6 +26,8 @@
 #include "Rtypes.h"
 
 #include <list>
+#include <map>
+#include <memory>
 #include <vector>
 #include <algorithm>
 
@@ -89,6 +91,8 @@ public:
   /// @{
   ArraysStruct getArrays() const;
   void recomputeSumWeight();
+  void setExternalColumns(std::map<std::string, std::span<const double>> const &columns,
+                          std::shared_ptr<const void> owner = {});
   /// @}
 
 private:
@@ -209,7 +213,8 @@ public:
     }
 
     RealVector(const RealVector& other, RooAbsReal* real=nullptr) :
-      _vec(other._vec), _nativeReal(real?real:other._nativeReal), _real(real?real:other._real), _buf(other._buf), _nativeBuf(other._nativeBuf) {
+      _vec(other._vec), _nativeReal(real?real:other._nativeReal), _real(real?real:other._real), _buf(other._buf), _nativeBuf(other._nativeBuf),
+      _extData(other._extData), _extSize(other._extSize), _extOwner(other._extOwner) {
       if (other._tracker) {
         _tracker = new RooChangeTracker(Form("track_%s",_nativeReal->GetName()),"tracker",other._tracker->parameters()) ;
       } else {
@@ -226,6 +231,9 @@ public:
       _real = other._real;
       _buf = other._buf;
       _nativeBuf = other._nativeBuf;
+      _extData = other._extData;
+      _extSize = other._extSize;
+      _extOwner = other._extOwner;
       if (other._vec.size() <= _vec.capacity() / 2 && _vec.capacity() > (VECTOR_BUFFER_SIZE / sizeof(double))) {
         std::vector<double> tmp;
         tmp.reserve(std::max(other._vec.size(), VECTOR_BUFFER_SIZE / sizeof(double)));
@@ -269,35 +277,68 @@ public:
       return _tracker->hasChanged(true) ;
     }
 
+    /// Let this column refer to an external, contiguous array of values
+    /// instead of owning a copy. The array is only read: the first operation
+    /// that modifies the column copies it into owned storage. The optional
+    /// `owner` is kept alive as long as any column refers to the array.
+    void setExternalData(std::span<const double> values, std::shared_ptr<const void> owner = {}) {
+      std::vector<double>().swap(_vec);
+      _extData = values.data();
+      _extSize = values.size();
+      _extOwner = std::move(owner);
+    }
+
+    /// Whether the values are read from an external array.
+    bool hasExternalData() const { return _extData != nullptr; }
+
+    /// Copy the values of an external array into owned storage.
+    void materialize() {
+      if (!_extData) return;
+      _vec.assign(_extData, _extData + _extSize);
+      _extData = nullptr;
+      _extSize = 0;
+      _extOwner.reset();
+    }
+
+    /// Pointer to the first value, in owned or in external storage.
+    const double* rawData() const { return _extData ? _extData : _vec.data(); }
+
     void fill() {
+      materialize();
       _vec.push_back(*_buf);
     }
 
     void write(Int_t i) {
+      materialize();
       assert(static_cast<std::size_t>(i) < _vec.size());
       _vec[i] = *_buf ;
     }
 
     void reset() {
+      _extData = nullptr;
+      _extSize = 0;
+      _extOwner.reset();
       _vec.clear();
     }
 
     inline void load(std::size_t idx) const {
-      assert(idx < _vec.size());
-      *_buf = *(_vec.begin() + idx) ;
+      assert(idx < size());
+      *_buf = rawData()[idx] ;
       *_nativeBuf = *_buf ;
     }
 
     std::span<const double> getRange(std::size_t first, std::size_t last) const {
-      auto beg = std::min(_vec.cbegin() + first, _vec.cend());
-      auto end = std::min(_vec.cbegin() + last,  _vec.cend());
+      const std::size_t n = size();
+      const std::size_t beg = std::min(first, n);
+      const std::size_t end = std::min(last, n);
 
-      return std::span<const double>(&*beg, std::distance(beg, end));
+      return std::span<const double>(rawData() + beg, end - beg);
     }
 
-    std::size_t size() const { return _vec.size() ; }
+    std::size_t size() const { return _extData ? _extSize : _vec.size() ; }
 
     void resize(Int_t newSize) {
+      materialize();
       if (newSize < Int_t(_vec.capacity()) / 2 && _vec.capacity() > (VECTOR_BUFFER_SIZE / sizeof(double))) {
         // do an expensive copy, if we save at least a factor 2 in size
         std::vector<double> tmp;
@@ -313,14 +354,18 @@ public:
     }
 
     void reserve(Int_t newSize) {
+      materialize();
       _vec.reserve(newSize);
     }
 
+    /// Return the owned values. A column referring to an external array is
+    /// copied into owned storage first.
     const std::vector<double>& data() const {
+      const_cast<RealVector*>(this)->materialize();
       return _vec;
     }
 
-    std::vector<double>& data() { return _vec; }
+    std::vector<double>& data() { materialize(); return _vec; }
 
   protected:
     std::vector<double> _vec;
@@ -333,6 +378,9 @@ public:
     double* _nativeBuf = nullptr; ///<!
     RooChangeTracker* _tracker = nullptr;
     RooArgSet* _nset = nullptr; ///<!
+    const double* _extData = nullptr; ///<! External array with the values, if not owned
+    std::size_t _extSize = 0; ///<! Size of the external array
+    std::shared_ptr<const void> _extOwner; ///<! Keeps the external array alive, if set
     ClassDef(RealVector,1) // STL-vector-based Data Storage class
   } ;
 
@@ -100,11 +100,20 @@
 #include <iomanip>
 #include <iostream>
 #include <limits>
+#include <mutex>
 #include <sstream>
 #include <sys/types.h>
 
 namespace {
 
+// Evaluation errors can be logged concurrently when likelihood components are
+// evaluated in different threads, e.g. by the RooFit::MultiProcess thread backend.
+std::recursive_mutex &evalErrorMutex()
+{
+   static std::recursive_mutex mutex;
+   return mutex;
+}
+
 // Internal helper RooAbsFunc that evaluates the scaled data-weighted average of
 // given RooAbsReal as a function of a single variable using the RooFit::Evaluator.
 class ScaledDataWeightedAverage : public RooAbsFunc {
@@ -3383,6 +3392,8 @@ void RooAbsReal::logEvalError(const RooAbsReal* originator, const char* origName
     return ;
   }
 
+  std::lock_guard<std::recursive_mutex> lock(evalErrorMutex());
+
   if (_evalErrorMode==CountErrors) {
     _evalErrorCount++ ;
     return ;
@@ -3438,6 +3449,8 @@ void RooAbsReal::logEvalError(const char* message, const char* serverValueString
     return ;
   }
 
+  std::lock_guard<std::recursive_mutex> lock(evalErrorMutex());
+
   if (_evalErrorMode==CountErrors) {
     _evalErrorCount++ ;
     return ;
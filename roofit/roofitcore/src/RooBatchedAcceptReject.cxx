@@ -0,0 +1,391 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2026, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+/**
+\file RooBatchedAcceptReject.cxx
+\class RooBatchedAcceptReject
+\ingroup Roofitcore
+
+Accept/reject sampler that works on blocks of candidate events instead of
+single events. The candidates are drawn uniformly in the generation space, the
+function is evaluated for all of them at once with the vectorized
+RooFit::Evaluator, and the accepted candidates are then returned one by one.
+
+The random numbers come from a single RANLUX++ stream, seeded from the RooRandom
+generator. The candidates are drawn in blocks of `nEventsPerBlock` events,
+which are distributed over the threads of the ROOT thread pool if implicit
+multi-threading is enabled. Each block jumps to its own position in the stream
+with the skip-ahead of RANLUX++, so the generated events are the same for any
+number of threads. The function evaluation also runs multi-threaded in this case.
+
+Like RooAcceptReject, the sampler determines the maximum of the function with
+an initial sampling if no maximum is known a priori. It can't generate
+observables conditional on prototype data, and falls back to RooAcceptReject
+in this case. It is not used by default, but can be selected in the generator
+configuration:
+~~~ {.cpp}
+RooAbsPdf::defaultGeneratorConfig()->method1D(false, false).setLabel("RooBatchedAcceptReject");
+pdf.specialGeneratorConfig(true)->methodND(false, false).setLabel("RooBatchedAcceptReject");
+~~~
+**/
+
+#include "RooBatchedAcceptReject.h"
+
+#include "RooAcceptReject.h"
+#include "RooAbsCategoryLValue.h"
+#include "RooMsgService.h"
+#include "RooNumGenConfig.h"
+#include "RooNumGenFactory.h"
+#include "RooRandom.h"
+#include "RooRealVar.h"
+#include "RooFit/Detail/NormalizationHelpers.h"
+#include "RooFit/Evaluator.h"
+
+#include <Math/RanluxppEngine.h>
+#include <RConfigure.h>
+#include <TROOT.h>
+
+#ifdef R__USE_IMT
+#include <ROOT/TSeq.hxx>
+#include <ROOT/TThreadExecutor.hxx>
+#endif
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+/// Maximum number of candidates drawn in one go.
+constexpr std::size_t maxCandidatesPerRound = 1 << 20;
+
+/// Number of candidates for which the batched function evaluation is checked
+/// against the scalar one.
+constexpr std::size_t nValidationEvents = 16;
+
+/// Call `task(iBlock)` for all blocks, on the ROOT thread pool if implicit
+/// multi-threading is enabled.
+template <class Task>
+void forEachBlock(std::size_t nBlocks, Task &&task)
+{
+#ifdef R__USE_IMT
+   if (nBlocks > 1 && ROOT::IsImplicitMTEnabled()) {
+      ROOT::TThreadExecutor ex;
+      ex.Foreach([&](std::size_t iBlock) { task(iBlock); }, ROOT::TSeq<std::size_t>(nBlocks));
+      return;
+   }
+#endif
+   for (std::size_t iBlock = 0; iBlock < nBlocks; ++iBlock) {
+      task(iBlock);
+   }
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Register RooBatchedAcceptReject, its parameters and capabilities with RooNumGenFactory.
+
+void RooBatchedAcceptReject::registerSampler(RooNumGenFactory &fact)
+{
+   RooRealVar nTrial0D("nTrial0D", "Number of trial samples for cat-only generation", 100, 0, 1e9);
+   RooRealVar nTrial1D("nTrial1D", "Number of trial samples for 1-dim generation", 1000, 0, 1e9);
+   RooRealVar nTrial2D("nTrial2D", "Number of trial samples for 2-dim generation", 100000, 0, 1e9);
+   RooRealVar nTrial3D("nTrial3D", "Number of trial samples for N-dim generation", 10000000, 0, 1e9);
+   RooRealVar nEventsPerBlock("nEventsPerBlock", "Number of candidate events drawn per thread task", 16384, 1, 1e9);
+
+   fact.storeProtoSampler(new RooBatchedAcceptReject,
+                          RooArgSet(nTrial0D, nTrial1D, nTrial2D, nTrial3D, nEventsPerBlock));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Initialize a batched accept-reject generator for the specified distribution
+/// function, which must be non-negative but does not need to be normalized over
+/// the variables to be generated, genVars. The function and its dependents are
+/// cloned and so will not be disturbed during the generation process.
+
+RooBatchedAcceptReject::RooBatchedAcceptReject(const RooAbsReal &func, const RooArgSet &genVars,
+                                               const RooNumGenConfig &config, bool verbose,
+                                               const RooAbsReal *maxFuncVal)
+   : RooAbsNumGenerator(func, genVars, verbose, maxFuncVal)
+{
+   const RooArgSet &section = config.getConfigSection("RooBatchedAcceptReject");
+   _nEventsPerBlock = static_cast<std::size_t>(section.getRealValue("nEventsPerBlock"));
+
+   ULong64_t catSampleMult = 1;
+   for (auto *cat : static_range_cast<RooAbsCategoryLValue *>(_catVars)) {
+      _cats.push_back(cat);
+      catSampleMult *= cat->numTypes();
+   }
+   for (auto *real : static_range_cast<RooRealVar *>(_realVars)) {
+      _reals.push_back(real);
+   }
+   _event.add(_realVars);
+   _event.add(_catVars);
+
+   if (!_funcMaxVal) {
+      const std::size_t dim = std::min<std::size_t>(_reals.size(), 3);
+      const char *trialNames[] = {"nTrial0D", "nTrial1D", "nTrial2D", "nTrial3D"};
+      _minTrials = static_cast<ULong64_t>(section.getRealValue(trialNames[dim])) * catSampleMult;
+   }
+
+   // The seed is taken from the RooRandom generator, so that the generated
+   // events are reproducible with RooRandom::randomGenerator()->SetSeed().
+   _seed = (static_cast<ULong64_t>(RooRandom::integer(0xFFFFFFFF)) << 32) | RooRandom::integer(0xFFFFFFFF);
+
+   if (_verbose) {
+      oocoutI(nullptr, Generation) << func.GetName() << "::RooBatchedAcceptReject:" << std::endl
+                                   << "  Initializing batched accept-reject generator for " << _event
+                                   << ", min sampling trials is " << _minTrials << std::endl;
+   }
+}
+
+RooBatchedAcceptReject::~RooBatchedAcceptReject() = default;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create a sampler for the given function. Conditional generation is not
+/// supported, so a RooAcceptReject is created if there are conditional
+/// observables.
+
+RooAbsNumGenerator *RooBatchedAcceptReject::clone(const RooAbsReal &func, const RooArgSet &genVars,
+                                                  const RooArgSet &condVars, const RooNumGenConfig &config,
+                                                  bool verbose, const RooAbsReal *maxFuncVal) const
+{
+   if (!condVars.empty()) {
+      oocoutI(nullptr, Generation) << "RooBatchedAcceptReject::clone(" << func.GetName()
+                                   << ") conditional generation is not supported, using RooAcceptReject" << std::endl;
+      return new RooAcceptReject(func, genVars, config, verbose, maxFuncVal);
+   }
+   return new RooBatchedAcceptReject(func, genVars, config, verbose, maxFuncVal);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create the Evaluator for the batched function evaluation. This is done at
+/// the first generation, after the parameters of the context are attached to
+/// the function. If the function can't be evaluated with the Evaluator, the
+/// candidates are evaluated one by one.
+
+void RooBatchedAcceptReject::initEvaluator()
+{
+   _evaluatorInitialized = true;
+   try {
+      _compiledFunc = RooFit::Detail::compileForNormSet(*_funcClone, RooArgSet{});
+      _evaluator = std::make_unique<RooFit::Evaluator>(*_compiledFunc);
+   } catch (std::exception const &exc) {
+      oocoutW(nullptr, Generation) << "RooBatchedAcceptReject: function " << _funcClone->GetName()
+                                   << " can't be evaluated in batches (" << exc.what()
+                                   << "), evaluating it event by event" << std::endl;
+      _evaluator.reset();
+      _compiledFunc.reset();
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Draw the given number of candidate events uniformly in the generation space,
+/// together with the uniform random numbers for the accept/reject decision.
+
+void RooBatchedAcceptReject::sampleCandidates(std::size_t nCandidates)
+{
+   const std::size_t nReals = _reals.size();
+   const std::size_t nRandomsPerCandidate = nReals + _cats.size() + 1;
+
+   std::vector<double> mins;
+   std::vector<double> widths;
+   for (RooRealVar *real : _reals) {
+      mins.push_back(real->getMin());
+      widths.push_back(real->getMax() - real->getMin());
+   }
+   std::vector<std::vector<double>> catIndices;
+   for (RooAbsCategoryLValue *cat : _cats) {
+      catIndices.emplace_back();
+      for (int i = 0; i < cat->numTypes(); ++i) {
+         catIndices.back().push_back(cat->getOrdinal(i).second);
+      }
+   }
+
+   _candidates.resize(nReals + _cats.size());
+   for (auto &values : _candidates) {
+      values.resize(nCandidates);
+   }
+   _acceptUniforms.resize(nCandidates);
+
+   const ULong64_t firstCandidate = _nSampled;
+   const std::size_t nBlocks = (nCandidates + _nEventsPerBlock - 1) / _nEventsPerBlock;
+
+   forEachBlock(nBlocks, [&](std::size_t iBlock) {
+      const std::size_t begin = iBlock * _nEventsPerBlock;
+      const std::size_t end = std::min(nCandidates, begin + _nEventsPerBlock);
+      ROOT::Math::RanluxppEngine2048 engine(_seed);
+      engine.Skip((firstCandidate + begin) * nRandomsPerCandidate);
+      for (std::size_t i = begin; i < end; ++i) {
+         for (std::size_t iReal = 0; iReal < nReals; ++iReal) {
+            _candidates[iReal][i] = mins[iReal] + engine() * widths[iReal];
+         }
+         for (std::size_t iCat = 0; iCat < catIndices.size(); ++iCat) {
+            auto const &indices = catIndices[iCat];
+            const std::size_t ordinal = std::min<std::size_t>(engine() * indices.size(), indices.size() - 1);
+            _candidates[nReals + iCat][i] = indices[ordinal];
+         }
+         _acceptUniforms[i] = engine();
+      }
+   });
+
+   _nSampled += nCandidates;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the function for the candidates.
+
+void RooBatchedAcceptReject::evaluateCandidates(std::size_t nCandidates)
+{
+   auto setCandidate = [&](std::size_t i) {
+      for (std::size_t iReal = 0; iReal < _reals.size(); ++iReal) {
+         _reals[iReal]->setVal(_candidates[iReal][i]);
+      }
+      for (std::size_t iCat = 0; iCat < _cats.size(); ++iCat) {
+         _cats[iCat]->setIndex(static_cast<int>(_candidates[_reals.size() + iCat][i]));
+      }
+   };
+
+   if (_evaluator) {
+      for (std::size_t iVar = 0; iVar < _event.size(); ++iVar) {
+         _evaluator->setInput(_event[iVar]->GetName(), {_candidates[iVar].data(), nCandidates}, false);
+      }
+      _funcValues = _evaluator->run().data();
+
+      // Check the batched evaluation against the scalar one the first time,
+      // in case the function doesn't support the batched evaluation correctly.
+      if (_totalEvents == 0) {
+         for (std::size_t i = 0; i < std::min(nCandidates, nValidationEvents); ++i) {
+            setCandidate(i);
+            const double scalarVal = _funcClone->getVal();
+            if (std::abs(_funcValues[i] - scalarVal) > 1e-6 * std::abs(scalarVal)) {
+               oocoutW(nullptr, Generation)
+                  << "RooBatchedAcceptReject: batched evaluation of " << _funcClone->GetName() << " gives "
+                  << _funcValues[i] << " instead of " << scalarVal << ", evaluating it event by event" << std::endl;
+               _evaluator.reset();
+               _compiledFunc.reset();
+               break;
+            }
+         }
+      }
+      if (_evaluator) {
+         return;
+      }
+   }
+
+   _scalarFuncValues.resize(nCandidates);
+   for (std::size_t i = 0; i < nCandidates; ++i) {
+      setCandidate(i);
+      _scalarFuncValues[i] = _funcClone->getVal();
+   }
+   _funcValues = _scalarFuncValues.data();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Draw and evaluate a block of candidates, and update the estimates of the
+/// function maximum and integral.
+
+void RooBatchedAcceptReject::runRound(std::size_t nCandidates, double &resampleRatio)
+{
+   if (!_evaluatorInitialized) {
+      initEvaluator();
+   }
+   sampleCandidates(nCandidates);
+   evaluateCandidates(nCandidates);
+
+   double roundMax = 0.;
+   for (std::size_t i = 0; i < nCandidates; ++i) {
+      roundMax = std::max(roundMax, _funcValues[i]);
+      _funcSum += _funcValues[i];
+   }
+   _totalEvents += nCandidates;
+
+   if (_funcMaxVal) {
+      _maxFuncVal = _funcMaxVal->getVal();
+   } else if (roundMax > _maxFuncVal) {
+      // Increase the maximum estimate slightly to give a safety margin with a
+      // corresponding loss of efficiency. Events that were already returned
+      // need to be resampled.
+      const double newMax = 1.05 * roundMax;
+      if (_delivered) {
+         resampleRatio *= _maxFuncVal / newMax;
+      }
+      _maxFuncVal = newMax;
+   }
+
+   _accepted.clear();
+   _nextAccepted = 0;
+   for (std::size_t i = 0; i < nCandidates; ++i) {
+      if (_acceptUniforms[i] * _maxFuncVal <= _funcValues[i]) {
+         _accepted.push_back(i);
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return a pointer to a generated event. The caller does not own the event and it
+/// will be overwritten by a subsequent call. The input parameter 'remaining' should
+/// contain your best guess at the total number of subsequent events you will request.
+
+const RooArgSet *RooBatchedAcceptReject::generateEvent(UInt_t remaining, double &resampleRatio)
+{
+   if (_event.empty()) {
+      return &_event;
+   }
+
+   while (_nextAccepted >= _accepted.size()) {
+      std::size_t nCandidates = 0;
+      if (_totalEvents < _minTrials) {
+         nCandidates = _minTrials - _totalEvents;
+      } else if (_totalEvents == 0) {
+         nCandidates = std::max<std::size_t>(remaining, 1);
+      } else {
+         const double maxFuncVal = _funcMaxVal ? _funcMaxVal->getVal() : _maxFuncVal;
+         if (_funcSum * maxFuncVal <= 0) {
+            oocoutE(nullptr, Generation)
+               << "RooBatchedAcceptReject::generateEvent: cannot estimate efficiency...giving up" << std::endl;
+            return nullptr;
+         }
+         // Calculate how many more events to generate using our best estimate of our efficiency.
+         const double eff = _funcSum / (_totalEvents * maxFuncVal);
+         nCandidates = 1 + static_cast<std::size_t>(std::min(1.05 * remaining / eff, 1. * maxCandidatesPerRound));
+      }
+      runRound(std::min(nCandidates, maxCandidatesPerRound), resampleRatio);
+   }
+
+   const std::size_t iCandidate = _accepted[_nextAccepted++];
+   for (std::size_t iReal = 0; iReal < _reals.size(); ++iReal) {
+      _reals[iReal]->setVal(_candidates[iReal][iCandidate]);
+   }
+   for (std::size_t iCat = 0; iCat < _cats.size(); ++iCat) {
+      _cats[iCat]->setIndex(static_cast<int>(_candidates[_reals.size() + iCat][iCandidate]));
+   }
+   _delivered = true;
+   return &_event;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Empirically determine the maximum value of the function by taking a large
+/// number of samples. The actual number depends on the number of dimensions in
+/// which the sampling occurs.
+
+double RooBatchedAcceptReject::getFuncMax()
+{
+   double resampleRatio = 1.;
+   while (_totalEvents < _minTrials) {
+      runRound(std::min<std::size_t>(_minTrials - _totalEvents, maxCandidatesPerRound), resampleRatio);
+   }
+   return _maxFuncVal;
+}
+
+std::string const &RooBatchedAcceptReject::generatorName() const
+{
+   static const std::string name = "RooBatchedAcceptReject";
+   return name;
+}
@@ -0,0 +1,80 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2026, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#ifndef RooFit_RooBatchedAcceptReject_h
+#define RooFit_RooBatchedAcceptReject_h
+
+#include "RooAbsNumGenerator.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+class RooAbsCategoryLValue;
+class RooRealVar;
+class RooNumGenFactory;
+
+namespace RooFit {
+class Evaluator;
+}
+
+class RooBatchedAcceptReject : public RooAbsNumGenerator {
+public:
+   RooBatchedAcceptReject() = default;
+   RooBatchedAcceptReject(const RooAbsReal &func, const RooArgSet &genVars, const RooNumGenConfig &config,
+                          bool verbose = false, const RooAbsReal *maxFuncVal = nullptr);
+   ~RooBatchedAcceptReject() override;
+
+   RooAbsNumGenerator *clone(const RooAbsReal &func, const RooArgSet &genVars, const RooArgSet &condVars,
+                             const RooNumGenConfig &config, bool verbose = false,
+                             const RooAbsReal *maxFuncVal = nullptr) const override;
+
+   const RooArgSet *generateEvent(UInt_t remaining, double &resampleRatio) override;
+   double getFuncMax() override;
+
+   // Advertisement of capabilities
+   bool canSampleConditional() const override { return false; }
+   bool canSampleCategories() const override { return true; }
+
+   std::string const &generatorName() const override;
+
+protected:
+   friend class RooNumGenFactory;
+   static void registerSampler(RooNumGenFactory &fact);
+
+private:
+   void initEvaluator();
+   void sampleCandidates(std::size_t nCandidates);
+   void evaluateCandidates(std::size_t nCandidates);
+   void runRound(std::size_t nCandidates, double &resampleRatio);
+
+   RooArgSet _event;                                ///< Generated observables, reals first
+   std::vector<RooRealVar *> _reals;                ///< Real observables to generate
+   std::vector<RooAbsCategoryLValue *> _cats;       ///< Category observables to generate
+   std::vector<std::vector<double>> _candidates;    ///< Candidate values, one vector per observable
+   std::vector<double> _acceptUniforms;             ///< Uniform random numbers for the accept/reject decision
+   std::vector<double> _scalarFuncValues;           ///< Function values if the Evaluator can't be used
+   const double *_funcValues = nullptr;             ///< Function values of the candidates
+   std::vector<std::size_t> _accepted;              ///< Indices of the accepted candidates
+   std::size_t _nextAccepted = 0;                   ///< Next accepted candidate to return
+   std::unique_ptr<RooAbsReal> _compiledFunc;       ///< Function compiled for the Evaluator
+   std::unique_ptr<RooFit::Evaluator> _evaluator;   ///< Evaluator of the candidates in batches
+   bool _evaluatorInitialized = false;              ///< Whether initEvaluator() was called
+   ULong64_t _seed = 0;                             ///< Seed of the random number stream
+   ULong64_t _nSampled = 0;                         ///< Number of candidates drawn from the stream so far
+   double _maxFuncVal = 0.;                         ///< Maximum function value found
+   double _funcSum = 0.;                            ///< Sum of all function values sampled
+   ULong64_t _totalEvents = 0;                      ///< Total number of function samples
+   ULong64_t _minTrials = 0;                        ///< Minimum number of samples for the maximum finding
+   std::size_t _nEventsPerBlock = 16384;            ///< Number of candidates drawn per thread task
+   bool _delivered = false;                         ///< Whether an event was returned with the current maximum
+};
+
+#endif
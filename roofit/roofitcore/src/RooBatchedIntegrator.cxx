@@ -0,0 +1,493 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2026, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+/**
+\file RooBatchedIntegrator.cxx
+\class RooBatchedIntegrator
+\ingroup Roofitcore
+
+Numeric integrator for closed ranges in any number of dimensions that evaluates
+the integrand for all integration points at once. It is meant for
+normalization integrals of pdfs without analytical integral, which are
+recomputed every time a parameter changes during a fit.
+
+The integral is computed with a composite Gauss-Legendre rule on a tensor grid
+with `numNodes` nodes per subinterval. The number of subintervals per dimension
+starts at `minSubdivisions` and is doubled until two consecutive grids agree
+within the `epsRel` or `epsAbs` tolerance, or until the finer grid would have
+more than `maxPoints` points. The next integration starts directly at the
+converged number of subintervals, and the grids are kept as long as the limits
+don't change.
+
+If the integrand is a RooRealBinding, the integrand is cloned together with the
+integration variables, while the parameters stay shared with the original. The
+clone is evaluated on the whole grid with the vectorized RooFit::Evaluator, so
+RooBatchCompute is used. The first batch is checked against the scalar
+evaluation, and the integrator falls back to evaluating the points one by one if
+the batched evaluation is not possible or gives different values.
+
+The last `cacheSize` integrals are cached together with the parameters of the
+integrand and the limits, so integrals for parameter values that were already
+seen, like when the minimizer comes back to a previous point, are not computed
+again.
+
+The integrator is not used by default, but can be selected in the integrator
+configuration:
+~~~ {.cpp}
+RooAbsReal::defaultIntegratorConfig()->method2D().setLabel("RooBatchedIntegrator");
+pdf.specialIntegratorConfig(true)->method1D().setLabel("RooBatchedIntegrator");
+~~~
+**/
+
+#include "RooBatchedIntegrator.h"
+
+#include "RooAbsCategory.h"
+#include "RooArgSet.h"
+#include "RooMsgService.h"
+#include "RooNumber.h"
+#include "RooNumIntFactory.h"
+#include "RooRealBinding.h"
+#include "RooRealVar.h"
+#include "RooFit/Detail/NormalizationHelpers.h"
+#include "RooFit/Evaluator.h"
+#include "RooFitImplHelpers.h"
+
+#include <Math/Util.h>
+#include <TMath.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+/// Number of points for which the batched function evaluation is checked
+/// against the scalar one.
+constexpr std::size_t nValidationPoints = 16;
+
+/// Compute the nodes and weights of the n-point Gauss-Legendre rule in [-1, 1].
+void gaussLegendre(std::size_t n, std::vector<double> &nodes, std::vector<double> &weights)
+{
+   nodes.resize(n);
+   weights.resize(n);
+   for (std::size_t i = 0; i < (n + 1) / 2; ++i) {
+      // Newton iteration for the i-th root of the Legendre polynomial P_n
+      double z = std::cos(TMath::Pi() * (i + 0.75) / (n + 0.5));
+      double dp = 0.;
+      for (int iter = 0; iter < 100; ++iter) {
+         double p0 = 1.;
+         double p1 = 0.;
+         for (std::size_t j = 0; j < n; ++j) {
+            const double p2 = p1;
+            p1 = p0;
+            p0 = ((2. * j + 1.) * z * p1 - j * p2) / (j + 1.);
+         }
+         dp = n * (z * p0 - p1) / (z * z - 1.);
+         const double zOld = z;
+         z -= p0 / dp;
+         if (std::abs(z - zOld) < 1e-15) {
+            break;
+         }
+      }
+      nodes[i] = -z;
+      nodes[n - 1 - i] = z;
+      weights[i] = 2. / ((1. - z * z) * dp * dp);
+      weights[n - 1 - i] = weights[i];
+   }
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Register RooBatchedIntegrator, its parameters and capabilities with RooNumIntFactory.
+
+void RooBatchedIntegrator::registerIntegrator(RooNumIntFactory &fact)
+{
+   RooRealVar numNodes("numNodes", "Number of Gauss-Legendre nodes per subinterval", 8, 1, 64);
+   RooRealVar minSubdivisions("minSubdivisions", "Initial number of subintervals per dimension", 2, 1, 1e6);
+   RooRealVar maxPoints("maxPoints", "Maximum number of integration points per grid", 1e6, 1, 1e9);
+   RooRealVar cacheSize("cacheSize", "Number of integrals cached for different parameter values", 16, 0, 1e6);
+
+   auto creator = [](const RooAbsFunc &function, const RooNumIntConfig &config) {
+      return std::make_unique<RooBatchedIntegrator>(function, config);
+   };
+
+   fact.registerPlugin("RooBatchedIntegrator", creator, {numNodes, minSubdivisions, maxPoints, cacheSize},
+                       /*canIntegrate1D=*/true,
+                       /*canIntegrate2D=*/true,
+                       /*canIntegrateND=*/true,
+                       /*canIntegrateOpenEnded=*/false);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Construct an integrator for the given function binding, with the
+/// configuration taken from the RooBatchedIntegrator section of `config`.
+
+RooBatchedIntegrator::RooBatchedIntegrator(const RooAbsFunc &function, const RooNumIntConfig &config)
+   : RooAbsIntegrator(function), _epsAbs(config.epsAbs()), _epsRel(config.epsRel())
+{
+   assert(_function && _function->isValid());
+
+   const RooArgSet &section = config.getConfigSection("RooBatchedIntegrator");
+   gaussLegendre(static_cast<std::size_t>(section.getRealValue("numNodes")), _nodes, _weights);
+   _nSub = static_cast<std::size_t>(section.getRealValue("minSubdivisions"));
+   _maxPoints = section.getRealValue("maxPoints");
+   _cacheSize = static_cast<std::size_t>(section.getRealValue("cacheSize"));
+
+   const unsigned int nDim = _function->getDimension();
+   _x.resize(nDim);
+   _xmin.resize(nDim);
+   _xmax.resize(nDim);
+   while (_nSub > 1 && numPoints(_nSub) > _maxPoints) {
+      _nSub /= 2;
+   }
+
+   // The parameters of the integrand are only known for a RooRealBinding.
+   // Otherwise, the integrand is evaluated point by point and nothing is cached.
+   _binding = dynamic_cast<RooRealBinding const *>(_function);
+   if (_binding) {
+      RooArgSet obs;
+      for (unsigned int i = 0; i < nDim; ++i) {
+         obs.add(*_binding->observable(i));
+         _obsNames.emplace_back(_binding->observable(i)->GetName());
+      }
+      RooArgSet params;
+      _binding->function().getParameters(&obs, params);
+      _params.assign(params.begin(), params.end());
+   }
+
+   checkLimits();
+}
+
+RooBatchedIntegrator::~RooBatchedIntegrator() = default;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Change our integration limits. Return true if the new limits are
+/// ok, or otherwise false. Always returns false and does nothing
+/// if this object was constructed to always use our integrand's limits.
+
+bool RooBatchedIntegrator::setLimits(double *xmin, double *xmax)
+{
+   if (_useIntegrandLimits) {
+      oocoutE(nullptr, Integration) << "RooBatchedIntegrator::setLimits: cannot override integrand's limits"
+                                    << std::endl;
+      return false;
+   }
+   for (std::size_t i = 0; i < _xmin.size(); ++i) {
+      _xmin[i] = xmin[i];
+      _xmax[i] = xmax[i];
+   }
+   return checkLimits();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Check that our integration range is finite and otherwise return false.
+/// Update the limits from the integrand if requested.
+
+bool RooBatchedIntegrator::checkLimits() const
+{
+   if (_useIntegrandLimits) {
+      assert(nullptr != integrand() && integrand()->isValid());
+      for (std::size_t i = 0; i < _xmin.size(); ++i) {
+         _xmin[i] = integrand()->getMinLimit(i);
+         _xmax[i] = integrand()->getMaxLimit(i);
+      }
+   }
+   for (std::size_t i = 0; i < _xmin.size(); ++i) {
+      if (_xmax[i] <= _xmin[i]) {
+         oocoutE(nullptr, Integration) << "RooBatchedIntegrator::checkLimits: bad range with min >= max (_xmin = "
+                                       << _xmin[i] << " _xmax = " << _xmax[i] << ")" << std::endl;
+         return false;
+      }
+      if (RooNumber::isInfinite(_xmin[i]) || RooNumber::isInfinite(_xmax[i])) {
+         return false;
+      }
+   }
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create the Evaluator for the batched evaluation of the integrand. The
+/// integrand is cloned together with the integration variables, so their
+/// values can be set by the Evaluator without touching the original ones,
+/// while the parameters are shared. If the integrand can't be evaluated with
+/// the Evaluator, the points are evaluated one by one.
+
+void RooBatchedIntegrator::initEvaluator()
+{
+   _evaluatorInitialized = true;
+   if (!_binding) {
+      return;
+   }
+
+   RooAbsReal const &func = _binding->function();
+   RooArgSet obs;
+   for (unsigned int i = 0; i < _function->getDimension(); ++i) {
+      obs.add(*_binding->observable(i));
+   }
+
+   // Normalization variables that are not integrated over would be cloned
+   // when compiling the integrand, and not follow the original ones any more.
+   RooArgSet const *nset = _binding->normSet();
+   if (nset) {
+      for (RooAbsArg *arg : *nset) {
+         if (!obs.find(*arg)) {
+            oocxcoutI(&func, NumIntegration) << "RooBatchedIntegrator: " << func.GetName()
+                                             << " is normalized over variables that are not integrated over, "
+                                                "evaluating it point by point"
+                                             << std::endl;
+            return;
+         }
+      }
+   }
+   // The Evaluator assigns data tokens to all nodes that are not RooRealVars,
+   // so such parameters can't be shared with other computation graphs.
+   for (RooAbsArg *param : _params) {
+      if (auto *var = dynamic_cast<RooRealVar *>(param)) {
+         _sharedVars.push_back(var);
+      } else if (param->isFundamental()) {
+         oocxcoutI(&func, NumIntegration) << "RooBatchedIntegrator: parameter " << param->GetName() << " of "
+                                          << func.GetName()
+                                          << " is not a RooRealVar, evaluating the integrand point by point"
+                                          << std::endl;
+         return;
+      }
+   }
+
+   try {
+      _funcClone = RooHelpers::cloneTreeWithSameParameters(func, &obs);
+      _compiledFunc = RooFit::Detail::compileForNormSet(*_funcClone, nset ? *nset : RooArgSet{});
+      _evaluator = std::make_unique<RooFit::Evaluator>(*_compiledFunc);
+   } catch (std::exception const &exc) {
+      oocoutW(nullptr, Integration) << "RooBatchedIntegrator: integrand " << func.GetName()
+                                    << " can't be evaluated in batches (" << exc.what()
+                                    << "), evaluating it point by point" << std::endl;
+      _evaluator.reset();
+      _compiledFunc.reset();
+      _funcClone.reset();
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if a shared parameter is currently an input of another
+/// Evaluator, like a conditional observable in a fit. Our Evaluator would
+/// pick up the data token of the other one in this case.
+
+bool RooBatchedIntegrator::sharedParamsInUse() const
+{
+   return std::any_of(_sharedVars.begin(), _sharedVars.end(),
+                      [](RooRealVar const *var) { return var->hasDataToken(); });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Number of points of the grid with `nSub` subintervals per dimension.
+
+double RooBatchedIntegrator::numPoints(std::size_t nSub) const
+{
+   return std::pow(static_cast<double>(nSub * _nodes.size()), static_cast<double>(_xmin.size()));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the grid with `nSub` subintervals per dimension for the current
+/// limits. The grids are kept until the limits change.
+
+RooBatchedIntegrator::Grid const &RooBatchedIntegrator::grid(std::size_t nSub)
+{
+   if (_gridXmin != _xmin || _gridXmax != _xmax) {
+      _grids.clear();
+      _gridXmin = _xmin;
+      _gridXmax = _xmax;
+   }
+   for (Grid const &g : _grids) {
+      if (g.nSub == nSub) {
+         return g;
+      }
+   }
+
+   const std::size_t nDim = _xmin.size();
+   const std::size_t nNodes = _nodes.size();
+   const std::size_t nPoints1D = nSub * nNodes;
+
+   std::vector<std::vector<double>> coords1D(nDim);
+   std::vector<std::vector<double>> weights1D(nDim);
+   for (std::size_t iDim = 0; iDim < nDim; ++iDim) {
+      const double h = (_xmax[iDim] - _xmin[iDim]) / nSub;
+      for (std::size_t iSub = 0; iSub < nSub; ++iSub) {
+         for (std::size_t iNode = 0; iNode < nNodes; ++iNode) {
+            coords1D[iDim].push_back(_xmin[iDim] + h * (iSub + 0.5 * (1. + _nodes[iNode])));
+            weights1D[iDim].push_back(0.5 * h * _weights[iNode]);
+         }
+      }
+   }
+
+   const std::size_t nPoints = static_cast<std::size_t>(numPoints(nSub));
+   Grid &g = _grids.emplace_back();
+   g.nSub = nSub;
+   g.coords.assign(nDim, std::vector<double>(nPoints));
+   g.weights.assign(nPoints, 1.);
+   for (std::size_t iPoint = 0; iPoint < nPoints; ++iPoint) {
+      std::size_t rest = iPoint;
+      for (std::size_t iDim = 0; iDim < nDim; ++iDim) {
+         const std::size_t k = rest % nPoints1D;
+         rest /= nPoints1D;
+         g.coords[iDim][iPoint] = coords1D[iDim][k];
+         g.weights[iPoint] *= weights1D[iDim][k];
+      }
+   }
+   return g;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the integrand at one point of the grid with the function binding.
+
+double RooBatchedIntegrator::scalarValue(Grid const &g, std::size_t iPoint)
+{
+   for (std::size_t iDim = 0; iDim < _x.size(); ++iDim) {
+      _x[iDim] = g.coords[iDim][iPoint];
+   }
+   return integrand(_x.data());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the integrand at all points of the grid. The returned span has
+/// only one element if the integrand doesn't depend on the integration
+/// variables.
+
+std::span<const double> RooBatchedIntegrator::evaluate(Grid const &g)
+{
+   const std::size_t nPoints = g.weights.size();
+
+   if (_evaluator && !sharedParamsInUse()) {
+      for (std::size_t iDim = 0; iDim < _obsNames.size(); ++iDim) {
+         _evaluator->setInput(_obsNames[iDim], g.coords[iDim], false);
+      }
+      std::span<const double> values = _evaluator->run();
+
+      // Check the batched evaluation against the scalar one the first time,
+      // in case the integrand doesn't support the batched evaluation correctly.
+      if (!_evaluatorValidated) {
+         _evaluatorValidated = true;
+         for (std::size_t i = 0; i < std::min(nPoints, nValidationPoints); ++i) {
+            const double batchVal = values.size() == 1 ? values[0] : values[i];
+            const double scalarVal = scalarValue(g, i);
+            const double tolerance = 1e-6 * std::max(std::abs(scalarVal), std::numeric_limits<double>::min());
+            if (!(std::abs(batchVal - scalarVal) <= tolerance)) {
+               oocoutW(nullptr, Integration)
+                  << "RooBatchedIntegrator: batched evaluation of " << _binding->function().GetName() << " gives "
+                  << batchVal << " instead of " << scalarVal << ", evaluating it point by point" << std::endl;
+               _evaluator.reset();
+               _compiledFunc.reset();
+               _funcClone.reset();
+               break;
+            }
+         }
+      }
+      if (_evaluator) {
+         return values;
+      }
+   }
+
+   _scalarValues.resize(nPoints);
+   for (std::size_t i = 0; i < nPoints; ++i) {
+      _scalarValues[i] = scalarValue(g, i);
+   }
+   return _scalarValues;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Integrate over the grid with `nSub` subintervals per dimension.
+
+double RooBatchedIntegrator::integrateGrid(std::size_t nSub)
+{
+   Grid const &g = grid(nSub);
+   std::span<const double> values = evaluate(g);
+
+   ROOT::Math::KahanSum<double> sum;
+   if (values.size() == 1) {
+      for (double w : g.weights) {
+         sum += w;
+      }
+      return sum.Sum() * values[0];
+   }
+   for (std::size_t i = 0; i < g.weights.size(); ++i) {
+      sum += g.weights[i] * values[i];
+   }
+   return sum.Sum();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Calculate the numeric integral over all dimensions of the integrand. The
+/// `yvec` argument is ignored.
+
+double RooBatchedIntegrator::integral(const double *)
+{
+   assert(isValid());
+
+   if (!_evaluatorInitialized) {
+      initEvaluator();
+   }
+
+   std::vector<double> key;
+   if (_binding && _cacheSize > 0) {
+      for (RooAbsArg *param : _params) {
+         if (auto *real = dynamic_cast<RooAbsReal *>(param)) {
+            key.push_back(real->getVal());
+         } else if (auto *cat = dynamic_cast<RooAbsCategory *>(param)) {
+            key.push_back(cat->getCurrentIndex());
+         }
+      }
+      key.insert(key.end(), _xmin.begin(), _xmin.end());
+      key.insert(key.end(), _xmax.begin(), _xmax.end());
+
+      auto found = std::find_if(_cache.begin(), _cache.end(), [&](CacheEntry const &e) { return e.key == key; });
+      if (found != _cache.end()) {
+         _cache.splice(_cache.begin(), _cache, found);
+         return found->value;
+      }
+   }
+
+   // Refine the grid until two consecutive grids agree, starting at the
+   // number of subintervals that was sufficient for the previous integral.
+   std::size_t nSub = _nSub;
+   double coarse = integrateGrid(nSub);
+   double result = coarse;
+   while (true) {
+      if (numPoints(2 * nSub) > _maxPoints) {
+         oocoutW(nullptr, Integration) << "RooBatchedIntegrator::integral: integral of " << _function->getName()
+                                       << " did not converge within " << _maxPoints << " points, result is "
+                                       << result << std::endl;
+         break;
+      }
+      const double fine = integrateGrid(2 * nSub);
+      const double diff = std::abs(fine - coarse);
+      result = fine;
+      if (diff <= _epsRel * std::abs(fine) || (_epsAbs > 0. && diff <= _epsAbs)) {
+         break;
+      }
+      nSub *= 2;
+      coarse = fine;
+   }
+   _nSub = nSub;
+
+   // Only keep the grids that the next integration will start with.
+   _grids.erase(std::remove_if(_grids.begin(), _grids.end(),
+                               [&](Grid const &g) { return g.nSub != _nSub && g.nSub != 2 * _nSub; }),
+                _grids.end());
+
+   if (!key.empty()) {
+      _cache.push_front({std::move(key), result});
+      if (_cache.size() > _cacheSize) {
+         _cache.pop_back();
+      }
+   }
+
+   return result;
+}
@@ -0,0 +1,107 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2026, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#ifndef RooFit_RooBatchedIntegrator_h
+#define RooFit_RooBatchedIntegrator_h
+
+#include "RooAbsIntegrator.h"
+#include "RooNumIntConfig.h"
+
+#include <ROOT/RSpan.hxx>
+
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+class RooAbsArg;
+class RooAbsReal;
+class RooRealBinding;
+class RooRealVar;
+class RooNumIntFactory;
+
+namespace RooFit {
+class Evaluator;
+}
+
+class RooBatchedIntegrator : public RooAbsIntegrator {
+public:
+   RooBatchedIntegrator(const RooAbsFunc &function, const RooNumIntConfig &config);
+   ~RooBatchedIntegrator() override;
+
+   bool checkLimits() const override;
+   double integral(const double *yvec = nullptr) override;
+
+   using RooAbsIntegrator::setLimits;
+   bool setLimits(double *xmin, double *xmax) override;
+   bool setUseIntegrandLimits(bool flag) override
+   {
+      _useIntegrandLimits = flag;
+      return true;
+   }
+
+protected:
+   friend class RooNumIntFactory;
+   static void registerIntegrator(RooNumIntFactory &fact);
+
+private:
+   /// Integration points and weights for a given number of subintervals per dimension.
+   struct Grid {
+      std::size_t nSub = 0;                   ///< Number of subintervals per dimension
+      std::vector<std::vector<double>> coords; ///< Coordinates of the points, one vector per dimension
+      std::vector<double> weights;             ///< Quadrature weights of the points
+   };
+
+   /// Integral for given parameter values and limits.
+   struct CacheEntry {
+      std::vector<double> key;
+      double value = 0.;
+   };
+
+   void initEvaluator();
+   double numPoints(std::size_t nSub) const;
+   Grid const &grid(std::size_t nSub);
+   double integrateGrid(std::size_t nSub);
+   std::span<const double> evaluate(Grid const &grid);
+   double scalarValue(Grid const &grid, std::size_t iPoint);
+   bool sharedParamsInUse() const;
+
+   mutable std::vector<double> _xmin; ///<! Lower integration bounds
+   mutable std::vector<double> _xmax; ///<! Upper integration bounds
+   bool _useIntegrandLimits = true;   ///< If true limits of function binding are used
+
+   std::vector<double> _nodes;    ///< Gauss-Legendre nodes in [-1, 1]
+   std::vector<double> _weights;  ///< Gauss-Legendre weights in [-1, 1]
+   std::size_t _nSub = 1;         ///< Number of subintervals of the last converged integration
+   double _maxPoints = 0.;        ///< Maximum number of points per grid
+   std::size_t _cacheSize = 0;    ///< Maximum number of cached integrals
+   double _epsAbs = 0.;           ///< Absolute convergence tolerance
+   double _epsRel = 0.;           ///< Relative convergence tolerance
+
+   std::vector<Grid> _grids;       ///<! Grids for the current limits
+   std::vector<double> _gridXmin;  ///<! Lower limits for which the grids were made
+   std::vector<double> _gridXmax;  ///<! Upper limits for which the grids were made
+   std::vector<double> _x;         ///<! Point for the scalar function evaluation
+   std::vector<double> _scalarValues; ///<! Function values if the Evaluator can't be used
+
+   RooRealBinding const *_binding = nullptr;   ///< Integrand as RooRealBinding, if it is one
+   std::vector<RooAbsArg *> _params;           ///< Parameters of the integrand, for the cache key
+   std::vector<RooRealVar *> _sharedVars;      ///< Parameters shared between the integrand and its clone
+   std::list<CacheEntry> _cache;               ///<! Recently computed integrals, most recent first
+
+   std::vector<std::string> _obsNames;            ///< Names of the integration variables
+   std::unique_ptr<RooAbsReal> _funcClone;        ///< Clone of the integrand with its own observables
+   std::unique_ptr<RooAbsReal> _compiledFunc;     ///< Integrand compiled for the Evaluator
+   std::unique_ptr<RooFit::Evaluator> _evaluator; ///< Evaluator of the integrand on a whole grid
+   bool _evaluatorInitialized = false;            ///< Whether initEvaluator() was called
+   bool _evaluatorValidated = false;              ///< Whether the Evaluator was checked against scalar values
+};
+
+#endif
@@ -1734,6 +1734,38 @@ void RooDataSet::convertToTreeStore()
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Create a dataset that refers to external, contiguous arrays of values
+/// instead of copying them. No event is filled one by one, so even very large
+/// datasets are set up instantly and without doubling the memory. The batched
+/// likelihood evaluation reads the arrays directly.
+///
+/// The arrays are only read. A column is copied into owned storage when the
+/// dataset gets modified, e.g. when events are added. The values are not
+/// checked against the variable ranges.
+///
+/// \param[in] name Name of the dataset.
+/// \param[in] title Title of the dataset.
+/// \param[in] vars Real-valued variables of the dataset.
+/// \param[in] columns One array of values per variable, by variable name.
+/// \param[in] wgtVarName Name of the weight variable in `vars`, if any. Its
+///                       values have to be in `columns` as well.
+/// \param[in] owner Optional object that owns the arrays. It is kept alive as
+///                  long as the dataset or any of its clones refers to the
+///                  arrays. If not given, the arrays have to outlive the
+///                  dataset and its clones.
+std::unique_ptr<RooDataSet>
+RooDataSet::fromSpans(RooStringView name, RooStringView title, const RooArgSet &vars,
+                      std::map<std::string, std::span<const double>> const &columns, const char *wgtVarName,
+                      std::shared_ptr<const void> owner)
+{
+   auto data = std::make_unique<RooDataSet>(name, title, vars, wgtVarName ? RooFit::WeightVar(wgtVarName) : RooCmdArg{});
+   data->convertToVectorStore();
+   static_cast<RooVectorDataStore *>(data->store())->setExternalColumns(columns, std::move(owner));
+   return data;
+}
+
+
 namespace {
 
   // Compile-time test if we can still use TStrings for the constructors of
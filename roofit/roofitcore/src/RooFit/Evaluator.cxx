@@ -24,6 +24,11 @@ computations take place in the RooBatchCompute library and can be carried off
 by either the CPU or a CUDA-supporting GPU. The Evaluator class takes care
 of data transfers. An instance of this class is created every time
 RooAbsPdf::fitTo() is called and gets destroyed when the fitting ends.
+
+If implicit multi-threading is enabled with ROOT::EnableImplicitMT() when the
+Evaluator is created, the CPU computations over large datasets are split into
+chunks of events that are processed on the ROOT thread pool, see
+setUseMultiThreading().
 **/
 
 #include <RooFit/Evaluator.h>
@@ -39,6 +44,8 @@ RooAbsPdf::fitTo() is called and gets destroyed when the fitting ends.
 
 #include <RooBatchCompute.h>
 
+#include <TROOT.h>
+
 #include "RooFit/Detail/BatchModeDataHelpers.h"
 #include "RooFitImplHelpers.h"
 
@@ -207,6 +214,8 @@ Evaluator::Evaluator(const RooAbsReal &absReal, bool useGPU)
 
    syncDataTokens();
 
+   setUseMultiThreading(ROOT::IsImplicitMTEnabled());
+
    if (_useGPU) {
       // create events and streams for every node
       for (auto &info : _nodes) {
@@ -649,6 +658,38 @@ RooArgSet Evaluator::getParameters() const
    return parameters;
 }
 
+/// \brief Enables or disables the multi-threaded evaluation on the CPU.
+///
+/// In multi-threaded mode, the RooBatchCompute kernels and the reductions of
+/// nodes with many events split the events into chunks that are computed on
+/// the ROOT implicit multi-threading pool. The size of the chunks doesn't
+/// depend on the number of threads, and the reductions add up the partial
+/// results of the chunks in order. Therefore, the results don't depend on the
+/// number of threads.
+///
+/// The chunks are processed within the evaluation of each node rather than
+/// evaluating the whole computation graph per chunk, because some nodes keep
+/// mutable caches and are not safe to evaluate concurrently. Nodes that don't
+/// use RooBatchCompute are still evaluated on a single thread.
+///
+/// This is enabled by default if ROOT::EnableImplicitMT() was called before
+/// the Evaluator was created, and only has an effect if implicit
+/// multi-threading is enabled.
+///
+/// \param flag Whether to use multi-threading.
+void Evaluator::setUseMultiThreading(bool flag)
+{
+   RooBatchCompute::Config cfg;
+   cfg.setUseMultiThreading(flag);
+   for (auto &nodeInfo : _nodes) {
+      _evalContextCPU.setConfig(nodeInfo.absArg, cfg);
+      // The summation order of the reductions depends on the mode.
+      if (nodeInfo.absArg->isReducerNode()) {
+         nodeInfo.isDirty = true;
+      }
+   }
+}
+
 /// \brief Sets the offset mode for evaluation.
 ///
 /// This function sets the offset mode for evaluation to the specified mode.
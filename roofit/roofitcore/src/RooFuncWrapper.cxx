@@ -23,15 +23,196 @@
 #include <RooSimultaneous.h>
 #include "RooEvaluatorWrapper.h"
 
+#include <TEnv.h>
+#include <TLockFile.h>
+#include <TMD5.h>
 #include <TROOT.h>
 #include <TSystem.h>
 
 #include <fstream>
+#include <map>
+#include <regex>
+#include <set>
 
 namespace RooFit {
 
 namespace Experimental {
 
+namespace {
+
+/// Generated function of the process-wide code registry.
+struct GeneratedFunction {
+   std::string code;      ///< Definition, protected by an include guard.
+   bool declared = false; ///< Whether the definition was declared to the interpreter.
+   void *func = nullptr;  ///< Address of the compiled function.
+   void *grad = nullptr;  ///< Address of the compiled gradient.
+};
+
+/// The generated functions are named after the hash of their code, so an
+/// identical computation graph on identical data layout gives the same name.
+/// They are compiled and differentiated only once per process.
+std::map<std::string, GeneratedFunction> &codeRegistry()
+{
+   static std::map<std::string, GeneratedFunction> registry;
+   return registry;
+}
+
+std::string &cacheDirectoryRef()
+{
+   static std::string dir = gEnv->GetValue("RooFit.Codegen.CacheDir", "");
+   return dir;
+}
+
+/// Collect the code of a generated function, preceded by the code of the
+/// generated functions it calls.
+void collectCode(std::string const &funcName, std::stringstream &out, std::set<std::string> &done)
+{
+   if (!done.insert(funcName).second)
+      return;
+   std::string const &code = codeRegistry()[funcName].code;
+   static const std::regex nameRegex{"roo_func_wrapper_[0-9a-f]{32}"};
+   for (auto it = std::sregex_iterator(code.begin(), code.end(), nameRegex); it != std::sregex_iterator(); ++it) {
+      if (codeRegistry().count(it->str()))
+         collectCode(it->str(), out, done);
+   }
+   out << code << "\n";
+}
+
+std::string codeWithDependencies(std::string const &funcName)
+{
+   std::stringstream out;
+   std::set<std::string> done;
+   collectCode(funcName, out, done);
+   return out.str();
+}
+
+/// Declare a generated function and the functions it calls to the interpreter, if not done yet.
+void declareGeneratedCode(std::string const &funcName)
+{
+   GeneratedFunction &info = codeRegistry()[funcName];
+   if (info.declared)
+      return;
+   if (!gInterpreter->Declare(codeWithDependencies(funcName).c_str())) {
+      std::stringstream errorMsg;
+      errorMsg << "Function " << funcName << " could not be compiled. See above for details.";
+      oocoutE(nullptr, InputArguments) << errorMsg.str() << std::endl;
+      throw std::runtime_error(errorMsg.str().c_str());
+   }
+   std::set<std::string> done;
+   std::stringstream unused;
+   collectCode(funcName, unused, done);
+   for (std::string const &name : done)
+      codeRegistry()[name].declared = true;
+}
+
+/// Compile a generated function with ACLiC into a library in the cache
+/// directory, or load the library if it was compiled in an earlier session.
+void *loadFromCacheDirectory(std::string const &funcName)
+{
+   std::string const &dir = cacheDirectoryRef();
+   gSystem->mkdir(dir.c_str(), true);
+   const std::string fileName = dir + "/" + funcName + ".cxx";
+
+   // ACLiC writes the library, dictionary and dependency files in place, so
+   // concurrent jobs sharing the cache directory must not compile the same
+   // function at the same time. The other jobs wait and load the library. A
+   // lock older than ten minutes is left over by a crashed job and removed.
+   TLockFile lock{(dir + "/" + funcName + ".lock").c_str(), 600};
+
+   if (gSystem->AccessPathName(fileName.c_str())) {
+      std::ofstream outFile{fileName};
+      outFile << "#include <RooFit/Detail/MathFuncs.h>\n\n" << codeWithDependencies(funcName);
+   }
+   if (!gSystem->CompileMacro(fileName.c_str(), "kOs", "", dir.c_str())) {
+      oocoutW(nullptr, Fitting) << "RooFuncWrapper: could not compile " << fileName
+                                << " in the code cache directory, falling back to the interpreter." << std::endl;
+      return nullptr;
+   }
+   return gInterpreter->FindSym(funcName.c_str());
+}
+
+std::string gradientFileName(std::string const &funcName)
+{
+   return cacheDirectoryRef() + "/" + funcName + "_grad.cxx";
+}
+
+/// Load the gradient of a generated function from the library in the cache
+/// directory, if an earlier session could compile it there.
+void *loadGradientFromCacheDirectory(std::string const &funcName)
+{
+   std::string const &dir = cacheDirectoryRef();
+   const std::string fileName = gradientFileName(funcName);
+
+   TLockFile lock{(dir + "/" + funcName + ".lock").c_str(), 600};
+
+   if (gSystem->AccessPathName(fileName.c_str()))
+      return nullptr;
+   if (!gSystem->CompileMacro(fileName.c_str(), "kOs", "", dir.c_str())) {
+      oocoutW(nullptr, Fitting) << "RooFuncWrapper: could not load the gradient " << fileName
+                                << " from the code cache directory, generating it with Clad." << std::endl;
+      return nullptr;
+   }
+   return gInterpreter->FindSym((funcName + "_grad_0").c_str());
+}
+
+/// Whether a gradient generated by Clad can be compiled without Clad: it may
+/// only call the derivatives that come with the Clad headers, and not the ones
+/// Clad generated for the other functions it calls.
+bool isSelfContainedGradient(std::string const &code, std::string const &gradName)
+{
+   static const std::regex derivativeRegex{"([A-Za-z_][A-Za-z0-9_:]*)_(pullback|pushforward|reverse_forw)\\s*\\("};
+   for (auto it = std::sregex_iterator(code.begin(), code.end(), derivativeRegex); it != std::sregex_iterator(); ++it) {
+      const std::string name = (*it)[1].str();
+      if (name.rfind("clad::custom_derivatives::", 0) != 0 || name.find("TMath::") != std::string::npos)
+         return false;
+   }
+   static const std::regex nameRegex{"roo_func_wrapper_[0-9a-f]{32}\\w*"};
+   for (auto it = std::sregex_iterator(code.begin(), code.end(), nameRegex); it != std::sregex_iterator(); ++it) {
+      if (it->str() != gradName)
+         return false;
+   }
+   return true;
+}
+
+/// Compile the code of a gradient generated by Clad into a library in the
+/// cache directory, next to the library of the function. The library is only
+/// loaded by later sessions, because the gradient is already declared to the
+/// interpreter of this one.
+void writeGradientToCacheDirectory(std::string const &funcName, std::string code)
+{
+   const std::string gradName = funcName + "_grad_0";
+   const std::size_t pos = code.find("void " + gradName + "(");
+   if (pos == std::string::npos || !isSelfContainedGradient(code, gradName)) {
+      oocoutI(nullptr, Fitting) << "RooFuncWrapper: the gradient " << gradName
+                                << " calls derivatives generated for other functions and is not cached." << std::endl;
+      return;
+   }
+   // The C linkage is needed to look up the gradient in the library.
+   code.insert(pos, "extern \"C\" ");
+
+   std::string const &dir = cacheDirectoryRef();
+   const std::string fileName = gradientFileName(funcName);
+
+   TLockFile lock{(dir + "/" + funcName + ".lock").c_str(), 600};
+
+   // another job was faster
+   if (!gSystem->AccessPathName(fileName.c_str()))
+      return;
+   {
+      std::ofstream outFile{fileName};
+      outFile << "#include <RooFit/Detail/MathFuncs.h>\n"
+              << "#include <clad/Differentiator/Differentiator.h>\n\n"
+              << code << "\n";
+   }
+   if (!gSystem->CompileMacro(fileName.c_str(), "kOsc", "", dir.c_str())) {
+      oocoutW(nullptr, Fitting) << "RooFuncWrapper: could not compile " << fileName
+                                << " in the code cache directory, the gradient will be generated with Clad." << std::endl;
+      gSystem->Unlink(fileName.c_str());
+   }
+}
+
+} // namespace
+
 RooFuncWrapper::RooFuncWrapper(const char *name, const char *title, RooAbsReal &obj, const RooAbsData *data,
                                RooSimultaneous const *simPdf, bool useEvaluator)
    : RooAbsReal{name, title}, _params{"!params", "List of parameters", this}, _useEvaluator{useEvaluator}
@@ -61,7 +242,16 @@ RooFuncWrapper::RooFuncWrapper(const char *name, const char *title, RooAbsReal &
 
    // Declare the function and create its derivative.
    _funcName = declareFunction(func);
-   _func = reinterpret_cast<Func>(gInterpreter->ProcessLine((_funcName + ";").c_str()));
+
+   GeneratedFunction &info = codeRegistry()[_funcName];
+   if (!info.func && !cacheDirectoryRef().empty()) {
+      info.func = loadFromCacheDirectory(_funcName);
+   }
+   if (!info.func) {
+      declareGeneratedCode(_funcName);
+      info.func = reinterpret_cast<void *>(gInterpreter->ProcessLine((_funcName + ";").c_str()));
+   }
+   _func = reinterpret_cast<Func>(info.func);
 }
 
 RooFuncWrapper::RooFuncWrapper(const RooFuncWrapper &other, const char *name)
@@ -122,37 +312,89 @@ void RooFuncWrapper::loadParamsAndData(RooAbsArg const *head, RooArgSet const &p
    }
 }
 
+/// @brief Declare a function with the given body and return its name.
+/// The name is derived from the hash of the body, which encodes the structure
+/// of the computation graph and the layout of the data. Identical functions are
+/// therefore compiled only once per process, and their compiled code can be
+/// reused across processes via the code cache directory (see setCacheDirectory()).
+/// If the code cache directory is set, the function is not declared to the
+/// interpreter here but compiled in one go with its callers.
 std::string RooFuncWrapper::declareFunction(std::string const &funcBody)
 {
-   static int iFuncWrapper = 0;
-   auto funcName = "roo_func_wrapper_" + std::to_string(iFuncWrapper++);
-
-   // Declare the function
-   std::stringstream bodyWithSigStrm;
-   bodyWithSigStrm << "double " << funcName << "(double* params, double const* obs, double const* xlArr) {\n"
-                   << funcBody << "\n}";
-   if (!declareToInterpreter(bodyWithSigStrm.str())) {
-      std::stringstream errorMsg;
-      errorMsg << "Function " << funcName << " could not be compiled. See above for details.";
-      oocoutE(nullptr, InputArguments) << errorMsg.str() << std::endl;
-      throw std::runtime_error(errorMsg.str().c_str());
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(funcBody.data()), funcBody.size());
+   md5.Final();
+   std::string funcName = std::string{"roo_func_wrapper_"} + md5.AsString();
+
+   GeneratedFunction &info = codeRegistry()[funcName];
+   if (info.code.empty()) {
+      // The include guard makes it harmless to declare the same code again,
+      // for example from the dictionary of a library in the cache directory.
+      // The C linkage is needed to look up the function in such a library.
+      std::stringstream codeStrm;
+      codeStrm << "#ifndef " << funcName << "_defined\n"
+               << "#define " << funcName << "_defined\n"
+               << "extern \"C\" double " << funcName
+               << "(double* params, double const* obs, double const* xlArr) {\n"
+               << funcBody << "\n}\n"
+               << "#endif";
+      info.code = codeStrm.str();
+   }
+
+   if (cacheDirectoryRef().empty()) {
+      declareGeneratedCode(funcName);
    }
    return funcName;
 }
 
+/// @brief Set the directory where the code generated for likelihoods is
+/// compiled into shared libraries, to be reused by later processes.
+/// The directory is created if it doesn't exist. An empty string, which is the
+/// default, disables the cache. The default can be set in the `.rootrc` file
+/// with `RooFit.Codegen.CacheDir`.
+/// The gradient generated by Clad is compiled into a library there as well,
+/// so later processes don't run Clad again.
+/// \note A gradient that calls the derivatives Clad generated for other
+/// functions is not cached, because Clad only returns the code of the gradient
+/// itself. It is generated with Clad once per process.
+void RooFuncWrapper::setCacheDirectory(std::string const &dir)
+{
+   cacheDirectoryRef() = dir;
+}
+
+/// @brief Return the directory where the generated code is cached, or an empty string if caching is disabled.
+std::string const &RooFuncWrapper::cacheDirectory()
+{
+   return cacheDirectoryRef();
+}
+
 void RooFuncWrapper::createGradient()
 {
+   GeneratedFunction &info = codeRegistry()[_funcName];
+   if (!info.grad && !cacheDirectoryRef().empty()) {
+      info.grad = loadGradientFromCacheDirectory(_funcName);
+   }
+   if (info.grad) {
+      _grad = reinterpret_cast<Grad>(info.grad);
+      _hasGradient = true;
+      return;
+   }
+
    std::string gradName = _funcName + "_grad_0";
    std::string requestName = _funcName + "_req";
 
+   // Clad needs the definition of the function in the interpreter.
+   declareGeneratedCode(_funcName);
+
    // Calculate gradient
    declareToInterpreter("#include <Math/CladDerivator.h>\n");
+   // The request returns the code of the gradient, to be written to the code cache directory.
    // disable clang-format for making the following code unreadable.
    // clang-format off
    std::stringstream requestFuncStrm;
    requestFuncStrm << "#pragma clad ON\n"
-                      "void " << requestName << "() {\n"
-                      "  clad::gradient(" << _funcName << ", \"params\");\n"
+                      "const char *" << requestName << "() {\n"
+                      "  return clad::gradient(" << _funcName << ", \"params\").getCode();\n"
                       "}\n"
                       "#pragma clad OFF";
    // clang-format on
@@ -163,8 +405,15 @@ void RooFuncWrapper::createGradient()
       throw std::runtime_error(errorMsg.str().c_str());
    }
 
-   _grad = reinterpret_cast<Grad>(gInterpreter->ProcessLine((gradName + ";").c_str()));
+   info.grad = reinterpret_cast<void *>(gInterpreter->ProcessLine((gradName + ";").c_str()));
+   _grad = reinterpret_cast<Grad>(info.grad);
    _hasGradient = true;
+
+   if (!cacheDirectoryRef().empty()) {
+      auto code = reinterpret_cast<const char *>(gInterpreter->ProcessLine((requestName + "();").c_str()));
+      if (code)
+         writeGradientToCacheDirectory(_funcName, code);
+   }
 }
 
 void RooFuncWrapper::gradient(double *out) const
@@ -238,6 +487,7 @@ void RooFuncWrapper::writeDebugMacro(std::string const &filename) const
    outFile.open(filename + ".C");
    outFile << "#include <RooFit/Detail/MathFuncs.h>" << std::endl;
    outFile << std::endl;
+   outFile << codeWithDependencies(_funcName);
    outFile << _allCode.str();
    outFile << std::endl;
 
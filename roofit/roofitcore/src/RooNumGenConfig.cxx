@@ -44,6 +44,17 @@ ClassImp(RooNumGenConfig);
 RooNumGenConfig& RooNumGenConfig::defaultConfig()
 {
   static RooNumGenConfig defaultConfig;
+  static bool initStarted = false;
+
+  if (!initStarted) {
+    // The RooNumGenFactory registers the samplers in this configuration,
+    // such that their labels can be selected before any generation took
+    // place. Its init() calls back to us, which is why the flag is flipped
+    // before creating the factory (see RooNumIntConfig).
+    initStarted = true;
+    RooNumGenFactory::instance();
+  }
+
   return defaultConfig;
 }
 
@@ -38,19 +38,23 @@ the preference of the caller as encoded in the configuration object.
 #include "RooNumber.h"
 
 #include "RooAcceptReject.h"
+#include "RooBatchedAcceptReject.h"
 #include "RooFoamGenerator.h"
 
 
 #include "RooMsgService.h"
 
+#include <memory>
+
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Constructor. Register all known integrators by calling
+/// Register all known samplers by calling
 /// their static registration functions
 
-RooNumGenFactory::RooNumGenFactory()
+void RooNumGenFactory::init()
 {
   RooAcceptReject::registerSampler(*this) ;
+  RooBatchedAcceptReject::registerSampler(*this) ;
   RooFoamGenerator::registerSampler(*this) ;
 
   // Prepare default
@@ -86,6 +90,12 @@ RooNumGenFactory::~RooNumGenFactory()
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Constructor
+
+RooNumGenFactory::RooNumGenFactory() = default;
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Copy constructor
 
@@ -100,8 +110,18 @@ RooNumGenFactory::RooNumGenFactory(const RooNumGenFactory& other) : TObject(othe
 
 RooNumGenFactory& RooNumGenFactory::instance()
 {
-  static RooNumGenFactory instance;
-  return instance;
+  static std::unique_ptr<RooNumGenFactory> instance;
+
+  if (!instance) {
+    // This is needed to break a deadlock. During init(), the samplers are
+    // registered in RooNumGenConfig::defaultConfig(), which calls back to this
+    // function. So we need to construct first, and ensure that we can return
+    // an instance while we are waiting for init() to finish.
+    instance.reset(new RooNumGenFactory);
+    instance->init();
+  }
+
+  return *instance;
 }
 
 
@@ -48,6 +48,8 @@ protected:
 
   RooNumGenFactory();
   RooNumGenFactory(const RooNumGenFactory& other) ;
+
+  void init();
 };
 
 #endif
@@ -43,6 +43,7 @@ the preference of the caller as encoded in the configuration object.
 #include "RooImproperIntegrator1D.h"
 #include "RooMCIntegrator.h"
 #include "RooAdaptiveIntegratorND.h"
+#include "RooBatchedIntegrator.h"
 
 #include "RooMsgService.h"
 
@@ -60,6 +61,7 @@ void RooNumIntFactory::init() {
   //RooAdaptiveGaussKronrodIntegrator1D::registerIntegrator(*this) ;
   //RooGaussKronrodIntegrator1D::registerIntegrator(*this) ;
   RooAdaptiveIntegratorND::registerIntegrator(*this) ;
+  RooBatchedIntegrator::registerIntegrator(*this) ;
 
   RooNumIntConfig::defaultConfig().method1D().setLabel("RooIntegrator1D") ;
   RooNumIntConfig::defaultConfig().method1DOpen().setLabel("RooImproperIntegrator1D") ;
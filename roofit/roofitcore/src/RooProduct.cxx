@@ -30,7 +30,9 @@ Represents the product of a given set of RooAbsReal objects.
 #include "RooAbsCategory.h"
 #include "RooMsgService.h"
 #include "RooTrace.h"
+#include "RooBatchCompute.h"
 
+#include <array>
 #include <cmath>
 #include <memory>
 
@@ -376,6 +378,17 @@ void RooProduct::doEval(RooFit::EvalContext & ctx) const
   std::span<double> output = ctx.output();
   std::size_t nEvents = output.size();
 
+  if (_compCSet.empty()) {
+    std::vector<std::span<const double>> factors;
+    factors.reserve(_compRSet.size());
+    for (const auto item : _compRSet) {
+      factors.push_back(ctx.at(static_cast<const RooAbsReal*>(item)));
+    }
+    std::array<double, 1> special{static_cast<double>(factors.size())};
+    RooBatchCompute::compute(ctx.config(this), RooBatchCompute::ProdPdf, output, factors, special);
+    return;
+  }
+
   for (unsigned int i = 0; i < nEvents; ++i) {
     output[i] = 1.;
   }
@@ -52,6 +52,7 @@ to the fractions of the various functions. **This requires setting the last argu
 #include "RooRealVar.h"
 #include "RooMsgService.h"
 #include "RooNaNPacker.h"
+#include "RooBatchCompute.h"
 
 #include <TError.h>
 
@@ -254,6 +255,29 @@ void RooRealSumPdf::doEval(RooFit::EvalContext & ctx) const
   std::span<double> output = ctx.output();
   std::size_t nEvents = output.size();
 
+  // With a coefficient for every function, as in HistFactory models, the sum
+  // is done by the vectorized RooBatchCompute function of RooAddPdf.
+  if (_coefList.size() == _funcList.size()) {
+    std::vector<std::span<const double>> funcs;
+    std::vector<double> coefs;
+    for (unsigned int i = 0; i < _funcList.size(); ++i) {
+      const auto func = static_cast<RooAbsReal *>(&_funcList[i]);
+      if (func->isSelectedComp()) {
+        funcs.push_back(ctx.at(func));
+        coefs.push_back(ctx.at(&_coefList[i])[0]);
+      }
+    }
+    if (!funcs.empty()) {
+      RooBatchCompute::compute(ctx.config(this), RooBatchCompute::AddPdf, output, funcs, coefs);
+      if (_doFloor || _doFloorGlobal) {
+        for (unsigned int j = 0; j < nEvents; ++j) {
+          output[j] = std::max(0., output[j]);
+        }
+      }
+      return;
+    }
+  }
+
   // Do running sum of coef/func pairs, calculate lastCoef.
   std::fill(output.begin(), output.end(), 0.);
 
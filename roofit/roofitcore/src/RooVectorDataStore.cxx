@@ -47,6 +47,8 @@ which returns spans pointing directly to the data.
 #include "TBuffer.h"
 
 #include <iomanip>
+#include <stdexcept>
+#include <string>
 using std::string, std::vector, std::cout, std::endl, std::list;
 
 ClassImp(RooVectorDataStore);
@@ -1073,9 +1075,9 @@ void RooVectorDataStore::dump()
   for (const auto elm : _realStoreList) {
     cout << "RealVector " << elm << " _nativeReal = " << elm->_nativeReal << " = " << elm->_nativeReal->GetName() << " bufptr = " << elm->_buf  << endl ;
     cout << " values : " ;
-    Int_t imax = elm->_vec.size()>10 ? 10 : elm->_vec.size() ;
+    Int_t imax = elm->size()>10 ? 10 : elm->size() ;
     for (Int_t i=0 ; i<imax ; i++) {
-      cout << elm->_vec[i] << " " ;
+      cout << elm->rawData()[i] << " " ;
     }
     cout << endl ;
   }
@@ -1085,9 +1087,9 @@ void RooVectorDataStore::dump()
     << " bufptr = " << elm->_buf  << " errbufptr = " << elm->bufE() << endl ;
 
     cout << " values : " ;
-    Int_t imax = elm->_vec.size()>10 ? 10 : elm->_vec.size() ;
+    Int_t imax = elm->size()>10 ? 10 : elm->size() ;
     for (Int_t i=0 ; i<imax ; i++) {
-      cout << elm->_vec[i] << " " ;
+      cout << elm->rawData()[i] << " " ;
     }
     cout << endl ;
     if (elm->bufE()) {
@@ -1124,7 +1126,24 @@ void RooVectorDataStore::Streamer(TBuffer &R__b)
     }
 
   } else {
+    // Columns that refer to external arrays are copied only for the time of
+    // writing, so the dataset doesn't keep a second copy afterwards.
+    std::vector<RealVector *> external;
+    for (auto elm : _realStoreList) {
+      if (elm->hasExternalData()) external.push_back(elm);
+    }
+    for (auto elm : _realfStoreList) {
+      if (elm->hasExternalData()) external.push_back(elm);
+    }
+    for (auto elm : external) {
+      elm->_vec.assign(elm->rawData(), elm->rawData() + elm->size());
+    }
+
     R__b.WriteClassBuffer(RooVectorDataStore::Class(),this);
+
+    for (auto elm : external) {
+      std::vector<double>().swap(elm->_vec);
+    }
   }
 }
 
@@ -1344,11 +1363,11 @@ void RooVectorDataStore::recomputeSumWeight() {
     const std::string wgtName = _wgtVar->GetName();
     for(auto const* real : _realStoreList) {
       if(wgtName == real->_nativeReal->GetName())
-        arr = real->_vec.data();
+        arr = real->rawData();
     }
     for(auto const* real : _realfStoreList) {
       if(wgtName == real->_nativeReal->GetName())
-        arr = real->_vec.data();
+        arr = real->rawData();
     }
   }
   if(arr == nullptr) {
@@ -1368,11 +1387,11 @@ RooVectorDataStore::ArraysStruct  RooVectorDataStore::getArrays() const {
   out.size = size();
 
   for(auto const* real : _realStoreList) {
-    out.reals.emplace_back(real->_nativeReal->GetName(), real->_vec.data());
+    out.reals.emplace_back(real->_nativeReal->GetName(), real->rawData());
   }
   for(auto const* realf : _realfStoreList) {
     std::string name = realf->_nativeReal->GetName();
-    out.reals.emplace_back(name, realf->_vec.data());
+    out.reals.emplace_back(name, realf->rawData());
     if(realf->bufE()) out.reals.emplace_back(name + "Err", realf->dataE().data());
     if(realf->bufEL()) out.reals.emplace_back(name + "ErrLo", realf->dataEL().data());
     if(realf->bufEH()) out.reals.emplace_back(name + "ErrHi", realf->dataEH().data());
@@ -1388,3 +1407,73 @@ RooVectorDataStore::ArraysStruct  RooVectorDataStore::getArrays() const {
 
   return out;
 }
+
+
+/// Let the real-valued columns of this store refer to external, contiguous
+/// arrays instead of owning copies of the values. This avoids doubling the
+/// memory when importing large datasets, e.g. from NumPy arrays or RDataFrame
+/// columns, and the spans returned by getBatches() point directly into the
+/// external arrays.
+///
+/// The store must be empty, must not have category columns nor variables that
+/// store errors (StoreError() or StoreAsymError()), and there must be one array
+/// per real-valued column, including the weight variable if there
+/// is one. The values are not checked against the variable ranges. The arrays
+/// are only read: a column is copied into owned storage when it gets modified,
+/// for example when appending events.
+///
+/// \param[in] columns Arrays of values, by name of the dataset variable.
+/// \param[in] owner Optional object that owns the arrays. It is kept alive as
+///                  long as any column of this store or its clones refers to
+///                  the arrays. If not given, the caller has to make sure that
+///                  the arrays outlive the store.
+void RooVectorDataStore::setExternalColumns(std::map<std::string, std::span<const double>> const &columns,
+                                            std::shared_ptr<const void> owner)
+{
+  if (size() != 0) {
+    throw std::invalid_argument("RooVectorDataStore::setExternalColumns(): the store is not empty.");
+  }
+  if (!_catStoreList.empty()) {
+    throw std::invalid_argument("RooVectorDataStore::setExternalColumns(): category columns are not supported.");
+  }
+  for (auto const *realf : _realfStoreList) {
+    if (realf->bufE() || realf->bufEL() || realf->bufEH()) {
+      throw std::invalid_argument(std::string("RooVectorDataStore::setExternalColumns(): the variable '") +
+                                  realf->_nativeReal->GetName() + "' stores errors, which is not supported.");
+    }
+  }
+
+  std::vector<RealVector *> reals{_realStoreList.begin(), _realStoreList.end()};
+  reals.insert(reals.end(), _realfStoreList.begin(), _realfStoreList.end());
+
+  if (columns.size() != reals.size()) {
+    throw std::invalid_argument("RooVectorDataStore::setExternalColumns(): expected " + std::to_string(reals.size()) +
+                                " columns, but got " + std::to_string(columns.size()) + ".");
+  }
+
+  if (columns.empty()) {
+    return;
+  }
+
+  const std::size_t nEvents = columns.begin()->second.size();
+  for (auto const &item : columns) {
+    if (item.second.size() != nEvents) {
+      throw std::invalid_argument("RooVectorDataStore::setExternalColumns(): the column '" + item.first +
+                                  "' has a different size than the others.");
+    }
+  }
+
+  for (RealVector *real : reals) {
+    auto found = columns.find(real->_nativeReal->GetName());
+    if (found == columns.end()) {
+      throw std::invalid_argument(std::string("RooVectorDataStore::setExternalColumns(): no column for variable '") +
+                                  real->_nativeReal->GetName() + "'.");
+    }
+  }
+
+  for (RealVector *real : reals) {
+    real->setExternalData(columns.at(real->_nativeReal->GetName()), owner);
+  }
+
+  recomputeSumWeight();
+}
@@ -17,14 +17,42 @@
 #include "RooFit/MultiProcess/ProcessTimer.h"
 #include "RooFit/MultiProcess/Queue.h"
 #include "RooFit/MultiProcess/Config.h"
+#include "RooFit/TestStatistics/RooSumL.h"
 #include "RooMsgService.h"
 #include "RooMinimizer.h"
+#include "RooNaNPacker.h"
+#include "RooRealVar.h"
 
 #include "Minuit2/MnStrategy.h"
 
+#include <cmath>
+#include <stdexcept>
+
 namespace RooFit {
 namespace TestStatistics {
 
+/// With the thread backend, every worker thread takes its partial derivatives on a clone of the likelihood with its
+/// own parameters, through its own copy of the NumericalDerivator state. The clone is evaluated through this function.
+struct LikelihoodGradientJob::ThreadClone : public ROOT::Math::IMultiGenFunction {
+   ThreadClone(const LikelihoodGradientJob &inJob) : job{inJob} {}
+
+   ROOT::Math::IMultiGenFunction *Clone() const override
+   {
+      throw std::runtime_error("LikelihoodGradientJob::ThreadClone cannot be cloned.");
+   }
+
+   unsigned int NDim() const override { return minuitParameters.size(); }
+
+   const LikelihoodGradientJob &job;
+   RooArgSet parameters;                     ///< the parameters of the clone (owned)
+   std::unique_ptr<RooAbsL> likelihood;
+   std::vector<RooRealVar *> minuitParameters; ///< parameters of the clone in the order of the Minuit parameters
+   std::unique_ptr<ROOT::Minuit2::NumericalDerivator> derivator;
+
+private:
+   double DoEval(const double *x) const override { return job.evaluateThreadClone(*this, x); }
+};
+
 LikelihoodGradientJob::LikelihoodGradientJob(std::shared_ptr<RooAbsL> likelihood,
                                              std::shared_ptr<WrapperCalculationCleanFlags> calculation_is_clean,
                                              std::size_t N_dim, RooMinimizer *minimizer, SharedOffset offset)
@@ -37,6 +65,8 @@ LikelihoodGradientJob::LikelihoodGradientJob(std::shared_ptr<RooAbsL> likelihood
    offsets_previous_ = shared_offset_.offsets();
 }
 
+LikelihoodGradientJob::~LikelihoodGradientJob() = default;
+
 void LikelihoodGradientJob::synchronizeParameterSettings(
    const std::vector<ROOT::Fit::ParameterSettings> &parameter_settings)
 {
@@ -47,6 +77,9 @@ void LikelihoodGradientJob::synchronizeParameterSettings(
    ROOT::Math::IMultiGenFunction *function, const std::vector<ROOT::Fit::ParameterSettings> &parameter_settings)
 {
    gradf_.SetInitialGradient(function, parameter_settings, grad_);
+   // the parameters may have changed, so the clones are recreated in the next gradient calculation
+   thread_clones_.clear();
+   thread_clones_unsupported_ = false;
 }
 
 void LikelihoodGradientJob::synchronizeWithMinimizer(const ROOT::Math::MinimizerOptions &options)
@@ -90,7 +123,13 @@ void LikelihoodGradientJob::setErrorLevel(double error_level) const
 
 void LikelihoodGradientJob::evaluate_task(std::size_t task)
 {
-   run_derivator(task);
+   if (get_manager()->uses_threads()) {
+      ThreadClone &clone = *thread_clones_[get_manager()->worker_id()];
+      grad_[task] = clone.derivator->FastPartialDerivative(&clone, minimizer_->fitter()->Config().ParamsSettings(),
+                                                           task, grad_[task]);
+   } else {
+      run_derivator(task);
+   }
 }
 
 // SYNCHRONIZATION FROM WORKERS TO MASTER
@@ -204,30 +243,129 @@ void LikelihoodGradientJob::run_derivator(unsigned int i_component) const
       minimizer_->getMultiGenFcn(), minimizer_->fitter()->Config().ParamsSettings(), i_component, grad_[i_component]);
 }
 
+/// Create the clones of the likelihood for the worker threads, unless they exist already. Returns false if the
+/// likelihood cannot be cloned.
+bool LikelihoodGradientJob::setupThreadClones()
+{
+   if (thread_clones_.empty() && !thread_clones_unsupported_) {
+      std::unique_ptr<RooArgSet> parameters{likelihood_->getParameters()};
+      auto const &parameter_settings = minimizer_->fitter()->Config().ParamsSettings();
+
+      for (std::size_t ix = 0; ix < get_manager()->N_workers(); ++ix) {
+         auto clone = std::make_unique<ThreadClone>(*this);
+         parameters->snapshot(clone->parameters);
+         clone->likelihood = likelihood_->cloneWithParameters(clone->parameters);
+         if (!clone->likelihood) {
+            oocoutI(nullptr, Minimization) << "LikelihoodGradientJob: " << likelihood_->GetInfo()
+                                           << " cannot be cloned for the worker threads, the partial derivatives will "
+                                              "be calculated on the master."
+                                           << std::endl;
+            thread_clones_.clear();
+            thread_clones_unsupported_ = true;
+            break;
+         }
+         for (auto const &setting : parameter_settings) {
+            clone->minuitParameters.push_back(static_cast<RooRealVar *>(clone->parameters.find(setting.Name().c_str())));
+         }
+         thread_clones_.push_back(std::move(clone));
+      }
+   }
+   return !thread_clones_.empty();
+}
+
+/// Value of the clone of a worker thread at the Minuit external parameter values \p x. This is what
+/// MinuitFcnGrad::operator() returns on the master during the gradient calculation, i.e. the likelihood minus the
+/// shared offsets with the same handling of evaluation errors, but without changing any state of the master.
+double LikelihoodGradientJob::evaluateThreadClone(const ThreadClone &clone, const double *x) const
+{
+   for (std::size_t ix = 0; ix < clone.minuitParameters.size(); ++ix) {
+      if (clone.minuitParameters[ix]->getVal() != x[ix]) {
+         clone.minuitParameters[ix]->setVal(x[ix]);
+      }
+   }
+
+   // Offsets that are not applied are zero, see LikelihoodWrapper::calculate_offsets.
+   auto const &offsets = shared_offset_.offsets();
+   ROOT::Math::KahanSum<double> result;
+   if (dynamic_cast<RooSumL *>(clone.likelihood.get())) {
+      RooNaNPacker packedNaN;
+      for (std::size_t comp_ix = 0; comp_ix < clone.likelihood->getNComponents(); ++comp_ix) {
+         auto component_result = clone.likelihood->evaluatePartition({0, 1}, comp_ix, comp_ix + 1);
+         packedNaN.accumulate(component_result.Sum());
+         result += offsets.empty() ? component_result : component_result - offsets[comp_ix];
+      }
+      if (packedNaN.getPayload() != 0) {
+         result = ROOT::Math::KahanSum<double>(packedNaN.getNaNWithPayload());
+      }
+   } else {
+      result = clone.likelihood->evaluatePartition({0, 1}, 0, 0);
+      if (!offsets.empty()) {
+         result -= offsets[0];
+      }
+   }
+
+   // see RooAbsMinimizerFcn::applyEvalErrorHandling
+   double fvalue = result.Sum();
+   if (!std::isfinite(fvalue) || fvalue > 1e30) {
+      if (minimizer_->_cfg.doEEWall) {
+         const double maxFCN = minimizer_->maxFCN();
+         fvalue = (std::isfinite(maxFCN) ? maxFCN : 0.) + minimizer_->_cfg.recoverFromNaN * RooNaNPacker::unpackNaN(fvalue);
+      }
+   } else {
+      fvalue += minimizer_->fcnOffset();
+   }
+   return fvalue;
+}
+
 void LikelihoodGradientJob::calculate_all()
 {
-   if (get_manager()->process_manager().is_master()) {
+   if (get_manager()->is_master()) {
       isCalculating_ = true;
-      update_workers_state();
 
-      // master fills queue with tasks
-      for (std::size_t ix = 0; ix < N_tasks_; ++ix) {
-         MultiProcess::JobTask job_task{id_, state_id_, ix};
-         get_manager()->queue()->add(job_task);
+      if (get_manager()->uses_threads()) {
+         gradf_.SetupDifferentiate(minimizer_->getMultiGenFcn(), minuit_internal_x_.data(),
+                                   minimizer_->fitter()->Config().ParamsSettings());
+         if (setupThreadClones()) {
+            // each thread starts from the state that was just set up on the master, including the function value
+            for (auto &clone : thread_clones_) {
+               clone->derivator = std::make_unique<ROOT::Minuit2::NumericalDerivator>(gradf_);
+            }
+            for (std::size_t ix = 0; ix < N_tasks_; ++ix) {
+               get_manager()->add_task({id_, state_id_, ix});
+            }
+            gather_worker_results();
+            // Evaluation errors of the clones end up in the global log. Like those on worker processes in process
+            // mode, they must not be counted as errors of the next evaluation on the master.
+            RooAbsReal::clearEvalErrorLog();
+         } else {
+            for (std::size_t ix = 0; ix < N_tasks_; ++ix) {
+               run_derivator(ix);
+            }
+         }
+      } else {
+         update_workers_state();
+
+         // master fills queue with tasks
+         for (std::size_t ix = 0; ix < N_tasks_; ++ix) {
+            MultiProcess::JobTask job_task{id_, state_id_, ix};
+            get_manager()->add_task(job_task);
+         }
+         N_tasks_at_workers_ = N_tasks_;
+         // wait for task results back from workers to master (put into _grad)
+         gather_worker_results();
       }
-      N_tasks_at_workers_ = N_tasks_;
-      // wait for task results back from workers to master (put into _grad)
-      gather_worker_results();
 
       calculation_is_clean_->gradient = true;
       isCalculating_ = false;
-      update_workers_state_isCalculating();
+      if (!get_manager()->uses_threads()) {
+         update_workers_state_isCalculating();
+      }
    }
 }
 
 void LikelihoodGradientJob::fillGradient(double *grad)
 {
-   if (get_manager()->process_manager().is_master()) {
+   if (get_manager()->is_master()) {
       if (!calculation_is_clean_->gradient) {
          calculate_all();
       }
@@ -242,7 +380,7 @@ void LikelihoodGradientJob::fillGradient(double *grad)
 void LikelihoodGradientJob::fillGradientWithPrevResult(double *grad, double *previous_grad, double *previous_g2,
                                                        double *previous_gstep)
 {
-   if (get_manager()->process_manager().is_master()) {
+   if (get_manager()->is_master()) {
       for (std::size_t i_component = 0; i_component < N_tasks_; ++i_component) {
          grad_[i_component] = {previous_grad[i_component], previous_g2[i_component], previous_gstep[i_component]};
       }
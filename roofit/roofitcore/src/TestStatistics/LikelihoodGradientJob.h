@@ -20,6 +20,7 @@
 #include "Minuit2/NumericalDerivator.h"
 #include "Minuit2/MnMatrix.h"
 
+#include <memory>
 #include <vector>
 
 namespace RooFit {
@@ -30,6 +31,7 @@ public:
    LikelihoodGradientJob(std::shared_ptr<RooAbsL> likelihood,
                          std::shared_ptr<WrapperCalculationCleanFlags> calculation_is_clean, std::size_t N_dim,
                          RooMinimizer *minimizer, SharedOffset offset);
+   ~LikelihoodGradientJob() override;
 
    void fillGradient(double *grad) override;
    void fillGradientWithPrevResult(double *grad, double *previous_grad, double *previous_g2,
@@ -74,6 +76,10 @@ private:
    void update_workers_state_isCalculating();
    void calculate_all();
 
+   struct ThreadClone;
+   bool setupThreadClones();
+   double evaluateThreadClone(const ThreadClone &clone, const double *x) const;
+
    // members
 
    // mutables below are because ROOT::Math::IMultiGradFunction::DoDerivative is const
@@ -87,6 +93,10 @@ private:
    mutable bool isCalculating_ = false;
 
    SharedOffset::OffsetVec offsets_previous_;
+
+   // thread backend only: one clone of the likelihood per worker thread
+   std::vector<std::unique_ptr<ThreadClone>> thread_clones_;
+   bool thread_clones_unsupported_ = false;
 };
 
 } // namespace TestStatistics
@@ -113,11 +113,17 @@ void LikelihoodJob::update_state()
 }
 
 /// \warning In automatic mode, this function can start MultiProcess (forks, starts workers, etc)!
+/// \note With the thread backend, the events are not split, only the components (see MultiProcess::Config).
 std::size_t LikelihoodJob::getNEventTasks()
 {
+   if (get_manager()->uses_threads()) {
+      // Event tasks of the same component would run the same pdf concurrently. In
+      // thread mode, the work is therefore only split over components.
+      return 1;
+   }
    std::size_t val = n_event_tasks_;
    if (val == MultiProcess::Config::LikelihoodJob::automaticNEventTasks) {
-      val = get_manager()->process_manager().N_workers();
+      val = get_manager()->N_workers();
    }
    if (val > likelihood_->getNEvents()) {
       val = likelihood_->getNEvents();
@@ -129,7 +135,7 @@ std::size_t LikelihoodJob::getNComponentTasks()
 {
    std::size_t val = n_component_tasks_;
    if (val == MultiProcess::Config::LikelihoodJob::automaticNComponentTasks) {
-      val = 1;
+      val = get_manager()->uses_threads() ? get_manager()->N_workers() : 1;
    }
    if (val > likelihood_->getNComponents()) {
       val = likelihood_->getNComponents();
@@ -139,7 +145,7 @@ std::size_t LikelihoodJob::getNComponentTasks()
 
 void LikelihoodJob::updateWorkersParameters()
 {
-   if (get_manager()->process_manager().is_master()) {
+   if (get_manager()->is_master()) {
       bool valChanged = false;
       bool constChanged = false;
       std::vector<update_state_t> to_update;
@@ -191,7 +197,7 @@ void LikelihoodJob::updateWorkersOffsetting()
 
 void LikelihoodJob::evaluate()
 {
-   if (get_manager()->process_manager().is_master()) {
+   if (get_manager()->is_master()) {
       // evaluate the serial likelihood to set the offsets
       if (do_offset_ && shared_offset_.offsets().empty()) {
          likelihood_serial_.evaluate();
@@ -199,13 +205,21 @@ void LikelihoodJob::evaluate()
          // the shared_ptr
       }
 
-      // update parameters that changed since last calculation (or creation if first time)
-      updateWorkersParameters();
+      // update parameters that changed since last calculation (or creation if first time); worker threads
+      // share the parameters with the master, so they are always up to date
+      if (!get_manager()->uses_threads()) {
+         updateWorkersParameters();
+      }
 
-      // master fills queue with tasks
       auto N_tasks = getNEventTasks() * getNComponentTasks();
+      if (get_manager()->uses_threads()) {
+         // worker threads write the result of each task directly into results_
+         results_.resize(N_tasks);
+      }
+
+      // master fills queue with tasks
       for (std::size_t ix = 0; ix < N_tasks; ++ix) {
-         get_manager()->queue()->add({id_, state_id_, ix});
+         get_manager()->add_task({id_, state_id_, ix});
       }
       n_tasks_at_workers_ = N_tasks;
 
@@ -269,7 +283,10 @@ bool LikelihoodJob::receive_task_result_on_master(const zmq::message_t &message)
 
 void LikelihoodJob::evaluate_task(std::size_t task)
 {
-   assert(get_manager()->process_manager().is_worker());
+   assert(get_manager()->is_worker());
+
+   // In thread mode, tasks run concurrently on this same object, so each one has its own result slot.
+   auto &result = get_manager()->uses_threads() ? results_[task] : result_;
 
    double section_first = 0;
    double section_last = 1;
@@ -289,17 +306,17 @@ void LikelihoodJob::evaluate_task(std::size_t task)
    switch (likelihood_type_) {
    case LikelihoodType::unbinned:
    case LikelihoodType::binned: {
-      result_ = likelihood_->evaluatePartition({section_first, section_last}, 0, 0);
+      result = likelihood_->evaluatePartition({section_first, section_last}, 0, 0);
       if (do_offset_ && section_last == 1) {
          // we only subtract at the end of event sections, otherwise the offset is subtracted for each event split
-         result_ -= shared_offset_.offsets()[0];
+         result -= shared_offset_.offsets()[0];
       }
       break;
    }
    case LikelihoodType::subsidiary: {
-      result_ = likelihood_->evaluatePartition({0, 1}, 0, 0);
+      result = likelihood_->evaluatePartition({0, 1}, 0, 0);
       if (do_offset_ && offsetting_mode_ == OffsettingMode::full) {
-         result_ -= shared_offset_.offsets()[0];
+         result -= shared_offset_.offsets()[0];
       }
       break;
    }
@@ -316,7 +333,7 @@ void LikelihoodJob::evaluate_task(std::size_t task)
          }
       }
 
-      result_ = ROOT::Math::KahanSum<double>();
+      result = ROOT::Math::KahanSum<double>();
       RooNaNPacker packedNaN;
       for (std::size_t comp_ix = components_first; comp_ix < components_last; ++comp_ix) {
          auto component_result = likelihood_->evaluatePartition({section_first, section_last}, comp_ix, comp_ix + 1);
@@ -324,13 +341,13 @@ void LikelihoodJob::evaluate_task(std::size_t task)
          if (do_offset_ && section_last == 1 &&
              shared_offset_.offsets()[comp_ix] != ROOT::Math::KahanSum<double>(0, 0)) {
             // we only subtract at the end of event sections, otherwise the offset is subtracted for each event split
-            result_ += (component_result - shared_offset_.offsets()[comp_ix]);
+            result += (component_result - shared_offset_.offsets()[comp_ix]);
          } else {
-            result_ += component_result;
+            result += component_result;
          }
       }
       if (packedNaN.getPayload() != 0) {
-         result_ = ROOT::Math::KahanSum<double>(packedNaN.getNaNWithPayload());
+         result = ROOT::Math::KahanSum<double>(packedNaN.getNaNWithPayload());
       }
 
       break;
@@ -342,7 +359,8 @@ void LikelihoodJob::enableOffsetting(bool flag)
 {
    likelihood_serial_.enableOffsetting(flag);
    LikelihoodWrapper::enableOffsetting(flag);
-   if (RooFit::MultiProcess::JobManager::is_instantiated()) {
+   if (RooFit::MultiProcess::JobManager::is_instantiated() &&
+       !RooFit::MultiProcess::JobManager::instance()->uses_threads()) {
       printf("WARNING: when calling MinuitFcnGrad::setOffsetting after the run has already been started the "
              "MinuitFcnGrad::likelihood_in_gradient object (a LikelihoodSerial) on the workers can no longer be "
              "updated! This function (LikelihoodJob::enableOffsetting) can in principle be used outside of "
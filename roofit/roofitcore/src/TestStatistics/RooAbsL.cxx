@@ -240,6 +240,23 @@ std::unique_ptr<RooArgSet> RooAbsL::getParameters()
    return std::unique_ptr<RooArgSet>{pdf_->getParameters(*data_)};
 }
 
+/// Clone of the pdf tree, including its parameters, which are then replaced by those in \p parameters. Used to
+/// implement cloneWithParameters() in the classes that own their pdf.
+std::unique_ptr<RooAbsPdf> RooAbsL::clonePdfWithParameters(const RooArgSet &parameters) const
+{
+   std::unique_ptr<RooAbsPdf> pdf{static_cast<RooAbsPdf *>(pdf_->cloneTree())};
+   pdf->recursiveRedirectServers(parameters);
+   return pdf;
+}
+
+/// The dataset of a clone made by cloneWithParameters() is a copy of that of \p other, including the values of the
+/// constant terms that \p other may have cached for its own pdf. Redo that caching for the pdf of the clone, or clear
+/// it if \p other does not use it.
+void RooAbsL::initConstOptimizationOfClone(const RooAbsL &other)
+{
+   constOptimizeTestStatistic(other.data_->hasFilledCache() ? RooAbsArg::ConfigChange : RooAbsArg::DeActivate, false);
+}
+
 void RooAbsL::constOptimizeTestStatistic(RooAbsArg::ConstOpCode opcode, bool doAlsoTrackingOpt)
 {
    if (data_.get()->hasFilledCache() && opcode == RooAbsArg::Activate) {
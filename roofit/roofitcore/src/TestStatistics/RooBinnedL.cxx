@@ -76,6 +76,26 @@ RooBinnedL::RooBinnedL(RooAbsPdf *pdf, RooAbsData *data)
    }
 }
 
+/// Constructor for cloneWithParameters(), taking ownership of \p pdf, which is already a clone.
+RooBinnedL::RooBinnedL(std::unique_ptr<RooAbsPdf> pdf, const RooBinnedL &other)
+   : RooAbsL(RooAbsL::ClonePdfData{std::move(pdf), other.data_.get()}, other.N_events_, 1,
+             other.extended_ ? RooAbsL::Extended::Yes : RooAbsL::Extended::No),
+     _binw(other._binw)
+{
+   sim_count_ = other.sim_count_;
+
+   RooArgSet params;
+   pdf_->getParameters(data_->get(), params);
+   paramTracker_ = std::make_unique<RooChangeTracker>("chtracker", "change tracker", params, true);
+
+   initConstOptimizationOfClone(other);
+}
+
+std::unique_ptr<RooAbsL> RooBinnedL::cloneWithParameters(const RooArgSet &parameters) const
+{
+   return std::unique_ptr<RooAbsL>{new RooBinnedL(clonePdfWithParameters(parameters), *this)};
+}
+
 RooBinnedL::~RooBinnedL() = default;
 
 //////////////////////////////////////////////////////////////////////////////////
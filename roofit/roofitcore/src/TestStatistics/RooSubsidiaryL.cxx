@@ -69,5 +69,24 @@ ROOT::Math::KahanSum<double> RooSubsidiaryL::evaluatePartition(RooAbsL::Section
 
 void RooSubsidiaryL::constOptimizeTestStatistic(RooAbsArg::ConstOpCode /*opcode*/, bool /*doAlsoTrackingOpt*/) {}
 
+std::unique_ptr<RooAbsL> RooSubsidiaryL::cloneWithParameters(const RooArgSet &parameters) const
+{
+   RooArgSet clones;
+   subsidiary_pdfs_.snapshot(clones);
+   RooArgSet pdfs;
+   for (const auto pdf : subsidiary_pdfs_) {
+      RooAbsArg *pdfClone = clones.find(*pdf);
+      pdfClone->recursiveRedirectServers(parameters);
+      pdfs.add(*pdfClone);
+   }
+   RooArgSet parameterSet;
+   parameters.selectCommon(parameter_set_, parameterSet);
+
+   auto clone = std::make_unique<RooSubsidiaryL>(parent_pdf_name_, pdfs, parameterSet);
+   clone->setSimCount(sim_count_);
+   clone->owned_clones_.addOwned(std::move(clones));
+   return clone;
+}
+
 } // namespace TestStatistics
 } // namespace RooFit
@@ -127,5 +127,22 @@ void RooSumL::constOptimizeTestStatistic(RooAbsArg::ConstOpCode opcode, bool doA
    }
 }
 
+/// \note The pdf and dataset of a RooSumL are not evaluated, so the clone shares them; only the components are cloned.
+std::unique_ptr<RooAbsL> RooSumL::cloneWithParameters(const RooArgSet &parameters) const
+{
+   std::vector<std::unique_ptr<RooAbsL>> components;
+   components.reserve(components_.size());
+   for (auto const &component : components_) {
+      components.push_back(component->cloneWithParameters(parameters));
+      if (!components.back()) {
+         return nullptr;
+      }
+   }
+   auto clone = std::make_unique<RooSumL>(pdf_.get(), data_.get(), std::move(components),
+                                          extended_ ? RooAbsL::Extended::Yes : RooAbsL::Extended::No);
+   clone->setSimCount(sim_count_);
+   return clone;
+}
+
 } // namespace TestStatistics
 } // namespace RooFit
@@ -71,6 +71,31 @@ RooUnbinnedL::RooUnbinnedL(RooAbsPdf *pdf, RooAbsData *data, RooAbsL::Extended e
    }
 }
 
+/// Constructor for cloneWithParameters(), taking ownership of \p pdf, which is already a clone. Unlike the copy
+/// constructor, this does not share the Evaluator with \p other.
+RooUnbinnedL::RooUnbinnedL(std::unique_ptr<RooAbsPdf> pdf, const RooUnbinnedL &other)
+   : RooAbsL(RooAbsL::ClonePdfData{std::move(pdf), other.data_.get()}, other.N_events_, 1,
+             other.extended_ ? RooAbsL::Extended::Yes : RooAbsL::Extended::No),
+     apply_weight_squared(other.apply_weight_squared)
+{
+   sim_count_ = other.sim_count_;
+
+   std::unique_ptr<RooArgSet> params(pdf_->getParameters(*data_));
+   paramTracker_ = std::make_unique<RooChangeTracker>("chtracker", "change tracker", *params, true);
+
+   if (other.evaluator_) {
+      evaluator_ = std::make_unique<RooFit::Evaluator>(*pdf_);
+      auto dataSpans =
+         RooFit::Detail::BatchModeDataHelpers::getDataSpans(*data_, "", nullptr, /*skipZeroWeights=*/true,
+                                                            /*takeGlobalObservablesFromData=*/false, _vectorBuffers);
+      for (auto const &item : dataSpans) {
+         evaluator_->setInput(item.first->GetName(), item.second, false);
+      }
+   }
+
+   initConstOptimizationOfClone(other);
+}
+
 RooUnbinnedL::RooUnbinnedL(const RooUnbinnedL &other)
    : RooAbsL(other),
      apply_weight_squared(other.apply_weight_squared),
@@ -84,6 +109,12 @@ RooUnbinnedL::RooUnbinnedL(const RooUnbinnedL &other)
 
 RooUnbinnedL::~RooUnbinnedL() = default;
 
+/// \note The clone of a likelihood that is evaluated on the GPU is evaluated on the CPU.
+std::unique_ptr<RooAbsL> RooUnbinnedL::cloneWithParameters(const RooArgSet &parameters) const
+{
+   return std::unique_ptr<RooAbsL>{new RooUnbinnedL(clonePdfWithParameters(parameters), *this)};
+}
+
 //////////////////////////////////////////////////////////////////////////////////
 
 /// Returns true if value was changed, false otherwise.
@@ -23,6 +23,8 @@
 #include "RooMinimizer.h"
 #include "RooFitResult.h"
 #include "RooGenericPdf.h"
+#include "RooGaussian.h"
+#include "RooProdPdf.h"
 #include "RooFit/TestStatistics/LikelihoodWrapper.h"
 #include "RooFit/TestStatistics/RooUnbinnedL.h"
 #include "RooFit/TestStatistics/RooRealL.h"
@@ -42,8 +44,14 @@
 
 #include "TH1D.h"
 #include "Math/Minimizer.h"
+#include "Minuit2/NumericalDerivator.h"
 
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <set>
 #include <stdexcept> // runtime_error
+#include <thread>
 
 #include "../gtest_wrapper.h"
 
@@ -503,6 +511,227 @@ INSTANTIATE_TEST_SUITE_P(LikelihoodGradientJob, SimBinnedConstrainedTest, testin
                             return ss.str();
                          });
 
+TEST(LikelihoodGradientJob, ThreadBackend)
+{
+   using namespace RooFit;
+
+   // A simultaneous, constrained likelihood is a RooSumL with several components, including a RooSubsidiaryL. With
+   // worker threads, the partial derivatives are taken concurrently, each thread on its own clone of all components.
+   std::size_t NWorkers = 2;
+
+   std::unique_ptr<RooWorkspace> wPtr = makeSimBinnedConstrainedWorkspace();
+   auto &w = *wPtr;
+
+   RooAbsPdf *pdf = w.pdf("model");
+   RooAbsData *data = w.data("data");
+
+   std::unique_ptr<RooAbsReal> nll{
+      pdf->createNLL(*data, Constrain(*w.var("alpha_bkg_A")), GlobalObservables(*w.var("alpha_bkg_obs_B")))};
+
+   std::unique_ptr<RooArgSet> values(pdf->getParameters(data));
+
+   RooArgSet savedValues;
+   values->snapshot(savedValues);
+
+   // serial gradient at the initial parameter values, in Minuit-internal coordinates like the LikelihoodGradientJob
+   RooMinimizer m0(*nll);
+   m0.setStrategy(0);
+   m0.setPrintLevel(-1);
+
+   ROOT::Minuit2::NumericalDerivator derivator;
+   std::vector<ROOT::Fit::ParameterSettings> const &settings0 = m0.fitter()->Config().ParamsSettings();
+   std::vector<double> x0;
+   for (auto const &setting : settings0) {
+      x0.push_back(derivator.Ext2int(setting, setting.Value()));
+   }
+   std::vector<ROOT::Minuit2::DerivatorElement> grad0(settings0.size());
+   derivator.SetInitialGradient(m0.getMultiGenFcn(), settings0, grad0);
+   grad0 = derivator.Differentiate(m0.getMultiGenFcn(), x0.data(), settings0, grad0);
+
+   m0.minimize("Minuit2", "migrad");
+   std::unique_ptr<RooFitResult> m0result{m0.save()};
+
+   values->assign(savedValues);
+
+   std::unique_ptr<RooAbsReal> likelihoodAbsReal{pdf->createNLL(
+      *data, Constrain(*w.var("alpha_bkg_A")), GlobalObservables(*w.var("alpha_bkg_obs_B")), ModularL(true))};
+
+   ASSERT_FALSE(RooFit::MultiProcess::JobManager::is_instantiated());
+   ASSERT_TRUE(RooFit::MultiProcess::Config::setBackend(RooFit::MultiProcess::Config::Backend::Threads));
+
+   {
+      RooMinimizer::Config cfg1;
+      cfg1.parallelize = NWorkers;
+      cfg1.enableParallelDescent = true;
+      RooMinimizer m1(*likelihoodAbsReal, cfg1);
+      m1.setStrategy(0);
+      m1.setPrintLevel(-1);
+
+      std::vector<ROOT::Fit::ParameterSettings> const &settings1 = m1.fitter()->Config().ParamsSettings();
+      ASSERT_EQ(settings1.size(), settings0.size());
+      std::vector<double> x1;
+      for (auto const &setting : settings1) {
+         x1.push_back(derivator.Ext2int(setting, setting.Value()));
+      }
+      std::vector<double> grad1(settings1.size());
+      dynamic_cast<ROOT::Math::IMultiGradFunction *>(m1.getMultiGenFcn())->Gradient(x1.data(), grad1.data());
+
+      for (std::size_t i1 = 0; i1 < settings1.size(); ++i1) {
+         auto found = std::find_if(settings0.begin(), settings0.end(),
+                                   [&](auto const &setting) { return setting.Name() == settings1[i1].Name(); });
+         ASSERT_NE(found, settings0.end());
+         const double ref = grad0[found - settings0.begin()].derivative;
+         EXPECT_NEAR(grad1[i1], ref, 1e-4 * std::max(1., std::abs(ref))) << settings1[i1].Name();
+      }
+
+      m1.minimize("Minuit2", "migrad");
+      std::unique_ptr<RooFitResult> m1result{m1.save()};
+
+      EXPECT_NEAR(m0result->minNll(), m1result->minNll(), 1e-6);
+      for (const char *name : {"alpha_bkg_A", "alpha_bkg_B", "mu_sig"}) {
+         ValAndError nominal = getValAndError(m0result->floatParsFinal(), name);
+         ValAndError threaded = getValAndError(m1result->floatParsFinal(), name);
+         EXPECT_NEAR(nominal.val, threaded.val, 1e-4) << name;
+         EXPECT_NEAR(nominal.error, threaded.error, 1e-4) << name;
+      }
+   }
+   RooMinimizer::cleanup();
+
+   ASSERT_TRUE(RooFit::MultiProcess::Config::setBackend(RooFit::MultiProcess::Config::Backend::Processes));
+}
+
+namespace {
+
+struct ThreadRecord {
+   std::mutex mutex;
+   std::set<std::thread::id> ids;
+};
+
+ThreadRecord &threadRecord()
+{
+   static ThreadRecord record;
+   return record;
+}
+
+/// Gaussian that records on which threads it is evaluated.
+class ThreadRecordingGaussian : public RooGaussian {
+public:
+   using RooGaussian::RooGaussian;
+   ThreadRecordingGaussian(const ThreadRecordingGaussian &other, const char *name = nullptr) : RooGaussian(other, name)
+   {
+   }
+   TObject *clone(const char *newname) const override { return new ThreadRecordingGaussian(*this, newname); }
+
+protected:
+   double evaluate() const override
+   {
+      {
+         std::lock_guard<std::mutex> lock(threadRecord().mutex);
+         threadRecord().ids.insert(std::this_thread::get_id());
+      }
+      return RooGaussian::evaluate();
+   }
+};
+
+} // namespace
+
+TEST(LikelihoodGradientJob, ThreadBackendPartialDerivatives)
+{
+   using namespace RooFit;
+
+   // With worker threads, the partial derivatives are spread over the threads, also for a likelihood that is not a
+   // RooSumL. They must give the same gradient as the serial likelihood.
+   std::size_t NWorkers = 2;
+   std::size_t N = 4;
+
+   RooRandom::randomGenerator()->SetSeed(7);
+
+   RooArgSet owned;
+   RooArgSet observables;
+   RooArgList gaussians;
+   for (std::size_t ix = 0; ix < N; ++ix) {
+      std::string suffix = std::to_string(ix);
+      auto x = std::make_unique<RooRealVar>(("x" + suffix).c_str(), "x", -10, 10);
+      auto mu = std::make_unique<RooRealVar>(("mu" + suffix).c_str(), "mu", 0.5 * ix, -5, 5);
+      auto sigma = std::make_unique<RooRealVar>(("sigma" + suffix).c_str(), "sigma", 1. + 0.1 * ix, 0.1, 5);
+      auto gauss =
+         std::make_unique<ThreadRecordingGaussian>(("gauss" + suffix).c_str(), "gauss", *x, *mu, *sigma);
+      observables.add(*x);
+      gaussians.add(*gauss);
+      owned.addOwned(std::move(x));
+      owned.addOwned(std::move(mu));
+      owned.addOwned(std::move(sigma));
+      owned.addOwned(std::move(gauss));
+   }
+   RooProdPdf pdf("pdf", "pdf", gaussians);
+   std::unique_ptr<RooDataSet> data{pdf.generate(observables, 5000)};
+
+   // move the parameters away from the values the data was generated with
+   std::unique_ptr<RooArgSet> values{pdf.getParameters(*data)};
+   for (auto *param : static_range_cast<RooRealVar *>(*values)) {
+      param->setVal(param->getVal() + 0.2);
+   }
+   RooArgSet savedValues;
+   values->snapshot(savedValues);
+
+   // serial gradient, in Minuit-internal coordinates like the LikelihoodGradientJob
+   std::unique_ptr<RooAbsReal> nll{pdf.createNLL(*data, EvalBackend::Legacy())};
+   RooMinimizer m0(*nll);
+   m0.setStrategy(0);
+   m0.setPrintLevel(-1);
+
+   ROOT::Minuit2::NumericalDerivator derivator;
+   std::vector<ROOT::Fit::ParameterSettings> const &settings0 = m0.fitter()->Config().ParamsSettings();
+   std::vector<double> x0;
+   for (auto const &setting : settings0) {
+      x0.push_back(derivator.Ext2int(setting, setting.Value()));
+   }
+   std::vector<ROOT::Minuit2::DerivatorElement> grad0(settings0.size());
+   derivator.SetInitialGradient(m0.getMultiGenFcn(), settings0, grad0);
+   grad0 = derivator.Differentiate(m0.getMultiGenFcn(), x0.data(), settings0, grad0);
+
+   values->assign(savedValues);
+
+   ASSERT_FALSE(RooFit::MultiProcess::JobManager::is_instantiated());
+   ASSERT_TRUE(RooFit::MultiProcess::Config::setBackend(RooFit::MultiProcess::Config::Backend::Threads));
+
+   {
+      RooFit::TestStatistics::RooRealL likelihood(
+         "likelihood", "likelihood", std::make_unique<RooFit::TestStatistics::RooUnbinnedL>(&pdf, data.get()));
+      RooMinimizer::Config cfg1;
+      cfg1.parallelize = NWorkers;
+      RooMinimizer m1(likelihood, cfg1);
+      m1.setStrategy(0);
+      m1.setPrintLevel(-1);
+      m1.setOffsetting(true);
+
+      std::vector<ROOT::Fit::ParameterSettings> const &settings1 = m1.fitter()->Config().ParamsSettings();
+      ASSERT_EQ(settings1.size(), settings0.size());
+      std::vector<double> x1;
+      for (auto const &setting : settings1) {
+         x1.push_back(derivator.Ext2int(setting, setting.Value()));
+      }
+
+      threadRecord().ids.clear();
+      std::vector<double> grad1(settings1.size());
+      dynamic_cast<ROOT::Math::IMultiGradFunction *>(m1.getMultiGenFcn())->Gradient(x1.data(), grad1.data());
+      threadRecord().ids.erase(std::this_thread::get_id());
+
+      EXPECT_GT(threadRecord().ids.size(), 1u) << "the partial derivatives were all taken on the same thread";
+
+      for (std::size_t i1 = 0; i1 < settings1.size(); ++i1) {
+         auto found = std::find_if(settings0.begin(), settings0.end(),
+                                   [&](auto const &setting) { return setting.Name() == settings1[i1].Name(); });
+         ASSERT_NE(found, settings0.end());
+         const double ref = grad0[found - settings0.begin()].derivative;
+         EXPECT_NEAR(grad1[i1], ref, 1e-4 * std::max(1., std::abs(ref))) << settings1[i1].Name();
+      }
+   }
+   RooMinimizer::cleanup();
+
+   ASSERT_TRUE(RooFit::MultiProcess::Config::setBackend(RooFit::MultiProcess::Config::Backend::Processes));
+}
+
 TEST_P(LikelihoodGradientJobTest, Gaussian1DAlsoWithLikelihoodJob)
 {
    // do a minimization, but now using GradMinimizer and its MP version
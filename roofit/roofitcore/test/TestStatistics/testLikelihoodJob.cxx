@@ -280,6 +280,37 @@ TEST_F(LikelihoodJobTest, SimBinned)
    EXPECT_DOUBLE_EQ(nll0, nll1.Sum());
 }
 
+TEST_F(LikelihoodJobTest, SimUnbinnedThreadBackend)
+{
+   // components of the simultaneous likelihood are spread over worker threads
+   w.factory("Gaussian::gA(x[-10,10],mu_A[-1,-5,5],s[1,0.5,2])");
+   w.factory("Gaussian::gB(x,mu_B[1,-5,5],s)");
+   w.factory("SIMUL::model(index[A,B],A=gA,B=gB)");
+
+   pdf = w.pdf("model");
+   data = std::unique_ptr<RooDataSet>{pdf->generate({*w.var("x"), *w.cat("index")}, 1000)};
+
+   likelihood = RooFit::TestStatistics::buildLikelihood(pdf, data.get());
+   // dummy offsets (normally they are shared with other objects):
+   SharedOffset offset;
+   auto nll_serial =
+      LikelihoodWrapper::create(RooFit::TestStatistics::LikelihoodMode::serial, likelihood, clean_flags, offset);
+
+   ASSERT_TRUE(RooFit::MultiProcess::Config::setBackend(RooFit::MultiProcess::Config::Backend::Threads));
+   {
+      auto nll_ts = LikelihoodWrapper::create(RooFit::TestStatistics::LikelihoodMode::multiprocess, likelihood,
+                                              clean_flags, offset);
+
+      for (double mu : {-1., 0.5}) {
+         w.var("mu_A")->setVal(mu);
+         nll_serial->evaluate();
+         nll_ts->evaluate();
+         EXPECT_DOUBLE_EQ(nll_serial->getResult().Sum(), nll_ts->getResult().Sum());
+      }
+   }
+   ASSERT_TRUE(RooFit::MultiProcess::Config::setBackend(RooFit::MultiProcess::Config::Backend::Processes));
+}
+
 TEST_F(LikelihoodJobTest, BinnedConstrained)
 {
    // Unbinned pdfs that define template histograms
@@ -12,6 +12,7 @@
 #include <RooFormulaVar.h>
 #include <RooGenericPdf.h>
 #include <RooHelpers.h>
+#include <RooNumGenConfig.h>
 #include <RooProdPdf.h>
 #include <RooProduct.h>
 #include <RooRealVar.h>
@@ -20,10 +21,12 @@
 #include <RooRandom.h>
 
 #include <TClass.h>
+#include <TROOT.h>
 #include <TRandom.h>
 
 #include "gtest_wrapper.h"
 
+#include <cstdlib>
 #include <memory>
 
 class FitTest : public testing::TestWithParam<std::tuple<RooFit::EvalBackend>> {
@@ -397,6 +400,76 @@ TEST(RooAbsPdf, NormSetChange)
    EXPECT_NE(v1, v2);
 }
 
+// Verifies that the batched accept/reject sampler generates the right
+// distribution, and that the generated events are reproducible.
+TEST(RooAbsPdf, BatchedAcceptRejectGeneration)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooWorkspace ws;
+   ws.factory("GenericPdf::pdf('exp(-0.5*x*x) * (1.0 + 0.5 * y)', {x[-5, 5], y[0, 2]})");
+
+   RooAbsPdf &pdf = *ws.pdf("pdf");
+   RooRealVar &x = *ws.var("x");
+   RooRealVar &y = *ws.var("y");
+   pdf.specialGeneratorConfig(true)->method2D(false, false).setLabel("RooBatchedAcceptReject");
+
+   const int nEvents = 20000;
+
+   RooRandom::randomGenerator()->SetSeed(1234);
+   std::unique_ptr<RooDataSet> data1{pdf.generate({x, y}, nEvents)};
+   RooRandom::randomGenerator()->SetSeed(1234);
+   std::unique_ptr<RooDataSet> data2{pdf.generate({x, y}, nEvents)};
+
+   ASSERT_EQ(data1->numEntries(), nEvents);
+   ASSERT_EQ(data2->numEntries(), nEvents);
+   for (int i = 0; i < nEvents; i += 97) {
+      EXPECT_EQ(data1->get(i)->getRealValue("x"), data2->get(i)->getRealValue("x"));
+      EXPECT_EQ(data1->get(i)->getRealValue("y"), data2->get(i)->getRealValue("y"));
+   }
+
+#ifdef R__USE_IMT
+   // The events don't depend on the number of threads. The initial sampling
+   // for the maximum finding alone is spread over several blocks.
+   for (unsigned int nThreads : {2u, 4u}) {
+      ROOT::EnableImplicitMT(nThreads);
+      RooRandom::randomGenerator()->SetSeed(1234);
+      std::unique_ptr<RooDataSet> dataMT{pdf.generate({x, y}, nEvents)};
+      ROOT::DisableImplicitMT();
+
+      ASSERT_EQ(dataMT->numEntries(), nEvents);
+      for (int i = 0; i < nEvents; i += 97) {
+         EXPECT_EQ(dataMT->get(i)->getRealValue("x"), data1->get(i)->getRealValue("x"));
+         EXPECT_EQ(dataMT->get(i)->getRealValue("y"), data1->get(i)->getRealValue("y"));
+      }
+   }
+#endif
+
+   // The x distribution is a standard normal, the y distribution is linear
+   // with mean 10/9 in [0, 2].
+   EXPECT_NEAR(data1->mean(x), 0.0, 0.03);
+   EXPECT_NEAR(data1->sigma(x), 1.0, 0.03);
+   EXPECT_NEAR(data1->mean(y), 10. / 9., 0.03);
+}
+
+// The first generation in a process creates the sampler factory before the
+// generator configuration, which must not deadlock. The death test style
+// "threadsafe" runs the statement in a freshly started process, where no
+// generator configuration was touched before.
+TEST(RooAbsPdf, GenerateInFreshProcess)
+{
+   GTEST_FLAG_SET(death_test_style, "threadsafe");
+   EXPECT_EXIT(
+      {
+         RooRealVar x("x", "x", 0, 10);
+         RooRealVar y("y", "y", 0, 10);
+         RooGenericPdf pdf("pdf", "std::exp(-x) * (1.0 + y)", {x, y});
+         std::unique_ptr<RooDataSet> data{pdf.generate({x, y}, 100)};
+         std::exit(data && data->numEntries() == 100 ? 0 : 1);
+      },
+      testing::ExitedWithCode(0), "");
+}
+
 INSTANTIATE_TEST_SUITE_P(RooAbsPdf, FitTest, testing::Values(ROOFIT_EVAL_BACKENDS),
                          [](testing::TestParamInfo<FitTest::ParamType> const &paramInfo) {
                             std::stringstream ss;
@@ -484,3 +484,57 @@ TEST(RooDataSet,RooStringVarStorage) {
    ASSERT_STREQ(dataClone.get(1)->getStringValue("str"),"str2");
 
 }
+
+// The dataset created from external arrays must read the arrays without
+// copying them, and copy a column only once the dataset is modified.
+TEST(RooDataSet, FromSpans)
+{
+   RooRealVar x("x", "x", -10, 10);
+   RooRealVar w("w", "w", 0, 10);
+
+   auto values = std::make_shared<std::vector<double>>(std::vector<double>{1.0, -2.0, 3.0, 4.5});
+   auto weights = std::make_shared<std::vector<double>>(std::vector<double>{0.5, 1.0, 2.0, 1.5});
+
+   // Only the values are owned by the dataset, the weights have to outlive it
+   auto data = RooDataSet::fromSpans("data", "data", {x, w}, {{"x", *values}, {"w", *weights}}, "w", values);
+
+   ASSERT_EQ(data->numEntries(), 4);
+   EXPECT_TRUE(data->isWeighted());
+   EXPECT_DOUBLE_EQ(data->sumEntries(), 5.0);
+
+   EXPECT_DOUBLE_EQ(data->get(2)->getRealValue("x"), 3.0);
+   EXPECT_DOUBLE_EQ(data->weight(), 2.0);
+
+   // The columns point directly into the external arrays
+   auto arrays = static_cast<RooVectorDataStore const *>(data->store())->getArrays();
+   for (auto const &array : arrays.reals) {
+      EXPECT_EQ(array.data, array.name == "x" ? values->data() : weights->data());
+   }
+   EXPECT_EQ(data->getWeightBatch(0, data->numEntries(), false).data(), weights->data());
+
+   // The owner is kept alive by the dataset and its clones
+   std::weak_ptr<std::vector<double>> valuesObserver = values;
+   values.reset();
+   RooDataSet clone{*data};
+   data.reset();
+   ASSERT_FALSE(valuesObserver.expired());
+   EXPECT_DOUBLE_EQ(clone.get(1)->getRealValue("x"), -2.0);
+
+   // Adding events copies the columns, and the external arrays stay untouched
+   clone.add(*clone.get(0), 3.0);
+   ASSERT_EQ(clone.numEntries(), 5);
+   EXPECT_DOUBLE_EQ(clone.sumEntries(), 8.0);
+   EXPECT_DOUBLE_EQ(clone.get(4)->getRealValue("x"), 1.0);
+   EXPECT_TRUE(valuesObserver.expired());
+   EXPECT_EQ(weights->size(), 4u);
+
+   // Errors can't be stored in external columns, as there is no array for them
+   std::vector<double> xValues{1.0, 2.0};
+   RooRealVar xErr("x", "x", -10, 10);
+   xErr.setAttribute("StoreError");
+   EXPECT_THROW(RooDataSet::fromSpans("dataErr", "dataErr", {xErr}, {{"x", xValues}}), std::invalid_argument);
+   RooRealVar xAsymErr("x", "x", -10, 10);
+   xAsymErr.setAttribute("StoreAsymError");
+   EXPECT_THROW(RooDataSet::fromSpans("dataAsymErr", "dataAsymErr", {xAsymErr}, {{"x", xValues}}),
+                std::invalid_argument);
+}
@@ -35,11 +35,13 @@
 #include <RooWorkspace.h>
 
 #include <ROOT/StringUtils.hxx>
+#include <TInterpreter.h>
 #include <TROOT.h>
 #include <TSystem.h>
 #include <TMath.h>
 
 #include <functional>
+#include <string>
 #include <random>
 
 #include "gtest_wrapper.h"
@@ -65,6 +67,28 @@ double getNumDerivative(const RooAbsReal &pdf, RooRealVar &var, const RooArgSet
    return (plus - minus) / (2 * eps);
 }
 
+/// Remove a directory and everything in it.
+void removeDirectory(std::string const &dir)
+{
+   void *dirp = gSystem->OpenDirectory(dir.c_str());
+   if (!dirp)
+      return;
+   while (const char *entry = gSystem->GetDirEntry(dirp)) {
+      const std::string name{entry};
+      if (name == "." || name == "..")
+         continue;
+      const std::string path = dir + "/" + name;
+      FileStat_t stat;
+      if (gSystem->GetPathInfo(path.c_str(), stat) == 0 && R_ISDIR(stat.fMode)) {
+         removeDirectory(path);
+      } else {
+         gSystem->Unlink(path.c_str());
+      }
+   }
+   gSystem->FreeDirectory(dirp);
+   gSystem->Unlink(dir.c_str());
+}
+
 void randomizeParameters(const RooArgSet &parameters)
 {
    double lowerBound = -0.1;
@@ -124,6 +148,98 @@ TEST(RooFuncWrapper, GaussianNormalized)
    }
 }
 
+TEST(RooFuncWrapper, CodeCache)
+{
+   RooWorkspace ws;
+   ws.factory("Gaussian::gauss(x[0, -10, 10], mu[0, -10, 10], prod::sigma_scaled(sigma[2.0, 0.01, 10], 2.5))");
+
+   RooArgSet normSet{*ws.var("x")};
+   std::unique_ptr<RooAbsReal> gaussNormalized = RooFit::Detail::compileForNormSet(*ws.pdf("gauss"), normSet);
+
+   // The same computation graph results in the same function, which is only compiled once.
+   RooFit::Experimental::RooFuncWrapper gaussFunc1("gauss1", "gauss1", *gaussNormalized, nullptr, nullptr, false);
+   RooFit::Experimental::RooFuncWrapper gaussFunc2("gauss2", "gauss2", *gaussNormalized, nullptr, nullptr, false);
+   EXPECT_EQ(gaussFunc1.funcName(), gaussFunc2.funcName());
+   gaussFunc1.createGradient();
+   gaussFunc2.createGradient();
+
+   std::vector<double> grad1(gaussFunc1.getNumParams());
+   std::vector<double> grad2(gaussFunc2.getNumParams());
+   gaussFunc1.gradient(grad1.data());
+   gaussFunc2.gradient(grad2.data());
+   EXPECT_EQ(grad1, grad2);
+
+   // With a cache directory, the code is compiled into a library there.
+   const std::string cacheDir = std::string{gSystem->TempDirectory()} + "/roofit_codegen_cache_test";
+   removeDirectory(cacheDir);
+   RooFit::Experimental::RooFuncWrapper::setCacheDirectory(cacheDir);
+   ws.var("sigma")->setConstant(true);
+   std::unique_ptr<RooAbsReal> gaussNormalized2 = RooFit::Detail::compileForNormSet(*ws.pdf("gauss"), normSet);
+   RooFit::Experimental::RooFuncWrapper gaussFunc3("gauss3", "gauss3", *gaussNormalized2, nullptr, nullptr, false);
+   RooFit::Experimental::RooFuncWrapper::setCacheDirectory("");
+
+   EXPECT_NE(gaussFunc3.funcName(), gaussFunc1.funcName());
+   EXPECT_FALSE(gSystem->AccessPathName((cacheDir + "/" + gaussFunc3.funcName() + ".cxx").c_str()));
+   EXPECT_NEAR(gaussFunc3.getVal(), ws.pdf("gauss")->getVal(normSet), 1e-8);
+
+   gaussFunc3.createGradient();
+   std::vector<double> grad3(gaussFunc3.getNumParams());
+   gaussFunc3.gradient(grad3.data());
+   RooArgSet params;
+   ws.pdf("gauss")->getParameters(nullptr, params);
+   params.remove(*ws.var("sigma"));
+   for (std::size_t i = 0; i < params.size(); ++i) {
+      EXPECT_NEAR(getNumDerivative(*ws.pdf("gauss"), static_cast<RooRealVar &>(*params[i]), normSet), grad3[i], 1e-6);
+   }
+
+   // The lock is released once the library is compiled.
+   EXPECT_TRUE(gSystem->AccessPathName((cacheDir + "/" + gaussFunc3.funcName() + ".lock").c_str()));
+
+   removeDirectory(cacheDir);
+   EXPECT_TRUE(gSystem->AccessPathName(cacheDir.c_str()));
+}
+
+/// The gradient is compiled into the code cache directory as well, so that a
+/// second process loads it from there and doesn't run Clad. The test runs
+/// itself again in a child process for that.
+TEST(RooFuncWrapper, CodeCacheGradient)
+{
+   const char *childEnv = "ROOFIT_CODECACHE_GRADIENT_CHILD";
+   const bool isChild = gSystem->Getenv(childEnv) != nullptr;
+   const std::string cacheDir = std::string{gSystem->TempDirectory()} + "/roofit_codegen_gradient_cache_test";
+   if (!isChild)
+      removeDirectory(cacheDir);
+
+   // The gradient of a sum doesn't call derivatives of other functions, so it can be cached.
+   RooWorkspace ws;
+   ws.factory("sum::s(a[1, 0, 10], b[2, 0, 10], c[3, 0, 10])");
+
+   RooFit::Experimental::RooFuncWrapper::setCacheDirectory(cacheDir);
+   RooFit::Experimental::RooFuncWrapper func("func", "func", *ws.function("s"), nullptr, nullptr, false);
+   func.createGradient();
+   RooFit::Experimental::RooFuncWrapper::setCacheDirectory("");
+
+   std::vector<double> grad(func.getNumParams());
+   func.gradient(grad.data());
+   EXPECT_EQ(grad, std::vector<double>(3, 1.0));
+   EXPECT_DOUBLE_EQ(func.getVal(), 6.0);
+
+   // Clad is requested to generate the gradient with the function "<funcName>_req".
+   const std::string requestName = func.funcName() + "_req";
+   if (isChild) {
+      EXPECT_EQ(gInterpreter->GetFunction(nullptr, requestName.c_str()), nullptr);
+      return;
+   }
+   EXPECT_NE(gInterpreter->GetFunction(nullptr, requestName.c_str()), nullptr);
+   EXPECT_FALSE(gSystem->AccessPathName((cacheDir + "/" + func.funcName() + "_grad.cxx").c_str()));
+
+   const std::string command = std::string{childEnv} + "=1 " + ::testing::internal::GetArgvs()[0] +
+                               " --gtest_filter=RooFuncWrapper.CodeCacheGradient";
+   EXPECT_EQ(gSystem->Exec(command.c_str()), 0);
+
+   removeDirectory(cacheDir);
+}
+
 TEST(RooFuncWrapper, Exponential)
 {
 
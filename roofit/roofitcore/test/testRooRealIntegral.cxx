@@ -8,19 +8,24 @@
 #include <RooGenericPdf.h>
 #include <RooHelpers.h>
 #include <RooHistPdf.h>
+#include <RooNumIntConfig.h>
 #include <RooPlot.h>
 #include <RooProduct.h>
 #include <RooProjectedPdf.h>
+#include <RooRealBinding.h>
 #include <RooRealIntegral.h>
 #include <RooRealVar.h>
 #include <RooWorkspace.h>
 
 #include <ROOT/StringUtils.hxx>
+#include <TMath.h>
 
+#include "../src/RooBatchedIntegrator.h"
 #include "../src/RooGenProdProj.h"
 
 #include "gtest_wrapper.h"
 
+#include <cmath>
 #include <memory>
 
 namespace {
@@ -410,3 +415,92 @@ TEST(RooRealIntegral, GaussianWithSigmaDependingOnX)
 
    EXPECT_EQ(val1, val2);
 }
+
+// Verify that the RooBatchedIntegrator computes the right integrals, also
+// when the parameters are changed and set back to values for which the
+// integral is taken from its cache.
+TEST(RooRealIntegral, BatchedIntegrator)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooWorkspace ws;
+   ws.factory("GenericPdf::pdf('exp(-0.5 * (x - mu) * (x - mu) / (sigma * sigma)) * (1.0 + a * y)', "
+              "{x[-10, 10], y[0, 2], mu[0.5, -1, 1], sigma[1.5, 0.5, 3], a[0.5, 0, 1]})");
+
+   RooAbsPdf &pdf = *ws.pdf("pdf");
+   RooRealVar &x = *ws.var("x");
+   RooRealVar &y = *ws.var("y");
+   RooRealVar &mu = *ws.var("mu");
+   RooRealVar &sigma = *ws.var("sigma");
+   RooRealVar &a = *ws.var("a");
+   pdf.specialIntegratorConfig(true)->method1D().setLabel("RooBatchedIntegrator");
+   pdf.specialIntegratorConfig(true)->method2D().setLabel("RooBatchedIntegrator");
+
+   auto gaussIntegral = [&]() {
+      const double s = std::sqrt(2.) * sigma.getVal();
+      return std::sqrt(2. * TMath::Pi()) * sigma.getVal() * 0.5 *
+             (std::erf((x.getMax() - mu.getVal()) / s) - std::erf((x.getMin() - mu.getVal()) / s));
+   };
+
+   std::unique_ptr<RooAbsReal> integral2D{pdf.createIntegral({x, y})};
+   std::unique_ptr<RooAbsReal> integral1D{pdf.createIntegral(x)};
+   y.setVal(1.5);
+
+   auto check = [&]() {
+      EXPECT_NEAR(integral2D->getVal(), gaussIntegral() * (2. + 2. * a.getVal()), 1e-6);
+      EXPECT_NEAR(integral1D->getVal(), gaussIntegral() * (1. + a.getVal() * y.getVal()), 1e-6);
+   };
+
+   check();
+   const double val2D = integral2D->getVal();
+   const double val1D = integral1D->getVal();
+
+   mu.setVal(-0.3);
+   sigma.setVal(0.7);
+   check();
+   a.setVal(0.9);
+   y.setVal(0.2);
+   check();
+
+   // Back to the initial parameters, where the integrals come from the cache
+   mu.setVal(0.5);
+   sigma.setVal(1.5);
+   a.setVal(0.5);
+   y.setVal(1.5);
+   EXPECT_EQ(integral2D->getVal(), val2D);
+   EXPECT_EQ(integral1D->getVal(), val1D);
+
+   // The integration variables are not changed by the integration
+   EXPECT_EQ(x.getVal(), 0.);
+   EXPECT_EQ(y.getVal(), 1.5);
+
+   RooNumIntConfig const &config = *pdf.specialIntegratorConfig();
+
+   // The integrand is evaluated in batches by the Evaluator: the function
+   // binding is only called to validate the first batch.
+   RooRealBinding binding2D{pdf, {x, y}};
+   RooBatchedIntegrator integrator2D{binding2D, config};
+   EXPECT_NEAR(integrator2D.integral(), val2D, 1e-6);
+   EXPECT_GT(binding2D.numCall(), 0);
+   EXPECT_LE(binding2D.numCall(), 16);
+   binding2D.resetNumCall();
+   mu.setVal(-0.3);
+   EXPECT_NEAR(integrator2D.integral(), gaussIntegral() * (2. + 2. * a.getVal()), 1e-6);
+   EXPECT_EQ(binding2D.numCall(), 0);
+   mu.setVal(0.5);
+
+   // Normalized over y, which is not integrated over, the integrand is
+   // evaluated point by point. Known parameters are found in the cache,
+   // without calling the integrand.
+   RooArgSet normSet{x, y};
+   RooRealBinding binding1D{pdf, {x}, &normSet};
+   RooBatchedIntegrator integrator1D{binding1D, config};
+   const double norm1D = integrator1D.integral();
+   EXPECT_GT(binding1D.numCall(), 16);
+   mu.setVal(-0.3);
+   EXPECT_NE(integrator1D.integral(), norm1D);
+   binding1D.resetNumCall();
+   mu.setVal(0.5);
+   EXPECT_EQ(integrator1D.integral(), norm1D);
+   EXPECT_EQ(binding1D.numCall(), 0);
+}
@@ -26,10 +26,13 @@
 
 #include <ROOT/TestSupport.hxx>
 
+#include <TROOT.h>
+
 #include "gtest_wrapper.h"
 
 #include <cmath>
 #include <memory>
+#include <vector>
 
 namespace {
 
@@ -755,3 +758,59 @@ TEST(NLL, SetData)
    // 0.5, so this is what we analytically expect.
    EXPECT_DOUBLE_EQ(valSimB, valSimA + 0.5);
 }
+
+#ifdef R__USE_IMT
+// Check that the multi-threaded evaluation of the NLL gives the same result as
+// the single-threaded one, and the same result for different pool sizes.
+TEST(NLL, MultiThreadedEvaluation)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooWorkspace ws;
+   ws.factory("SUM::model(f[0.3, 0, 1] * Gaussian::sig(x[-10, 10], mu[0, -5, 5], sigma[1, 0.1, 5]),"
+              " Exponential::bkg(x, c[-0.2, -2, 0]))");
+
+   RooAbsPdf &model = *ws.pdf("model");
+   RooRealVar &x = *ws.var("x");
+   RooRealVar &mu = *ws.var("mu");
+
+   // Enough events for the computation to be split into several chunks
+   RooRandom::randomGenerator()->SetSeed(1337);
+   std::unique_ptr<RooDataSet> data{model.generate(x, 100000)};
+
+   using namespace RooFit;
+
+   const std::vector<double> muVals{0.0, 0.5};
+
+   auto evaluate = [&](RooAbsReal &nll) {
+      std::vector<double> vals;
+      for (double muVal : muVals) {
+         mu.setVal(muVal);
+         vals.push_back(nll.getVal());
+      }
+      return vals;
+   };
+
+   ROOT::DisableImplicitMT();
+   std::unique_ptr<RooAbsReal> nllRef{model.createNLL(*data, EvalBackend::Cpu())};
+   const std::vector<double> valsRef = evaluate(*nllRef);
+
+   // The chunks don't depend on the pool size, so the results are the same for any number of threads
+   std::vector<std::vector<double>> valsThreads;
+   for (unsigned int nThreads : {2u, 4u}) {
+      ROOT::EnableImplicitMT(nThreads);
+      ASSERT_EQ(ROOT::GetThreadPoolSize(), nThreads);
+      std::unique_ptr<RooAbsReal> nll{model.createNLL(*data, EvalBackend::Cpu())};
+      valsThreads.push_back(evaluate(*nll));
+      // Evaluating again on the same pool gives the same result
+      EXPECT_EQ(evaluate(*nll), valsThreads.back());
+      nll.reset();
+      ROOT::DisableImplicitMT();
+   }
+
+   for (std::size_t i = 0; i < muVals.size(); ++i) {
+      EXPECT_NEAR(valsThreads[0][i], valsRef[i], 1e-10 * std::abs(valsRef[i]));
+      EXPECT_EQ(valsThreads[0][i], valsThreads[1][i]);
+   }
+}
+#endif
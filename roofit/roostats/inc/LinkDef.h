@@ -65,6 +65,7 @@
 #pragma link C++ class RooStats::ToyMCSampler+;
 #pragma link C++ class RooStats::ToyMCStudy+;
 #pragma link C++ class RooStats::ProofConfig+;
+#pragma link C++ class RooStats::ParallelScheduler+;
 #pragma link C++ class RooStats::ToyMCImportanceSampler+;
 #pragma link C++ class RooStats::ToyMCPayload+;
 
@@ -30,6 +30,7 @@ namespace RooStats {
    class FrequentistCalculator;
    class AsymptoticCalculator;
    class HypoTestCalculatorGeneric;
+   class ParallelScheduler;
    class TestStatistic;
 
 
@@ -149,6 +150,12 @@ public:
    /// set flag to close proof for every new run
    static void SetCloseProof(bool flag);
 
+   /// run the points of a fixed scan on the worker processes of the scheduler, nullptr deactivates it
+   void SetParallelScheduler(ParallelScheduler *scheduler = nullptr) { fScheduler = scheduler; }
+
+   /// return the number of toys generated for the scanned points since the last reset
+   int GetTotalToysRun() const { return fTotalToysRun; }
+
 
 protected:
 
@@ -163,6 +170,9 @@ protected:
    /// run the hybrid at a single point
    HypoTestResult * Eval( HypoTestCalculatorGeneric &hc, bool adaptive , double clsTarget) const;
 
+   std::unique_ptr<HypoTestResult> EvalPoint(double &rVal, bool adaptive, double clTarget) const;
+   void AddPointResult(double rVal, std::unique_ptr<HypoTestResult> result) const;
+
    /// helper functions
    static RooRealVar * GetVariableToScan(const HypoTestCalculatorGeneric &hc);
    static void CheckInputModels(const HypoTestCalculatorGeneric &hc, const RooRealVar & scanVar);
@@ -199,6 +209,7 @@ private:
    double fXmin;
    double fXmax;
    double fNumErr;
+   ParallelScheduler *fScheduler = nullptr; ///<! scheduler for the points of a fixed scan
 
 protected:
 
@@ -0,0 +1,78 @@
+// @(#)root/roostats:$Id$
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOSTATS_ParallelScheduler
+#define ROOSTATS_ParallelScheduler
+
+#include "Rtypes.h"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+class TObject;
+
+namespace RooStats {
+
+class ParallelScheduler {
+
+public:
+   /// Task that computes the result with a given index. The returned object
+   /// is owned by the caller, and a nullptr signals a failed task.
+   using Task = std::function<TObject *(std::size_t)>;
+
+   ParallelScheduler(unsigned int nWorkers = 0, const char *checkpointDir = "");
+   virtual ~ParallelScheduler() = default;
+
+   /// set the number of worker processes (0 means one per core)
+   void SetNWorkers(unsigned int nWorkers) { fNWorkers = nWorkers; }
+   /// return the number of worker processes
+   unsigned int GetNWorkers() const;
+
+   /// set the directory where successful tasks are stored, empty string to disable checkpointing
+   void SetCheckpointDir(const char *dir) { fCheckpointDir = dir ? dir : ""; }
+   /// return the checkpoint directory
+   const std::string &GetCheckpointDir() const { return fCheckpointDir; }
+
+   std::vector<std::unique_ptr<TObject>> Run(std::size_t nTasks, const Task &task);
+
+   /// Typed version of Run() for tasks returning objects of class T.
+   template <class T, class F>
+   std::vector<std::unique_ptr<T>> Map(std::size_t nTasks, F &&task)
+   {
+      std::vector<std::unique_ptr<TObject>> objects = Run(nTasks, [&](std::size_t i) -> TObject * { return task(i); });
+      std::vector<std::unique_ptr<T>> out;
+      out.reserve(objects.size());
+      for (auto &obj : objects) {
+         out.emplace_back(static_cast<T *>(obj.release()));
+      }
+      return out;
+   }
+
+   /// return true when called from inside a task, where nested schedulers run their tasks sequentially
+   static bool IsInsideTask() { return fgInsideTask; }
+
+private:
+   std::string CheckpointFile(const std::string &run, std::size_t iTask) const;
+   bool ReadCheckpoint(const std::string &run, std::size_t iTask, std::unique_ptr<TObject> &result) const;
+   void WriteCheckpoint(const std::string &run, std::size_t iTask, TObject const *result) const;
+
+   unsigned int fNWorkers = 0; ///< number of worker processes
+   std::string fCheckpointDir; ///< directory with the results of finished tasks
+   unsigned int fNRuns = 0;    ///< number of calls to Run(), used to label the checkpoints
+
+   static bool fgInsideTask;
+
+   ClassDef(ParallelScheduler, 0) // Schedules independent fits on a pool of worker processes
+};
+} // namespace RooStats
+
+#endif
@@ -18,6 +18,7 @@
 #include "RooStats/TestStatistic.h"
 #include "RooStats/ModelConfig.h"
 #include "RooStats/ProofConfig.h"
+#include "RooStats/ParallelScheduler.h"
 
 #include "RooWorkspace.h"
 #include "RooMsgService.h"
@@ -80,6 +81,7 @@ class ToyMCSampler: public TestStatSampler {
       SamplingDistribution* GetSamplingDistribution(RooArgSet& paramPoint) override;
       virtual RooDataSet* GetSamplingDistributions(RooArgSet& paramPoint);
       virtual RooDataSet* GetSamplingDistributionsSingleWorker(RooArgSet& paramPoint);
+      RooDataSet* GetSamplingDistributionsParallel(RooArgSet& paramPoint);
 
       virtual SamplingDistribution* AppendSamplingDistribution(
          RooArgSet& allParameters,
@@ -229,6 +231,11 @@ class ToyMCSampler: public TestStatSampler {
       /// calling with argument or nullptr deactivates proof
       void SetProofConfig(ProofConfig *pc = nullptr) { fProofConfig = pc; }
 
+      /// distribute the toys on the worker processes of the scheduler, nullptr deactivates it
+      void SetParallelScheduler(ParallelScheduler *scheduler = nullptr) { fParallelScheduler = scheduler; }
+      /// set the number of toys generated by one task of the ParallelScheduler
+      void SetNToysPerTask(Int_t ntoys) { fNToysPerTask = ntoys; }
+
       void SetProtoData(const RooDataSet* d) { fProtoData = d; }
 
    protected:
@@ -275,6 +282,8 @@ class ToyMCSampler: public TestStatSampler {
       const RooDataSet *fProtoData = nullptr; ///< in dev
 
       ProofConfig *fProofConfig = nullptr; ///<!
+      ParallelScheduler *fParallelScheduler = nullptr; ///<!
+      Int_t fNToysPerTask = 20; ///< number of toys per task when running with a ParallelScheduler
 
       mutable NuisanceParametersSampler *fNuisanceParametersSampler = nullptr; ///<!
 
@@ -292,7 +301,7 @@ class ToyMCSampler: public TestStatSampler {
       bool fUseMultiGen = false;         ///< Use PrepareMultiGen?
 
    protected:
-   ClassDefOverride(ToyMCSampler, 4) // A simple implementation of the TestStatSampler interface
+   ClassDefOverride(ToyMCSampler, 5) // A simple implementation of the TestStatSampler interface
 };
 }
 
@@ -63,7 +63,9 @@ call HypoTestInverter::UseCLs().
 #include "TGraphErrors.h"
 
 #include "RooStats/ProofConfig.h"
+#include "RooStats/ParallelScheduler.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <memory>
@@ -408,6 +410,7 @@ HypoTestInverter & HypoTestInverter::operator= (const HypoTestInverter & rhs) {
    fXmin = rhs.fXmin;
    fXmax = rhs.fXmax;
    fNumErr = rhs.fNumErr;
+   fScheduler = rhs.fScheduler;
 
    return *this;
 }
@@ -648,16 +651,38 @@ bool HypoTestInverter::RunFixedScan( int nBins, double xMin, double xMax, bool s
      return false;
    }
 
-   double thisX = xMin;
-   for (int i=0; i<nBins; i++) {
-
-      if (i > 0) { // avoids case of nBins = 1
+   std::vector<double> xValues(nBins, xMin);
+   for (int i=1; i<nBins; i++) { // avoids case of nBins = 1
       if (scanLog) {
-            thisX = exp(  log(xMin) +  i*(log(xMax)-log(xMin))/(nBins-1)  );  // scan in log x
+         xValues[i] = exp(  log(xMin) +  i*(log(xMax)-log(xMin))/(nBins-1)  );  // scan in log x
       } else {
-            thisX = xMin + i * (xMax - xMin) / (nBins - 1); // linear scan in x
+         xValues[i] = xMin + i * (xMax - xMin) / (nBins - 1); // linear scan in x
       }
+   }
+
+   // the points are independent, so they can be distributed on worker processes
+   if (fScheduler && !ParallelScheduler::IsInsideTask()) {
+      auto results = fScheduler->Map<HypoTestResult>(xValues.size(), [&](std::size_t i) {
+         double thisX = xValues[i];
+         return EvalPoint(thisX, false, -1).release();
+      });
+      for (std::size_t i = 0; i < xValues.size(); ++i) {
+         if (!results[i]) {
+            oocoutW(nullptr,Eval) << "HypoTestInverter::RunFixedScan - The hypo test for point " << xValues[i] << " failed. Skipping." << std::endl;
+            continue;
+         }
+         // the toys were counted in the worker process
+         if ((fCalcType == kFrequentist || fCalcType == kHybrid) && results[i]->GetNullDistribution() && results[i]->GetAltDistribution()) {
+            fTotalToysRun += results[i]->GetAltDistribution()->GetSize() + results[i]->GetNullDistribution()->GetSize();
+         }
+         // EvalPoint moved the point into the range of the scanned variable in the worker process
+         const double thisX = std::clamp(xValues[i], fScannedVariable->getMin(), fScannedVariable->getMax());
+         AddPointResult(thisX, std::move(results[i]));
       }
+      return true;
+   }
+
+   for (double thisX : xValues) {
 
       const bool status = RunOnePoint(thisX);
 
@@ -678,6 +703,21 @@ bool HypoTestInverter::RunOnePoint( double rVal, bool adaptive, double clTarget)
 
    CreateResults();
 
+   std::unique_ptr<HypoTestResult> result = EvalPoint(rVal, adaptive, clTarget);
+   if (!result) return false;
+
+   AddPointResult(rVal, std::move(result));
+
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Run the hypothesis test at the given POI value, which is moved into the range
+/// of the scanned variable if needed. Returns a nullptr if the test failed.
+/// (internal function called by RunOnePoint and RunFixedScan)
+
+std::unique_ptr<HypoTestResult> HypoTestInverter::EvalPoint(double &rVal, bool adaptive, double clTarget) const
+{
    // check if rVal is in the range specified for fScannedVariable
    if ( rVal < fScannedVariable->getMin() ) {
       oocoutE(nullptr,InputArguments) << "HypoTestInverter::RunOnePoint - Out of range: using the lower bound "
@@ -716,7 +756,8 @@ bool HypoTestInverter::RunOnePoint( double rVal, bool adaptive, double clTarget)
    if (!result) {
       oocoutE(nullptr,Eval) << "HypoTestInverter - Error running point " << fScannedVariable->GetName() << " = " <<
    fScannedVariable->getVal() << endl;
-      return false;
+      fScannedVariable->setVal(oldValue);
+      return nullptr;
    }
    // in case of a dummy result
    const double nullPV = result->NullPValue();
@@ -724,9 +765,24 @@ bool HypoTestInverter::RunOnePoint( double rVal, bool adaptive, double clTarget)
    if (!std::isfinite(nullPV) || nullPV < 0. || nullPV > 1. || !std::isfinite(altPV) || altPV < 0. || altPV > 1.) {
       oocoutW(nullptr,Eval) << "HypoTestInverter - Skipping invalid result for  point " << fScannedVariable->GetName() << " = " <<
          fScannedVariable->getVal() << ". null p-value=" << nullPV << ", alternate p-value=" << altPV << endl;
-      return false;
+      fScannedVariable->setVal(oldValue);
+      return nullptr;
    }
 
+   fScannedVariable->setVal(oldValue);
+
+   return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the result of the hypothesis test at the given POI value to the
+/// HypoTestInverterResult, merging it with the previous result if that was
+/// for the same value.
+
+void HypoTestInverter::AddPointResult(double rVal, std::unique_ptr<HypoTestResult> result) const
+{
+   CreateResults();
+
    double lastXtested;
    if ( fResults->ArraySize()!=0 ) lastXtested = fResults->GetXValue(fResults->ArraySize()-1);
    else lastXtested = -999;
@@ -756,10 +812,6 @@ bool HypoTestInverter::RunOnePoint( double rVal, bool adaptive, double clTarget)
      fResults->fYObjects.Add(result.release());
 
    }
-
-   fScannedVariable->setVal(oldValue);
-
-   return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
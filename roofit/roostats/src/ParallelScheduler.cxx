@@ -0,0 +1,239 @@
+// @(#)root/roostats:$Id$
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/** \class RooStats::ParallelScheduler
+    \ingroup Roostats
+
+Runs independent tasks, like the points of a hypothesis test inversion scan
+or batches of toys, on a pool of worker processes on the local machine.
+
+Each worker is a forked copy of the calling process, so it works on its own
+copy of the workspace, models and data, and no RooFit object is shared
+between concurrent fits. The results are sent back to the calling process and
+returned ordered by task index.
+
+Every task reseeds RooRandom::randomGenerator() with a seed that only depends
+on the global seed and the task index. Hence, the results are reproducible
+and don't depend on the number of workers. Calls from inside a task, for
+example the toys of a scan point, run sequentially in that task.
+
+If a checkpoint directory is set, every successful task is written to a ROOT
+file in that directory. When the same sequence of calls is repeated with the
+same global seed, e.g. after a crash or when a batch job was killed, the tasks
+that are found in the directory are restored instead of being computed again.
+The checkpoints are labelled with the seed and the number of tasks of the
+call, so the ones of a different configuration are ignored, and failed tasks
+are computed again.
+
+~~~ {.cpp}
+   RooStats::ParallelScheduler scheduler(8, "limitScanCheckpoints");
+   RooStats::HypoTestInverter inverter(calc);
+   inverter.SetParallelScheduler(&scheduler);
+   inverter.SetFixedScan(40, 0., 20.);
+   auto result = inverter.GetInterval();
+~~~
+
+The process pool is not available on Windows, where the tasks run sequentially.
+*/
+
+#include "RooStats/ParallelScheduler.h"
+
+#include "RooMsgService.h"
+#include "RooRandom.h"
+
+#include "TFile.h"
+#include "TList.h"
+#include "TMath.h"
+#include "TParameter.h"
+#include "TRandom.h"
+#include "TSystem.h"
+
+#ifndef _MSC_VER
+#include "ROOT/TProcessExecutor.hxx"
+#endif
+
+#include <algorithm>
+#include <thread>
+
+ClassImp(RooStats::ParallelScheduler);
+
+namespace RooStats {
+
+bool ParallelScheduler::fgInsideTask = false;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create a scheduler with `nWorkers` worker processes (0 means one per core).
+/// If `checkpointDir` is not empty, finished tasks are stored in this directory.
+
+ParallelScheduler::ParallelScheduler(unsigned int nWorkers, const char *checkpointDir)
+   : fNWorkers(nWorkers), fCheckpointDir(checkpointDir ? checkpointDir : "")
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+unsigned int ParallelScheduler::GetNWorkers() const
+{
+   if (fNWorkers > 0)
+      return fNWorkers;
+   return std::max(1u, std::thread::hardware_concurrency());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Run the tasks with the indices 0 to `nTasks - 1` and return their results,
+/// ordered by task index. The result of a failed task is a nullptr.
+
+std::vector<std::unique_ptr<TObject>> ParallelScheduler::Run(std::size_t nTasks, const Task &task)
+{
+   std::vector<std::unique_ptr<TObject>> results(nTasks);
+
+   if (fgInsideTask) {
+      for (std::size_t iTask = 0; iTask < nTasks; ++iTask) {
+         results[iTask].reset(task(iTask));
+      }
+      return results;
+   }
+
+   const unsigned int iRun = fNRuns++;
+   const bool checkpointing = !fCheckpointDir.empty();
+
+   // The calling process draws the same two numbers, no matter how many tasks
+   // are run where, so its random sequence continues identically afterwards.
+   TRandom *rng = RooRandom::randomGenerator();
+   const ULong_t baseSeed = rng->Integer(TMath::Limits<UInt_t>::Max());
+   const ULong_t continueSeed = rng->Integer(TMath::Limits<UInt_t>::Max());
+
+   // Nested calls run sequentially, also if the task throws.
+   struct InsideTaskGuard {
+      InsideTaskGuard() { fgInsideTask = true; }
+      ~InsideTaskGuard() { fgInsideTask = false; }
+   };
+
+   const std::string run = "run" + std::to_string(iRun) + "_seed" + std::to_string(baseSeed) + "_n" +
+                           std::to_string(nTasks);
+
+   auto runTask = [&](std::size_t iTask) -> TObject * {
+      InsideTaskGuard guard;
+      // seed zero would mean a time-dependent seed
+      rng->SetSeed(baseSeed + iTask + 1);
+      TObject *result = task(iTask);
+      if (checkpointing && result)
+         WriteCheckpoint(run, iTask, result);
+      return result;
+   };
+
+   std::vector<std::size_t> todo;
+   if (checkpointing)
+      gSystem->mkdir(fCheckpointDir.c_str(), true);
+   for (std::size_t iTask = 0; iTask < nTasks; ++iTask) {
+      if (!checkpointing || !ReadCheckpoint(run, iTask, results[iTask]))
+         todo.push_back(iTask);
+   }
+   if (todo.size() < nTasks) {
+      oocoutI(nullptr, Eval) << "ParallelScheduler - restored " << nTasks - todo.size() << " of " << nTasks
+                             << " tasks from " << fCheckpointDir << std::endl;
+   }
+
+   const unsigned int nWorkers = std::min<std::size_t>(GetNWorkers(), todo.size());
+
+#ifndef _MSC_VER
+   if (nWorkers > 1) {
+      oocoutI(nullptr, Eval) << "ParallelScheduler - running " << todo.size() << " tasks on " << nWorkers
+                             << " worker processes" << std::endl;
+
+      // The results are received in the order in which the tasks finish, so
+      // they are sent together with the task index.
+      auto workerTask = [&](std::size_t iTask) -> TList * {
+         auto out = new TList;
+         out->Add(new TParameter<Long64_t>("index", iTask));
+         if (TObject *result = runTask(iTask))
+            out->Add(result);
+         return out;
+      };
+
+      const std::size_t nTodo = todo.size();
+      ROOT::TProcessExecutor executor(nWorkers);
+      std::size_t nReceived = 0;
+      for (TList *out : executor.Map(workerTask, todo)) {
+         if (!out)
+            continue;
+         out->SetOwner(true);
+         auto *index = dynamic_cast<TParameter<Long64_t> *>(out->First());
+         if (index && out->GetSize() > 1) {
+            TObject *result = out->At(1);
+            out->Remove(result);
+            results[index->GetVal()].reset(result);
+         }
+         ++nReceived;
+         delete out;
+      }
+      if (nReceived != nTodo) {
+         oocoutE(nullptr, Eval) << "ParallelScheduler - only " << nReceived << " of " << nTodo
+                                << " tasks returned from the worker processes" << std::endl;
+      }
+   } else
+#endif
+   {
+      for (std::size_t iTask : todo) {
+         results[iTask].reset(runTask(iTask));
+      }
+   }
+
+   rng->SetSeed(continueSeed + 1);
+
+   return results;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+std::string ParallelScheduler::CheckpointFile(const std::string &run, std::size_t iTask) const
+{
+   return fCheckpointDir + "/" + run + "_task" + std::to_string(iTask) + ".root";
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the result of a successful task from the checkpoint directory. Returns
+/// false if the task didn't finish yet or failed.
+
+bool ParallelScheduler::ReadCheckpoint(const std::string &run, std::size_t iTask,
+                                       std::unique_ptr<TObject> &result) const
+{
+   const std::string fileName = CheckpointFile(run, iTask);
+   if (gSystem->AccessPathName(fileName.c_str()))
+      return false;
+
+   std::unique_ptr<TFile> file{TFile::Open(fileName.c_str(), "READ")};
+   if (!file || file->IsZombie())
+      return false;
+
+   result.reset(file->Get<TObject>("result"));
+   return result != nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write the result of a successful task to the checkpoint directory. The
+/// file is renamed only when it is complete, so a killed job never leaves a
+/// truncated checkpoint behind.
+
+void ParallelScheduler::WriteCheckpoint(const std::string &run, std::size_t iTask, TObject const *result) const
+{
+   const std::string fileName = CheckpointFile(run, iTask);
+   const std::string tmpName = fileName + ".tmp" + std::to_string(gSystem->GetPid());
+   {
+      std::unique_ptr<TFile> file{TFile::Open(tmpName.c_str(), "RECREATE")};
+      if (!file || file->IsZombie()) {
+         oocoutW(nullptr, Eval) << "ParallelScheduler - cannot write checkpoint " << fileName << std::endl;
+         return;
+      }
+      file->WriteTObject(result, "result");
+   }
+   gSystem->Rename(tmpName.c_str(), fileName.c_str());
+}
+
+} // namespace RooStats
@@ -266,6 +266,10 @@ SamplingDistribution* ToyMCSampler::GetSamplingDistribution(RooArgSet& paramPoin
 RooDataSet* ToyMCSampler::GetSamplingDistributions(RooArgSet& paramPointIn)
 {
 
+   // ======= L O C A L   W O R K E R S ? =======
+   if(fParallelScheduler && !ParallelScheduler::IsInsideTask())
+      return GetSamplingDistributionsParallel(paramPointIn);
+
    // ======= S I N G L E   R U N ? =======
    if(!fProofConfig)
       return GetSamplingDistributionsSingleWorker(paramPointIn);
@@ -309,6 +313,58 @@ RooDataSet* ToyMCSampler::GetSamplingDistributions(RooArgSet& paramPointIn)
    return output;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Generate the toys in tasks of fNToysPerTask toys on the worker processes
+/// of the ParallelScheduler, and merge the results in the order of the tasks.
+/// Called from GetSamplingDistributions when a ParallelScheduler is set.
+
+RooDataSet* ToyMCSampler::GetSamplingDistributionsParallel(RooArgSet& paramPointIn)
+{
+   if (!CheckConfig()){
+      oocoutE(nullptr, InputArguments)
+         << "Bad COnfiguration in ToyMCSampler "
+         << endl;
+      return nullptr;
+   }
+
+   if(fToysInTails) {
+      fToysInTails = 0;
+      oocoutW(nullptr, InputArguments)
+         << "Adaptive sampling in ToyMCSampler is not supported for parallel runs."
+         << endl;
+   }
+
+   const Int_t totToys = fNToys;
+   const Int_t toysPerTask = std::max(fNToysPerTask, 1);
+   const std::size_t nTasks = (totToys + toysPerTask - 1) / toysPerTask;
+
+   // reset the number of toys after each task, also if it throws
+   struct NToysGuard {
+      Int_t &fNToysRef;
+      Int_t fSaved;
+      ~NToysGuard() { fNToysRef = fSaved; }
+   };
+
+   auto results = fParallelScheduler->Map<RooDataSet>(nTasks, [&](std::size_t iTask) {
+      NToysGuard guard{fNToys, totToys};
+      fNToys = std::min(toysPerTask, totToys - static_cast<Int_t>(iTask) * toysPerTask);
+      return GetSamplingDistributionsSingleWorker(paramPointIn);
+   });
+
+   RooDataSet* output = nullptr;
+   for (auto &result : results) {
+      if (!result) {
+         oocoutW(nullptr, Generation) << "ToyMCSampler: a task of the parallel run returned no toys" << endl;
+      } else if (!output) {
+         output = result.release();
+      } else {
+         output->append(*result);
+      }
+   }
+
+   return output;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// This is the main function for serial runs. It is called automatically
 /// from inside GetSamplingDistribution when no ProofConfig is given.
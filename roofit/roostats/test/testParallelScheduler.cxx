@@ -0,0 +1,270 @@
+// Tests for the RooStats::ParallelScheduler
+
+#include "RooStats/FrequentistCalculator.h"
+#include "RooStats/HypoTestInverter.h"
+#include "RooStats/HypoTestInverterResult.h"
+#include "RooStats/ModelConfig.h"
+#include "RooStats/ParallelScheduler.h"
+#include "RooStats/ProfileLikelihoodTestStat.h"
+#include "RooStats/SamplingDistribution.h"
+#include "RooStats/ToyMCSampler.h"
+
+#include "RooDataSet.h"
+#include "RooRandom.h"
+#include "RooRealVar.h"
+#include "RooWorkspace.h"
+
+#include "TParameter.h"
+#include "TSystem.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace RooStats;
+
+namespace {
+
+std::vector<double> runTasks(ParallelScheduler &scheduler, std::size_t nTasks, int *nCalls = nullptr)
+{
+   auto results = scheduler.Map<TParameter<double>>(nTasks, [&](std::size_t i) {
+      if (nCalls)
+         ++(*nCalls);
+      return new TParameter<double>("x", i + RooRandom::uniform());
+   });
+   std::vector<double> out;
+   for (auto &result : results) {
+      out.push_back(result ? result->GetVal() : -1.);
+   }
+   return out;
+}
+
+} // namespace
+
+/// The results must be ordered by task index and must not depend on the
+/// number of workers, and the calling process must continue with the same
+/// random numbers.
+TEST(ParallelScheduler, ReproducibleResults)
+{
+   constexpr std::size_t nTasks = 12;
+
+   RooRandom::randomGenerator()->SetSeed(1337);
+   ParallelScheduler serial(1);
+   std::vector<double> ref = runTasks(serial, nTasks);
+   const double refNext = RooRandom::uniform();
+
+   RooRandom::randomGenerator()->SetSeed(1337);
+   ParallelScheduler parallel(4);
+   std::vector<double> res = runTasks(parallel, nTasks);
+   const double next = RooRandom::uniform();
+
+   ASSERT_EQ(res.size(), nTasks);
+   for (std::size_t i = 0; i < nTasks; ++i) {
+      EXPECT_GE(ref[i], i);
+      EXPECT_LT(ref[i], i + 1.);
+      EXPECT_EQ(res[i], ref[i]);
+   }
+   EXPECT_EQ(next, refNext);
+
+   // different tasks get different random numbers
+   EXPECT_NE(ref[1] - ref[0], 1.);
+}
+
+/// Tasks found in the checkpoint directory are not computed again.
+TEST(ParallelScheduler, ResumeFromCheckpoint)
+{
+   constexpr std::size_t nTasks = 5;
+   const std::string dir = "testParallelScheduler_checkpoints";
+   gSystem->Exec(("rm -rf " + dir).c_str());
+
+   RooRandom::randomGenerator()->SetSeed(42);
+   ParallelScheduler first(2, dir.c_str());
+   std::vector<double> ref = runTasks(first, nTasks);
+
+   RooRandom::randomGenerator()->SetSeed(42);
+   ParallelScheduler second(1, dir.c_str());
+   int nCalls = 0;
+   std::vector<double> res = runTasks(second, nTasks, &nCalls);
+
+   EXPECT_EQ(nCalls, 0);
+   EXPECT_EQ(res, ref);
+
+   // The checkpoints of a different seed or number of tasks are ignored
+   RooRandom::randomGenerator()->SetSeed(43);
+   ParallelScheduler otherSeed(1, dir.c_str());
+   nCalls = 0;
+   runTasks(otherSeed, nTasks, &nCalls);
+   EXPECT_EQ(nCalls, static_cast<int>(nTasks));
+
+   RooRandom::randomGenerator()->SetSeed(42);
+   ParallelScheduler otherSize(1, dir.c_str());
+   nCalls = 0;
+   runTasks(otherSize, nTasks + 1, &nCalls);
+   EXPECT_EQ(nCalls, static_cast<int>(nTasks + 1));
+
+   gSystem->Exec(("rm -rf " + dir).c_str());
+}
+
+/// Failed tasks are not checkpointed, so they are computed again on resume.
+TEST(ParallelScheduler, RetryFailedTasks)
+{
+   constexpr std::size_t nTasks = 4;
+   const std::string dir = "testParallelScheduler_failed";
+   gSystem->Exec(("rm -rf " + dir).c_str());
+
+   RooRandom::randomGenerator()->SetSeed(42);
+   ParallelScheduler first(1, dir.c_str());
+   auto failed = first.Map<TParameter<double>>(nTasks, [](std::size_t i) {
+      return i == 2 ? nullptr : new TParameter<double>("x", i + RooRandom::uniform());
+   });
+   EXPECT_EQ(failed[2], nullptr);
+
+   RooRandom::randomGenerator()->SetSeed(42);
+   ParallelScheduler second(1, dir.c_str());
+   int nCalls = 0;
+   std::vector<double> res = runTasks(second, nTasks, &nCalls);
+
+   EXPECT_EQ(nCalls, 1);
+   for (std::size_t i = 0; i < nTasks; ++i) {
+      EXPECT_GE(res[i], i);
+      if (failed[i])
+         EXPECT_EQ(res[i], failed[i]->GetVal());
+   }
+
+   gSystem->Exec(("rm -rf " + dir).c_str());
+}
+
+/// A task that throws doesn't leave the scheduler in the nested mode.
+TEST(ParallelScheduler, ThrowingTask)
+{
+   ParallelScheduler scheduler(1);
+   EXPECT_THROW(scheduler.Run(2, [](std::size_t) -> TObject * { throw std::runtime_error("task failed"); }),
+                std::runtime_error);
+   EXPECT_FALSE(ParallelScheduler::IsInsideTask());
+}
+
+namespace {
+
+/// Poisson counting experiment with signal strength mu, a signal of 5 and a
+/// background of 3 events, with 5 observed events.
+struct CountingModel {
+   CountingModel()
+   {
+      ws.factory("Poisson::pdf(n[0,50], sum::lambda(prod::s(mu[1,0,10],nsig[5]), b[3]))");
+      ws.var("n")->setVal(5);
+      data = std::make_unique<RooDataSet>("data", "data", *ws.var("n"));
+      data->add(*ws.var("n"));
+
+      sbModel.SetPdf("pdf");
+      sbModel.SetObservables("n");
+      sbModel.SetParametersOfInterest("mu");
+      ws.var("mu")->setVal(1);
+      sbModel.SetSnapshot(*ws.var("mu"));
+
+      bModel.SetPdf("pdf");
+      bModel.SetObservables("n");
+      bModel.SetParametersOfInterest("mu");
+      ws.var("mu")->setVal(0);
+      bModel.SetSnapshot(*ws.var("mu"));
+   }
+
+   RooWorkspace ws{"w"};
+   std::unique_ptr<RooDataSet> data;
+   ModelConfig sbModel{"S+B", &ws};
+   ModelConfig bModel{"B", &ws};
+};
+
+struct ScanResult {
+   std::vector<double> xValues;
+   std::vector<double> cls;
+   std::vector<int> nToys;
+   int totalToys = 0;
+};
+
+ScanResult runFixedScan(ParallelScheduler *scanScheduler, ParallelScheduler *toyScheduler)
+{
+   CountingModel model;
+
+   FrequentistCalculator fc(*model.data, model.bModel, model.sbModel);
+   fc.SetToys(40, 20);
+   ProfileLikelihoodTestStat testStat(*model.sbModel.GetPdf());
+   testStat.SetOneSided(true);
+   auto *sampler = static_cast<ToyMCSampler *>(fc.GetTestStatSampler());
+   sampler->SetTestStatistic(&testStat);
+   sampler->SetNEventsPerToy(1);
+   sampler->SetParallelScheduler(toyScheduler);
+   sampler->SetNToysPerTask(15);
+
+   HypoTestInverter inverter(fc, nullptr, 0.05);
+   inverter.UseCLs(true);
+   inverter.SetParallelScheduler(scanScheduler);
+
+   RooRandom::randomGenerator()->SetSeed(2024);
+   EXPECT_TRUE(inverter.RunFixedScan(3, 0., 4.));
+
+   // the sampler of this process ran the toys, and those of the last run are the background-only ones
+   if (toyScheduler)
+      EXPECT_EQ(sampler->GetNToys(), 20);
+
+   std::unique_ptr<HypoTestInverterResult> result{inverter.GetInterval()};
+   ScanResult out;
+   for (int i = 0; i < result->ArraySize(); ++i) {
+      HypoTestResult *point = result->GetResult(i);
+      out.xValues.push_back(result->GetXValue(i));
+      out.cls.push_back(result->CLs(i));
+      out.nToys.push_back(point->GetNullDistribution()->GetSize() + point->GetAltDistribution()->GetSize());
+   }
+   out.totalToys = inverter.GetTotalToysRun();
+   return out;
+}
+
+void expectSameScan(const ScanResult &res, const ScanResult &ref)
+{
+   ASSERT_EQ(res.xValues.size(), ref.xValues.size());
+   for (std::size_t i = 0; i < ref.xValues.size(); ++i) {
+      EXPECT_EQ(res.xValues[i], ref.xValues[i]);
+      EXPECT_EQ(res.cls[i], ref.cls[i]);
+      EXPECT_EQ(res.nToys[i], ref.nToys[i]);
+   }
+   EXPECT_EQ(res.totalToys, ref.totalToys);
+}
+
+} // namespace
+
+/// The points of a fixed scan give the same results on one and on several
+/// worker processes, and the toys of the workers are counted.
+TEST(ParallelScheduler, HypoTestInverterFixedScan)
+{
+   ParallelScheduler serial(1);
+   ScanResult ref = runFixedScan(&serial, nullptr);
+
+   ASSERT_EQ(ref.xValues.size(), 3u);
+   EXPECT_DOUBLE_EQ(ref.xValues[0], 0.);
+   EXPECT_DOUBLE_EQ(ref.xValues[2], 4.);
+   for (int nToys : ref.nToys) {
+      EXPECT_EQ(nToys, 60);
+   }
+   EXPECT_EQ(ref.totalToys, 180);
+
+   ParallelScheduler parallel(3);
+   expectSameScan(runFixedScan(&parallel, nullptr), ref);
+}
+
+/// The toys of each point can be split over the worker processes, which
+/// leaves the number of toys of the sampler unchanged.
+TEST(ParallelScheduler, ToyMCSamplerTasks)
+{
+   ParallelScheduler serial(1);
+   ScanResult ref = runFixedScan(nullptr, &serial);
+
+   ASSERT_EQ(ref.xValues.size(), 3u);
+   for (int nToys : ref.nToys) {
+      EXPECT_EQ(nToys, 60);
+   }
+   EXPECT_EQ(ref.totalToys, 180);
+
+   ParallelScheduler parallel(3);
+   expectSameScan(runFixedScan(nullptr, &parallel), ref);
+}
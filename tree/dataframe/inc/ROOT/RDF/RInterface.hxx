@@ -40,6 +40,8 @@
 #include "THn.h"
 #include "TProfile.h"
 #include "TProfile2D.h"
+#include "THyperLogLog.h"
+#include "TQuantileSketch.h"
 #include "TStatistic.h"
 
 #include <algorithm>
@@ -2446,6 +2448,77 @@ public:
       }
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Return a TQuantileSketch object summarizing the distribution of a column (*lazy action*).
+   ///
+   /// \tparam V The type of the value column
+   /// \param[in] value The name of the column with the values to fill the sketch with.
+   /// \param[in] k The accuracy parameter of the sketch, see TQuantileSketch.
+   /// \return the filled TQuantileSketch object wrapped in a RResultPtr.
+   ///
+   /// Approximate quantiles of any number of values are obtained in a single pass and in
+   /// little memory, unlike with Take() and sorting. With multi-threading, one sketch is
+   /// filled per slot and they are merged at the end.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// // Deduce column type (this invocation needs jitting internally)
+   /// auto sketch0 = myDf.Quantiles("values");
+   /// // Explicit column type
+   /// auto sketch1 = myDf.Quantiles<float>("values", 1000);
+   /// auto median = sketch1->GetQuantile(0.5);
+   /// ~~~
+   ///
+   template <typename V = RDFDetail::RInferredType>
+   RResultPtr<TQuantileSketch> Quantiles(std::string_view value = "", Int_t k = 200)
+   {
+      ColumnNames_t columns;
+      if (!value.empty()) {
+         columns.emplace_back(std::string(value));
+      }
+      const auto validColumnNames = GetValidatedColumnNames(1, columns);
+      if (std::is_same<V, RDFDetail::RInferredType>::value) {
+         return Fill(TQuantileSketch("", k), validColumnNames);
+      } else {
+         return Fill<V>(TQuantileSketch("", k), validColumnNames);
+      }
+   }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Return a THyperLogLog object counting the distinct values of a column (*lazy action*).
+   ///
+   /// \tparam V The type of the value column: an arithmetic type or `std::string`
+   /// \param[in] value The name of the column with the values to count.
+   /// \param[in] precision The precision of the sketch, see THyperLogLog.
+   /// \return the filled THyperLogLog object wrapped in a RResultPtr.
+   ///
+   /// The number of distinct values is estimated in a single pass and in fixed memory.
+   /// With multi-threading, one sketch is filled per slot and they are merged at the end.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// // Deduce column type (this invocation needs jitting internally)
+   /// auto distinct0 = myDf.CountDistinct("runNumber");
+   /// // Explicit column type
+   /// auto distinct1 = myDf.CountDistinct<ULong64_t>("eventNumber");
+   /// auto nDistinct = distinct1->GetCount();
+   /// ~~~
+   ///
+   template <typename V = RDFDetail::RInferredType>
+   RResultPtr<THyperLogLog> CountDistinct(std::string_view value = "", Int_t precision = 14)
+   {
+      ColumnNames_t columns;
+      if (!value.empty()) {
+         columns.emplace_back(std::string(value));
+      }
+      const auto validColumnNames = GetValidatedColumnNames(1, columns);
+      if (std::is_same<V, RDFDetail::RInferredType>::value) {
+         return Fill(THyperLogLog("", precision), validColumnNames);
+      } else {
+         return Fill<V>(THyperLogLog("", precision), validColumnNames);
+      }
+   }
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Return the minimum of processed column values (*lazy action*).
    /// \tparam T The type of the branch/column.
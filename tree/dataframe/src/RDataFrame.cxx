@@ -124,6 +124,7 @@ produce many different results in one event loop. Instant actions trigger the ev
 | Book() | Book execution of a custom action using a user-defined helper object. |
 | Cache() | Cache column values in memory. Custom columns can be cached as well, filtered entries are not cached. Users can specify which columns to save (default is all). |
 | Count() | Return the number of events processed. Useful e.g. to get a quick count of the number of events passing a Filter. |
+| CountDistinct() | Return a THyperLogLog object estimating the number of distinct values of a column in fixed memory. |
 | Display() | Provides a printable representation of the dataset contents. The method returns a ROOT::RDF::RDisplay() instance which can print a tabular representation of the data or return it as a string. |
 | Fill() | Fill a user-defined object with the values of the specified columns, as if by calling `Obj.Fill(col1, col2, ...)`. |
 | Graph() | Fills a TGraph with the two columns provided. If multi-threading is enabled, the order of the points may not be the one expected, it is therefore suggested to sort if before drawing. |
@@ -134,6 +135,7 @@ produce many different results in one event loop. Instant actions trigger the ev
 | Mean() | Return the mean of processed column values.|
 | Min() | Return the minimum of processed column values. If the type of the column is inferred, the return type is `double`, the type of the column otherwise.|
 | Profile1D(), Profile2D() | Fill a one- or two-dimensional profile with the column values that passed all filters. |
+| Quantiles() | Return a TQuantileSketch object from which approximate quantiles (e.g. the median) of a column can be obtained, in a single pass and with little memory. |
 | Reduce() | Reduce (e.g. sum, merge) entries using the function (lambda, functor...) passed as argument. The function must have signature `T(T,T)` where `T` is the type of the column. Return the final result of the reduction operation. An optional parameter allows initialization of the result object to non-default values. |
 | Report() | Obtain statistics on how many entries have been accepted and rejected by the filters. See the section on [named filters](#named-filters-and-cutflow-reports) for a more detailed explanation. The method returns a ROOT::RDF::RCutFlowReport instance which can be queried programmatically to get information about the effects of the individual cuts. |
 | Stats() | Return a TStatistic object filled with the input columns. |
@@ -968,6 +968,33 @@ TEST_P(RDFSimpleTests, Stats)
    EXPECT_ANY_THROW(rr.Stats<ULong64_t>("v", "one"));
 }
 
+TEST_P(RDFSimpleTests, QuantilesAndCountDistinct)
+{
+   ROOT::RDataFrame r(256);
+   // clang-format off
+   auto rr = r.Define("v", [](ULong64_t e) { return e; }, {"rdfentry_"})
+               .Define("mod", [](ULong64_t e) { return e % 10; }, {"v"})
+               .Define("str", [](ULong64_t e) { return std::to_string(e % 7); }, {"v"});
+   // clang-format on
+
+   // with k larger than the number of entries the sketch keeps all values
+   auto q0 = rr.Quantiles("v", 1000);
+   auto q0c = rr.Quantiles<ULong64_t>("v", 1000);
+   auto d0 = rr.CountDistinct("mod");
+   auto d0c = rr.CountDistinct<ULong64_t>("mod");
+   auto d1c = rr.CountDistinct<std::string>("str");
+
+   EXPECT_EQ(q0->GetN(), 256);
+   EXPECT_DOUBLE_EQ(q0->GetQuantile(0.5), 127.);
+   EXPECT_DOUBLE_EQ(q0->GetQuantile(0.), 0.);
+   EXPECT_DOUBLE_EQ(q0->GetQuantile(1.), 255.);
+   EXPECT_DOUBLE_EQ(q0c->GetQuantile(0.25), q0->GetQuantile(0.25));
+   EXPECT_EQ(d0->GetN(), 256);
+   EXPECT_NEAR(d0->GetCount(), 10., 0.1);
+   EXPECT_DOUBLE_EQ(d0c->GetCount(), d0->GetCount());
+   EXPECT_NEAR(d1c->GetCount(), 7., 0.1);
+}
+
 TEST(RDFSimpleTests, ScalarValuesCollectionWeights)
 {
    ROOT::RDataFrame r(1);
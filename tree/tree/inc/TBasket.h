@@ -45,6 +45,10 @@ private:
    // Helper for managing the compressed buffer.
    void InitializeCompressedBuffer(Int_t len, TFile* file);
 
+   // The two steps of WriteBuffer; TBranch compresses in the background and writes on the filling thread.
+   Int_t CompressBuffer(TFile *file);
+   Int_t WriteCompressedBuffer(TFile *file, Int_t nout);
+
    // Handles special logic around deleting / reseting the entry offset pointer.
    void ResetEntryOffset();
 
@@ -75,6 +79,7 @@ protected:
    Int_t       fLastWriteBufferSize[3] = {0,0,0}; ///<! Size of the buffer last three buffers we wrote it to disk
    bool        fResetAllocation{false};           ///<! True if last reset re-allocated the memory
    UChar_t     fNextBufferSizeRecord{0};          ///<! Index into fLastWriteBufferSize of the last buffer written to disk
+   Int_t       fWriteCycle{-1};                   ///<! If not negative, basket number to use as key cycle in the next WriteBuffer
 #ifdef R__TRACK_BASKET_ALLOC_TIME
    ULong64_t   fResetAllocationTime{0};           ///<! Time spent reallocating baskets in microseconds during last Reset operation.
 #endif
@@ -149,6 +154,7 @@ public:
            void    SetNevBufSize(Int_t n) { fNevBufSize=n; }
    virtual void    SetReadMode();
    virtual void    SetWriteMode();
+           void    SetWriteCycle(Int_t basketnumber) { fWriteCycle = basketnumber; }
    inline  void    Update(Int_t newlast) { Update(newlast,newlast); };
    virtual void    Update(Int_t newlast, Int_t skipped);
    virtual Int_t   WriteBuffer();
@@ -141,6 +141,8 @@ protected:
    Int_t      *fBasketBytes;      ///<[fMaxBaskets] Length of baskets on file
    Long64_t   *fBasketEntry;      ///<[fMaxBaskets] Table of first entry in each basket
    Long64_t   *fBasketSeek;       ///<[fMaxBaskets] Addresses of baskets on file
+   Double_t   *fBasketMin;        ///<[fMaxBaskets] Smallest value in each basket, if basket statistics are kept
+   Double_t   *fBasketMax;        ///<[fMaxBaskets] Largest value in each basket, if basket statistics are kept
    TTree      *fTree;             ///<! Pointer to Tree header
    TBranch    *fMother;           ///<! Pointer to top-level parent branch in the tree.
    TBranch    *fParent;           ///<! Pointer to parent branch.
@@ -161,6 +163,10 @@ protected:
    ReadLeaves_t fReadLeaves;      ///<! Pointer to the ReadLeaves implementation to use.
    typedef void (TBranch::*FillLeaves_t)(TBuffer &b);
    FillLeaves_t fFillLeaves;      ///<! Pointer to the FillLeaves implementation to use.
+   TBasket     *fPendingBasket;   ///<! Full basket being compressed in the background (see TTree::SetWriteBehind)
+   Int_t        fPendingWhere;    ///<! Basket number of fPendingBasket
+   ROOT::Internal::TBranchIMTHelper *fPendingTask; ///<! Task compressing fPendingBasket
+   std::vector<TBasket *> fPreparedBaskets; ///<! Baskets on file loaded with their key by PrepareBaskets, by basket number
    void     ReadLeavesImpl(TBuffer &b);
    void     ReadLeaves0Impl(TBuffer &b);
    void     ReadLeaves1Impl(TBuffer &b);
@@ -186,6 +192,12 @@ private:
    Int_t    GetEntriesSerialized(Long64_t, TBuffer&, TBuffer*);
    Int_t    FillEntryBuffer(TBasket* basket,TBuffer* buf, Int_t& lnew);
    Int_t    WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBranchIMTHelper *);
+   Int_t    WriteBasketBehind(TBasket* basket);
+   void     WaitPendingBasket();
+   void     PrepareBaskets();
+   void     DropPreparedBaskets();
+   void     AdjustEntryOffsetLen(Int_t nevbuf);
+   void     FillBasketStats(Int_t where, Int_t nevbuf);
    TBranch(const TBranch&) = delete;             // not implemented
    TBranch& operator=(const TBranch&) = delete;  // not implemented
 
@@ -213,6 +225,7 @@ public:
            TBasket  *GetBasket(Int_t basket) {return GetBasketImpl(basket, nullptr);}
            Int_t    *GetBasketBytes() const {return fBasketBytes;}
            Long64_t *GetBasketEntry() const {return fBasketEntry;}
+           bool      GetBasketStats(Int_t basket, Double_t &min, Double_t &max) const;
    virtual Long64_t  GetBasketSeek(Int_t basket) const;
    virtual Int_t     GetBasketSize() const {return fBasketSize;}
            ROOT::Experimental::Internal::TBulkBranchRead &GetBulkRead() { return fBulk; }
@@ -255,6 +268,7 @@ public:
            TBranch  *GetMother() const;
            TBranch  *GetSubBranch(const TBranch *br) const;
            TBuffer  *GetTransientBuffer(Int_t size);
+           bool      HasBasketStats() const { return fBasketMin != nullptr; }
            bool      IsAutoDelete() const;
            bool      IsFolder() const override;
    virtual void      KeepCircular(Long64_t maxEntries);
@@ -270,6 +284,7 @@ public:
    virtual void      SetAddress(void *add);
    virtual void      SetObject(void *objadd);
    virtual void      SetAutoDelete(bool autodel=true);
+           bool      SetBasketStats(bool enable = true);
    virtual void      SetBasketSize(Int_t buffsize);
    virtual void      SetBufferAddress(TBuffer *entryBuffer);
            void      SetCompressionAlgorithm(Int_t algorithm = ROOT::RCompressionSetting::EAlgorithm::kUseGlobal);
@@ -292,7 +307,7 @@ public:
 
    static  void      ResetCount();
 
-   ClassDefOverride(TBranch, 13); // Branch descriptor
+   ClassDefOverride(TBranch, 14); // Branch descriptor
 };
 
 //______________________________________________________________________________
@@ -140,6 +140,7 @@ protected:
    bool           fCacheDoClusterPrefetch;///<! true if cache is prefetching whole clusters
    bool           fCacheUserSet;          ///<! true if the cache setting was explicitly given by user
    bool           fIMTEnabled;            ///<! true if implicit multi-threading is enabled for this tree
+   bool           fWriteBehind{false};    ///<! true if full baskets are compressed in the background by Fill (requires IMT)
    UInt_t         fNEntriesSinceSorting;  ///<! Number of entries processed since the last re-sorting of branches
    std::vector<std::pair<Long64_t,TBranch*>> fSortedBranches; ///<! Branches to be processed in parallel when IMT is on, sorted by average task time
    std::vector<TBranch*> fSeqBranches;    ///<! Branches to be processed sequentially when IMT is on
@@ -542,6 +543,7 @@ public:
    virtual Double_t       *GetV4()   { return GetPlayer()->GetV4(); }
    virtual Double_t       *GetW()    { return GetPlayer()->GetW(); }
    virtual Double_t        GetWeight() const   { return fWeight; }
+   virtual bool            GetWriteBehind() const { return fWriteBehind; }
    virtual Long64_t        GetZipBytes() const { return fZipBytes; }
    virtual void            IncrementTotalBuffers(Int_t nbytes) { fTotalBuffers += nbytes; }
            bool            IsFolder() const override { return true; }
@@ -582,6 +584,7 @@ public:
    virtual void            SetAutoSave(Long64_t autos = -300000000);
    virtual void            SetAutoFlush(Long64_t autof = -30000000);
    virtual void            SetBasketSize(const char* bname, Int_t buffsize = 16000);
+           Int_t           SetBasketStats(const char* bname, bool enable = true);
    virtual Int_t           SetBranchAddress(const char *bname,void *add, TBranch **ptr = nullptr);
    virtual Int_t           SetBranchAddress(const char *bname,void *add, TClass *realClass, EDataType datatype, bool isptr);
    virtual Int_t           SetBranchAddress(const char *bname,void *add, TBranch **ptr, TClass *realClass, EDataType datatype, bool isptr);
@@ -619,6 +622,7 @@ public:
    virtual void            SetEventList(TEventList* list);
    virtual void            SetEntryList(TEntryList* list, Option_t *opt="");
    virtual void            SetImplicitMT(bool enabled) { fIMTEnabled = enabled; }
+   virtual void            SetWriteBehind(bool enabled = true) { fWriteBehind = enabled; }
    virtual void            SetMakeClass(Int_t make);
    virtual void            SetMaxEntryLoop(Long64_t maxev = kMaxEntries) { fMaxEntryLoop = maxev; } // *MENU*
    static  void            SetMaxTreeSize(Long64_t maxsize = 100000000000LL);
@@ -33,6 +33,7 @@ class TTreeCloner {
 
    bool       fIsValid;
    bool       fNeedConversion;   ///< True if the fast merge is not possible but a slow merge might possible.
+   bool       fPrepared;         ///< True if some baskets of the source tree were loaded by TBranch::PrepareBaskets.
    UInt_t     fOptions;
    TTree     *fFromTree;
    TTree     *fToTree;
@@ -1139,16 +1139,13 @@ Int_t TBasket::WriteBuffer()
    }
    fMotherDir = file; // fBranch->GetDirectory();
 
-   // This mutex prevents multiple TBasket::WriteBuffer invocations from interacting
-   // with the underlying TFile at once - TFile is assumed to *not* be thread-safe.
-   //
-   // The only parallelism we'd like to exploit (right now!) is the compression
-   // step - everything else should be serialized at the TFile level.
+   if (R__unlikely(fBufferRef->TestBit(TBufferFile::kNotDecompressed))) {
+      // This mutex prevents multiple TBasket::WriteBuffer invocations from interacting
+      // with the underlying TFile at once - TFile is assumed to *not* be thread-safe.
 #ifdef R__USE_IMT
-   std::unique_lock<std::mutex> sentry(file->fWriteMutex);
+      std::lock_guard<std::mutex> sentry(file->fWriteMutex);
 #endif  // R__USE_IMT
 
-   if (R__unlikely(fBufferRef->TestBit(TBufferFile::kNotDecompressed))) {
       // Read the basket information that was saved inside the buffer.
       bool writing = fBufferRef->IsWriting();
       fBufferRef->SetReadMode();
@@ -1170,6 +1167,21 @@ Int_t TBasket::WriteBuffer()
       return nBytes>0 ? fKeylen+nout : -1;
    }
 
+   Int_t nout = CompressBuffer(file);
+   if (nout < 0)
+      return -1;
+   return WriteCompressedBuffer(file, nout);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// First step of WriteBuffer: transfer the entry offset table at the end of
+/// the buffer and compress it. Only this basket is modified, the file is not
+/// accessed, so that the compression of several baskets can run in parallel.
+///
+/// Returns the size of the object on file without key, or -1 in case of error.
+
+Int_t TBasket::CompressBuffer(TFile *file)
+{
    // Transfer fEntryOffset table at the end of fBuffer.
    fLast = fBufferRef->Length();
    Int_t *entryOffset = GetEntryOffset();
@@ -1209,7 +1221,9 @@ Int_t TBasket::WriteBuffer()
    fObjlen = fBufferRef->Length() - fKeylen;
 
    fHeaderOnly = true;
-   fCycle = fBranch->GetWriteBasket();
+   // A basket written behind the fill no longer is the branch's write basket.
+   fCycle = fWriteCycle >= 0 ? fWriteCycle : fBranch->GetWriteBasket();
+   fWriteCycle = -1;
    Int_t cxlevel = fBranch->GetCompressionLevel();
    if (cxlevel == ROOT::RCompressionSetting::ELevel::kInherit)
       cxlevel = file->GetCompressionLevel();
@@ -1236,56 +1250,62 @@ Int_t TBasket::WriteBuffer()
          // Compress the buffer.  Note that we allow multiple TBasket compressions to occur at once
          // for a given TFile: that's because the compression buffer when we use IMT is no longer
          // shared amongst several threads.
-#ifdef R__USE_IMT
-         sentry.unlock();
-#endif  // R__USE_IMT
          // NOTE this is declared with C linkage, so it shouldn't except.  Also, when
          // USE_IMT is defined, we are guaranteed that the compression buffer is unique per-branch.
          // (see fCompressedBufferRef in constructor).
          R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
-#ifdef R__USE_IMT
-         sentry.lock();
-#endif  // R__USE_IMT
 
          // test if buffer has really been compressed. In case of small buffers
          // when the buffer contains random data, it may happen that the compressed
          // buffer is larger than the input. In this case, we write the original uncompressed buffer
          if (nout == 0 || nout >= fObjlen) {
-            nout = fObjlen;
             // We used to delete fBuffer here, we no longer want to since
             // the buffer (held by fCompressedBufferRef) might be re-used later.
             fBuffer = fBufferRef->Buffer();
-            Create(fObjlen,file);
-            fBufferRef->SetBufferOffset(0);
-
-            Streamer(*fBufferRef);         //write key itself again
-            if ((nout+fKeylen)>buflen) {
+            if ((fObjlen+fKeylen)>buflen) {
                Warning("WriteBuffer","Possible memory corruption due to compression algorithm, wrote %d bytes past the end of a block of %d bytes. fNbytes=%d, fObjLen=%d, fKeylen=%d",
-                  (nout+fKeylen-buflen),buflen,fNbytes,fObjlen,fKeylen);
+                  (fObjlen+fKeylen-buflen),buflen,fNbytes,fObjlen,fKeylen);
             }
-            goto WriteFile;
+            return fObjlen;
          }
          bufcur += nout;
          noutot += nout;
          objbuf += kMAXZIPBUF;
          nzip   += kMAXZIPBUF;
       }
-      nout = noutot;
-      Create(noutot,file);
-      fBufferRef->SetBufferOffset(0);
+      return noutot;
+   }
 
-      Streamer(*fBufferRef);         //write key itself again
-      memcpy(fBuffer,fBufferRef->Buffer(),fKeylen);
-   } else {
-      fBuffer = fBufferRef->Buffer();
-      Create(fObjlen,file);
-      fBufferRef->SetBufferOffset(0);
+   fBuffer = fBufferRef->Buffer();
+   return fObjlen;
+}
 
-      Streamer(*fBufferRef);         //write key itself again
-      nout = fObjlen;
-   }
+////////////////////////////////////////////////////////////////////////////////
+/// Second step of WriteBuffer: allocate the key on the file for an object of
+/// `nout` bytes, as returned by CompressBuffer(), and write the basket.
+///
+/// Returns the number of bytes written, or -1 in case of error.
+
+Int_t TBasket::WriteCompressedBuffer(TFile *file, Int_t nout)
+{
+   // This mutex prevents multiple TBasket::WriteBuffer invocations from interacting
+   // with the underlying TFile at once - TFile is assumed to *not* be thread-safe.
+   //
+   // The only parallelism we'd like to exploit (right now!) is the compression
+   // step - everything else should be serialized at the TFile level.
+#ifdef R__USE_IMT
+   std::lock_guard<std::mutex> sentry(file->fWriteMutex);
+#endif  // R__USE_IMT
+
+   fMotherDir = file;
+   Create(nout,file);
+   fBufferRef->SetBufferOffset(0);
+
+   Streamer(*fBufferRef);         //write key itself again
+   // The key header goes in front of the compressed data
+   if (fBuffer != fBufferRef->Buffer())
+      memcpy(fBuffer,fBufferRef->Buffer(),fKeylen);
 
-WriteFile:
    Int_t nBytes = WriteFileKeepBuffer();
    fHeaderOnly = false;
    return nBytes>0 ? fKeylen+nout : -1;
@@ -53,10 +53,12 @@
 
 #include "ROOT/TIOFeatures.hxx"
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstring>
 #include <cstdio>
+#include <limits>
 
 
 Int_t TBranch::fgCount = 0;
@@ -113,6 +115,8 @@ TBranch::TBranch()
 , fBasketBytes(nullptr)
 , fBasketEntry(nullptr)
 , fBasketSeek(nullptr)
+, fBasketMin(nullptr)
+, fBasketMax(nullptr)
 , fTree(nullptr)
 , fMother(nullptr)
 , fParent(nullptr)
@@ -126,6 +130,9 @@ TBranch::TBranch()
 , fSkipZip(false)
 , fReadLeaves(&TBranch::ReadLeavesImpl)
 , fFillLeaves(&TBranch::FillLeavesImpl)
+, fPendingBasket(nullptr)
+, fPendingWhere(-1)
+, fPendingTask(nullptr)
 {
    SetBit(TBranch::kDoNotUseBufferMap);
 }
@@ -226,6 +233,8 @@ TBranch::TBranch(TTree *tree, const char *name, void *address, const char *leafl
 , fBasketBytes(nullptr)
 , fBasketEntry(nullptr)
 , fBasketSeek(nullptr)
+, fBasketMin(nullptr)
+, fBasketMax(nullptr)
 , fTree(tree)
 , fMother(nullptr)
 , fParent(nullptr)
@@ -239,6 +248,9 @@ TBranch::TBranch(TTree *tree, const char *name, void *address, const char *leafl
 , fSkipZip(false)
 , fReadLeaves(&TBranch::ReadLeavesImpl)
 , fFillLeaves(&TBranch::FillLeavesImpl)
+, fPendingBasket(nullptr)
+, fPendingWhere(-1)
+, fPendingTask(nullptr)
 {
    Init(name,leaflist,compress);
 }
@@ -280,6 +292,8 @@ TBranch::TBranch(TBranch *parent, const char *name, void *address, const char *l
 , fBasketBytes(nullptr)
 , fBasketEntry(nullptr)
 , fBasketSeek(nullptr)
+, fBasketMin(nullptr)
+, fBasketMax(nullptr)
 , fTree(parent ? parent->GetTree() : nullptr)
 , fMother(parent ? parent->GetMother() : nullptr)
 , fParent(parent)
@@ -293,6 +307,9 @@ TBranch::TBranch(TBranch *parent, const char *name, void *address, const char *l
 , fSkipZip(false)
 , fReadLeaves(&TBranch::ReadLeavesImpl)
 , fFillLeaves(&TBranch::FillLeavesImpl)
+, fPendingBasket(nullptr)
+, fPendingWhere(-1)
+, fPendingTask(nullptr)
 {
    Init(name,leaflist,compress);
 }
@@ -449,6 +466,9 @@ void TBranch::Init(const char* name, const char* leaflist, Int_t compress)
 
 TBranch::~TBranch()
 {
+   WaitPendingBasket();
+   DropPreparedBaskets();
+
    delete fBrowsables;
    fBrowsables = nullptr;
 
@@ -458,6 +478,12 @@ TBranch::~TBranch()
    delete [] fBasketSeek;
    fBasketSeek  = nullptr;
 
+   delete [] fBasketMin;
+   fBasketMin   = nullptr;
+
+   delete [] fBasketMax;
+   fBasketMax   = nullptr;
+
    delete [] fBasketEntry;
    fBasketEntry = nullptr;
 
@@ -579,10 +605,19 @@ void TBranch::AddBasket(TBasket& b, bool ondisk, Long64_t startEntry)
             fBasketEntry[j] = fBasketEntry[j-1];
             fBasketBytes[j] = fBasketBytes[j-1];
             fBasketSeek[j]  = fBasketSeek[j-1];
+            if (fBasketMin) {
+               fBasketMin[j] = fBasketMin[j-1];
+               fBasketMax[j] = fBasketMax[j-1];
+            }
          }
       }
    }
    fBasketEntry[where] = startEntry;
+   if (fBasketMin) {
+      // The values in an imported basket are unknown.
+      fBasketMin[where] = -std::numeric_limits<Double_t>::infinity();
+      fBasketMax[where] = std::numeric_limits<Double_t>::infinity();
+   }
 
    TBasket *existing = (TBasket*)fBaskets.At(fWriteBasket);
    if (existing && existing->GetNevBuf()) {
@@ -725,6 +760,7 @@ void TBranch::Browse(TBrowser* b)
 
 void TBranch::DeleteBaskets(Option_t* option)
 {
+   WaitPendingBasket();
    TString opt = option;
    opt.ToLower();
    TFile *file = GetFile(0);
@@ -756,6 +792,8 @@ void TBranch::DeleteBaskets(Option_t* option)
 
 void TBranch::DropBaskets(Option_t* options)
 {
+   WaitPendingBasket();
+
    bool all = false;
    if (options && options[0]) {
       TString opt = options;
@@ -830,6 +868,12 @@ void TBranch::ExpandBasketArrays()
                                                 newsize*sizeof(Long64_t),fMaxBaskets*sizeof(Long64_t));
    fBasketSeek   = (Long64_t*)TStorage::ReAlloc(fBasketSeek,
                                                 newsize*sizeof(Long64_t),fMaxBaskets*sizeof(Long64_t));
+   if (fBasketMin) {
+      fBasketMin = (Double_t*)TStorage::ReAlloc(fBasketMin,
+                                                newsize*sizeof(Double_t),fMaxBaskets*sizeof(Double_t));
+      fBasketMax = (Double_t*)TStorage::ReAlloc(fBasketMax,
+                                                newsize*sizeof(Double_t),fMaxBaskets*sizeof(Double_t));
+   }
 
    fMaxBaskets   = newsize;
 
@@ -839,6 +883,10 @@ void TBranch::ExpandBasketArrays()
       fBasketBytes[i] = 0;
       fBasketEntry[i] = 0;
       fBasketSeek[i]  = 0;
+      if (fBasketMin) {
+         fBasketMin[i] = -std::numeric_limits<Double_t>::infinity();
+         fBasketMax[i] = std::numeric_limits<Double_t>::infinity();
+      }
    }
 }
 
@@ -891,6 +939,9 @@ Int_t TBranch::FillImpl(ROOT::Internal::TBranchIMTHelper *imtHelper)
       ++fEntries;
       ++fEntryNumber;
       (this->*fFillLeaves)(*buf);
+      if (fBasketMin) {
+         FillBasketStats(fWriteBasket, basket->GetNevBuf());
+      }
       if (buf->GetMapCount()) {
          // The map is used.
          ResetBit(TBranch::kDoNotUseBufferMap);
@@ -922,7 +973,13 @@ Int_t TBranch::FillImpl(ROOT::Internal::TBranchIMTHelper *imtHelper)
    if (noFlushAtCluster && !fTree->TestBit(TTree::kCircular) &&
        ((fSkipZip && (lnew >= TBuffer::kMinimalSize)) || (buf->TestBit(TBufferFile::kNotDecompressed)) ||
         ((lnew + (2 * nsize) + nbytes) >= fBasketSize))) {
-      Int_t nout = WriteBasketImpl(basket, fWriteBasket, imtHelper);
+      Int_t nout;
+      if (!imtHelper && fTree->GetWriteBehind() && fTree->GetImplicitMT() && ROOT::IsImplicitMTEnabled() &&
+          basket->IsA() == TBasket::Class() && !buf->TestBit(TBufferFile::kNotDecompressed)) {
+         nout = WriteBasketBehind(basket);
+      } else {
+         nout = WriteBasketImpl(basket, fWriteBasket, imtHelper);
+      }
       if (nout < 0) Error("TBranch::Fill", "Failed to write out basket.\n");
       return (nout >= 0) ? nbytes : -1;
    }
@@ -1138,6 +1195,9 @@ Int_t TBranch::FlushBaskets()
    UInt_t nerror = 0;
    Int_t nbytes = 0;
 
+   // Complete the write of the basket filled last, if it is still in flight.
+   WaitPendingBasket();
+
    Int_t maxbasket = fWriteBasket + 1;
    // The following protection is not necessary since we should always
    // have fWriteBasket < fBasket.GetSize()
@@ -1231,6 +1291,10 @@ TBasket* TBranch::GetBasketImpl(Int_t basketnumber, TBuffer *user_buffer)
    // different files processed simultaneously.
    static std::atomic<Int_t> nerrors(0);
 
+   // a basket written behind the fill needs its location on file.
+   if (R__unlikely(fPendingBasket))
+      WaitPendingBasket();
+
       // reference to an existing basket in memory ?
    if (basketnumber <0 || basketnumber > fWriteBasket) return nullptr;
    TBasket *basket = (TBasket*)fBaskets.UncheckedAt(basketnumber);
@@ -1305,6 +1369,24 @@ Long64_t TBranch::GetBasketSeek(Int_t basketnumber) const
    return fBasketSeek[basketnumber];
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Retrieve the range of values filled into basket number `basket`.
+///
+/// Returns false if the branch does not keep basket statistics (see
+/// SetBasketStats()) or if there is no such basket. Baskets whose content
+/// is not known, e.g. baskets filled before the statistics were enabled or
+/// imported by fast cloning, report the range [-inf, +inf]; empty baskets
+/// report [+inf, -inf].
+
+bool TBranch::GetBasketStats(Int_t basket, Double_t &min, Double_t &max) const
+{
+   if (!fBasketMin || basket < 0 || basket > fWriteBasket)
+      return false;
+   min = fBasketMin[basket];
+   max = fBasketMax[basket];
+   return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns (and, if 0, creates) browsable objects for this branch
 /// See TVirtualBranchBrowsable::FillListOfBrowsables.
@@ -2282,6 +2364,7 @@ bool TBranch::IsFolder() const
 
 void TBranch::KeepCircular(Long64_t maxEntries)
 {
+   WaitPendingBasket();
    Int_t dentries = (Int_t) (fEntries - maxEntries);
    TBasket* basket = (TBasket*) fBaskets.UncheckedAt(0);
    if (basket) basket->MoveEntries(dentries);
@@ -2533,6 +2616,16 @@ void TBranch::Refresh(TBranch* b)
       fBasketEntry[i] = b->fBasketEntry[i];
       fBasketSeek[i]  = b->fBasketSeek[i];
    }
+   delete [] fBasketMin;
+   delete [] fBasketMax;
+   fBasketMin = nullptr;
+   fBasketMax = nullptr;
+   if (b->fBasketMin) {
+      fBasketMin = new Double_t[fMaxBaskets];
+      fBasketMax = new Double_t[fMaxBaskets];
+      std::copy(b->fBasketMin, b->fBasketMin + fMaxBaskets, fBasketMin);
+      std::copy(b->fBasketMax, b->fBasketMax + fMaxBaskets, fBasketMax);
+   }
    fBaskets.Delete();
    Int_t nbaskets = b->fBaskets.GetSize();
    fBaskets.Expand(nbaskets);
@@ -2556,6 +2649,7 @@ void TBranch::Refresh(TBranch* b)
 
 void TBranch::Reset(Option_t*)
 {
+   WaitPendingBasket();
    fReadBasket = 0;
    fReadEntry = -1;
    fFirstBasketEntry = -1;
@@ -2597,6 +2691,8 @@ void TBranch::Reset(Option_t*)
 
 void TBranch::ResetAfterMerge(TFileMergeInfo *)
 {
+   WaitPendingBasket();
+   DropPreparedBaskets();
    fReadBasket       = 0;
    fReadEntry        = -1;
    fFirstBasketEntry = -1;
@@ -2722,6 +2818,41 @@ void TBranch::SetAutoDelete(bool autodel)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Enable or disable per-basket statistics for this branch.
+///
+/// When enabled, the smallest and largest value filled into each basket are
+/// recorded and stored with the branch metadata. TTreeFormula uses them to
+/// skip whole baskets that cannot satisfy a simple selection such as
+/// `x > 10 && run == 42`, without reading them.
+///
+/// Statistics are only supported for branches of class TBranch holding a
+/// single numerical leaf (scalar or array); returns false otherwise.
+/// Baskets filled before the statistics were enabled are considered to
+/// contain any value.
+
+bool TBranch::SetBasketStats(bool enable)
+{
+   if (!enable) {
+      delete [] fBasketMin;
+      delete [] fBasketMax;
+      fBasketMin = nullptr;
+      fBasketMax = nullptr;
+      return true;
+   }
+   if (fBasketMin)
+      return true;
+   if (IsA() != TBranch::Class() || fNleaves != 1 || fLeaves.UncheckedAt(0)->InheritsFrom(TLeafC::Class()))
+      return false;
+
+   WaitPendingBasket();
+   fBasketMin = new Double_t[fMaxBaskets];
+   fBasketMax = new Double_t[fMaxBaskets];
+   std::fill(fBasketMin, fBasketMin + fMaxBaskets, -std::numeric_limits<Double_t>::infinity());
+   std::fill(fBasketMax, fBasketMax + fMaxBaskets, std::numeric_limits<Double_t>::infinity());
+   return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the basket size
 /// The function makes sure that the basket size is greater than fEntryOffsetlen
@@ -3167,6 +3298,9 @@ void TBranch::Streamer(TBuffer& b)
          }
       }
    } else {
+      // The basket table must be final before being streamed.
+      WaitPendingBasket();
+
       Int_t maxBaskets = fMaxBaskets;
       fMaxBaskets = fWriteBasket+1;
       Int_t lastBasket = fMaxBaskets;
@@ -3196,12 +3330,30 @@ void TBranch::Streamer(TBuffer& b)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Write the current basket to disk and return the number of bytes
-/// written to the file.
+/// Fold the values just filled into the statistics of basket `where`,
+/// which now holds `nevbuf` entries.
 
-Int_t TBranch::WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBranchIMTHelper *imtHelper)
+void TBranch::FillBasketStats(Int_t where, Int_t nevbuf)
+{
+   if (nevbuf == 1) {
+      fBasketMin[where] = std::numeric_limits<Double_t>::infinity();
+      fBasketMax[where] = -std::numeric_limits<Double_t>::infinity();
+   }
+   TLeaf *leaf = (TLeaf*)fLeaves.UncheckedAt(0);
+   const Int_t len = leaf->GetLen();
+   for (Int_t i = 0; i < len; ++i) {
+      const Double_t value = leaf->GetValue(i);
+      if (value < fBasketMin[where]) fBasketMin[where] = value;
+      if (value > fBasketMax[where]) fBasketMax[where] = value;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Adapt the length of the entry offset table of the next baskets to the
+/// number of entries `nevbuf` held by the basket about to be written.
+
+void TBranch::AdjustEntryOffsetLen(Int_t nevbuf)
 {
-   Int_t nevbuf = basket->GetNevBuf();
    if (fEntryOffsetLen > 10 &&  (4*nevbuf) < fEntryOffsetLen ) {
       // Make sure that the fEntryOffset array does not stay large unnecessarily.
       fEntryOffsetLen = nevbuf < 3 ? 10 : 4*nevbuf; // assume some fluctuations.
@@ -3209,6 +3361,15 @@ Int_t TBranch::WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBr
       // Increase the array ...
       fEntryOffsetLen = 2*nevbuf; // assume some fluctuations.
    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write the current basket to disk and return the number of bytes
+/// written to the file.
+
+Int_t TBranch::WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBranchIMTHelper *imtHelper)
+{
+   AdjustEntryOffsetLen(basket->GetNevBuf());
 
    // Note: captures `basket`, `where`, and `this` by value; modifies the TBranch and basket,
    // as we make a copy of the pointer.  We cannot capture `basket` by reference as the pointer
@@ -3273,6 +3434,158 @@ Int_t TBranch::WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBr
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Hand the full write basket over to a background task which compresses
+/// it, and return immediately (write-behind mode, see TTree::SetWriteBehind).
+///
+/// The basket is detached from the branch right away, so that the filling
+/// can continue in a new basket. At most one basket per branch is in flight:
+/// the previous one is waited for here, and written to the file by
+/// WaitPendingBasket on the calling thread, so that the file is only ever
+/// modified by the thread filling the tree.
+/// Returns 0 (the bytes are accounted for when the write completes).
+
+Int_t TBranch::WriteBasketBehind(TBasket* basket)
+{
+#ifdef R__USE_IMT
+   TFile *file = GetFile(1);
+   if (!file || !file->IsWritable()) {
+      WaitPendingBasket();
+      return WriteBasket(basket, fWriteBasket);
+   }
+
+   AdjustEntryOffsetLen(basket->GetNevBuf());
+
+   const Int_t where = fWriteBasket;
+   fBaskets[where] = nullptr;
+   if (basket == fCurrentBasket) {
+      fCurrentBasket    = nullptr;
+      fFirstBasketEntry = -1;
+      fNextBasketEntry  = -1;
+   }
+   ++fWriteBasket;
+   if (fWriteBasket >= fMaxBaskets) {
+      ExpandBasketArrays();
+   }
+   fBasketEntry[fWriteBasket] = fEntryNumber;
+
+   // The previous basket shares the branch's compression buffer with this one,
+   // and can be reused for the next fills once it is on file.
+   WaitPendingBasket();
+
+   fPendingBasket = basket;
+   fPendingWhere = where;
+   fPendingTask = new ROOT::Internal::TBranchIMTHelper();
+   basket->SetWriteCycle(where);
+   fPendingTask->Run([basket, file]() { return basket->CompressBuffer(file); });
+   return 0;
+#else
+   return WriteBasket(basket, fWriteBasket);
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Wait for the compression of the basket handed over by WriteBasketBehind
+/// (if any), write it to the file and record its location and size on file,
+/// as WriteBasketImpl does for synchronous writes.
+
+void TBranch::WaitPendingBasket()
+{
+#ifdef R__USE_IMT
+   if (!fPendingBasket)
+      return;
+
+   fPendingTask->Wait();
+   Int_t nout = fPendingTask->GetNerrors() ? -1 : fPendingTask->GetNbytes();
+   delete fPendingTask;
+   fPendingTask = nullptr;
+
+   TBasket *basket = fPendingBasket;
+   const Int_t where = fPendingWhere;
+   fPendingBasket = nullptr;
+   fPendingWhere = -1;
+
+   TFile *file = GetFile(1);
+   if (nout >= 0 && file)
+      nout = basket->WriteCompressedBuffer(file, nout);
+   else
+      nout = -1;
+   if (nout < 0)
+      Error("WriteBasketBehind", "basket's WriteBuffer failed.");
+   fBasketBytes[where] = basket->GetNbytes();
+   fBasketSeek[where]  = basket->GetSeekKey();
+   if (nout > 0) {
+      Int_t addbytes = basket->GetObjlen() + basket->GetKeylen();
+      fZipBytes += nout;
+      fTotBytes += addbytes;
+      fTree->AddTotBytes(addbytes);
+      fTree->AddZipBytes(nout);
+
+      if (!fBaskets.UncheckedAt(fWriteBasket)) {
+         // Reuse the basket for the next entries, as the synchronous write does.
+         basket->WriteReset();
+#ifdef R__TRACK_BASKET_ALLOC_TIME
+         fTree->AddAllocationTime(basket->GetResetAllocationTime());
+#endif
+         fTree->AddAllocationCount(basket->GetResetAllocationCount());
+         fBaskets.AddAtAndExpand(basket, fWriteBasket);
+      } else {
+         --fNBaskets;
+         basket->DropBuffers();
+         delete basket;
+      }
+   } else {
+      // Nothing was written (e.g. no file): keep the basket in memory.
+      fBaskets.AddAtAndExpand(basket, where);
+   }
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Load the records (key and compressed data) of the baskets of this branch
+/// and of its sub-branches written to the file, without unzipping them, so
+/// that TTreeCloner only has to relocate and append them to the output file.
+///
+/// This is called by TTree::Write(kOnlyPrepStep) on the thread filling the
+/// tree, e.g. a TBufferMerger worker, before handing the tree over to the
+/// thread merging it. Baskets which fail to load are left to TTreeCloner.
+
+void TBranch::PrepareBaskets()
+{
+   DropPreparedBaskets();
+   Int_t nb = fBranches.GetEntriesFast();
+   for (Int_t i = 0; i < nb; ++i) {
+      TBranch *branch = (TBranch*)fBranches.UncheckedAt(i);
+      branch->PrepareBaskets();
+   }
+
+   TFile *file = GetFile(0);
+   if (!file || !fBasketSeek || !fBasketBytes)
+      return;
+
+   fPreparedBaskets.resize(fWriteBasket, nullptr);
+   for (Int_t i = 0; i < fWriteBasket; ++i) {
+      if (!fBasketSeek[i] || !fBasketBytes[i])
+         continue;
+      TBasket *basket = new TBasket();
+      if (basket->LoadBasketBuffers(fBasketSeek[i], fBasketBytes[i], file, fTree)) {
+         delete basket;
+         continue;
+      }
+      fPreparedBaskets[i] = basket;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Delete the baskets loaded by PrepareBaskets and not used by TTreeCloner.
+
+void TBranch::DropPreparedBaskets()
+{
+   for (TBasket *basket : fPreparedBaskets)
+      delete basket;
+   fPreparedBaskets.clear();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///set the first entry number (case of TBranchSTL)
 
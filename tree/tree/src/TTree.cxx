@@ -4600,6 +4600,18 @@ void TTree::DropBuffers(Int_t)
 /// \note This method calls `TTree::ChangeFile` when the tree reaches a size
 ///       greater than `TTree::fgMaxTreeSize`. This doesn't happen if the tree is
 ///       attached to a `TMemFile` or derivate.
+///
+/// __Write-behind mode__
+///
+/// When implicit multi-threading is enabled and SetWriteBehind() was called,
+/// a full basket is not compressed within Fill: it is handed to a task of the
+/// implicit MT pool and Fill returns right away, continuing in a fresh basket.
+/// At most one basket per branch is in flight; it is written to the file at
+/// the next basket switch of the branch, by FlushBaskets, AutoSave and Write,
+/// or when the branch is read back. Only the compression runs in the
+/// background: the file itself is only modified by the thread calling Fill.
+/// The bytes of a basket in flight are not yet accounted in the value
+/// returned by Fill nor in GetZipBytes().
 
 Int_t TTree::Fill()
 {
@@ -4636,7 +4648,8 @@ Int_t TTree::Fill()
 #ifndef R__USE_IMT
       nwrite = branch->FillImpl(nullptr);
 #else
-      nwrite = branch->FillImpl(useIMT ? &imtHelper : nullptr);
+      // In write-behind mode, the branches hand their full baskets to their own tasks.
+      nwrite = branch->FillImpl(useIMT && !fWriteBehind ? &imtHelper : nullptr);
 #endif
       if (nwrite < 0) {
          if (nerror < 2) {
@@ -6939,7 +6952,13 @@ Long64_t TTree::Merge(TCollection* li, TFileMergeInfo *info)
       } else {
          TDirectory::TContext ctxt(info->fOutputDirectory);
          TIOFeatures saved_features = fIOFeatures;
-         TTree *newtree = CloneTree(-1, options);
+         // Same as CloneTree(-1, options), with the baskets compressed behind the copy.
+         TTree *newtree = CloneTree(0, options);
+         if (newtree) {
+            newtree->SetWriteBehind();
+            newtree->CopyEntries(this, -1, options, false);
+            newtree->SetWriteBehind(false);
+         }
          if (info->fIOFeatures)
             fIOFeatures = *(info->fIOFeatures);
          else
@@ -6960,6 +6979,11 @@ Long64_t TTree::Merge(TCollection* li, TFileMergeInfo *info)
    // Also since this is part of a merging operation, the output file is not as precious as in
    // the general case since the input file should still be around.
    fAutoSave = 0;
+   // Unless the baskets are copied as they are ("fast"), they are recompressed: compress
+   // the full baskets in the background (with implicit MT) while the next entries are read.
+   const bool storeWriteBehind = fWriteBehind;
+   if (!TString(options).Contains("fast"))
+      SetWriteBehind();
    TIter next(li);
    TTree *tree;
    while ((tree = (TTree*)next())) {
@@ -6967,12 +6991,14 @@ Long64_t TTree::Merge(TCollection* li, TFileMergeInfo *info)
       if (!tree->InheritsFrom(TTree::Class())) {
          Error("Add","Attempt to add object of class: %s to a %s", tree->ClassName(), ClassName());
          fAutoSave = storeAutoSave;
+         SetWriteBehind(storeWriteBehind);
          return -1;
       }
 
       CopyEntries(tree, -1, options, true);
    }
    fAutoSave = storeAutoSave;
+   SetWriteBehind(storeWriteBehind);
    return GetEntries();
 }
 
@@ -8345,6 +8371,45 @@ void TTree::SetAutoSave(Long64_t autos)
    fAutoSave = autos;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Enable or disable per-basket statistics for branches.
+///
+/// bname is the name of a branch.
+///
+/// - if bname="*", apply to all branches.
+/// - if bname="xxx*", apply to all branches with name starting with xxx
+///
+/// see TRegexp for wildcarding options.
+/// With basket statistics, the smallest and largest value filled into each
+/// basket of a branch are stored with the tree. TTree::Draw and CopyTree
+/// then skip the baskets that cannot satisfy a selection made of simple
+/// comparisons with constants, e.g. `run == 42 && pt > 20`; see
+/// TBranch::SetBasketStats for the branches supporting statistics.
+/// Returns the number of branches whose setting was changed.
+
+Int_t TTree::SetBasketStats(const char* bname, bool enable)
+{
+   Int_t nleaves = fLeaves.GetEntriesFast();
+   TRegexp re(bname, true);
+   Int_t nb = 0;
+   Int_t nset = 0;
+   for (Int_t i = 0; i < nleaves; i++)  {
+      TLeaf* leaf = (TLeaf*) fLeaves.UncheckedAt(i);
+      TBranch* branch = (TBranch*) leaf->GetBranch();
+      TString s = branch->GetName();
+      if (strcmp(bname, branch->GetName()) && (s.Index(re) == kNPOS)) {
+         continue;
+      }
+      nb++;
+      if (branch->HasBasketStats() != enable && branch->SetBasketStats(enable))
+         nset++;
+   }
+   if (!nb) {
+      Error("SetBasketStats", "unknown branch -> '%s'", bname);
+   }
+   return nset;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set a branch's basket size.
 ///
@@ -9738,12 +9803,23 @@ void TTree::UseCurrentStyle()
 ////////////////////////////////////////////////////////////////////////////////
 /// Write this object to the current directory. For more see TObject::Write
 /// If option & kFlushBasket, call FlushBasket before writing the tree.
+/// If option & kOnlyPrepStep (see TBufferMerger), only flush the baskets and
+/// load their records back, so that the thread merging the tree only has to
+/// relocate and append them (see TTreeCloner).
 
 Int_t TTree::Write(const char *name, Int_t option, Int_t bufsize) const
 {
    FlushBasketsImpl();
-   if (R__unlikely(option & kOnlyPrepStep))
+   if (R__unlikely(option & kOnlyPrepStep)) {
+      Int_t nb = fBranches.GetEntriesFast();
+      for (Int_t i = 0; i < nb; ++i) {
+         TBranch *branch = (TBranch*)fBranches.UncheckedAt(i);
+         branch->PrepareBaskets();
+      }
+      if (fBranchRef)
+         fBranchRef->PrepareBaskets();
       return 0;
+   }
    return TObject::Write(name, option, bufsize);
 }
 
@@ -15,6 +15,7 @@
 Class implementing or helping  the various TTree cloning method
 */
 
+#include "TArrayC.h"
 #include "TBasket.h"
 #include "TBranch.h"
 #include "TBranchClones.h"
@@ -128,6 +129,7 @@ TTreeCloner::TTreeCloner(TTree *from, TTree *to, TDirectory *newdirectory, Optio
    fWarningMsg(),
    fIsValid(true),
    fNeedConversion(false),
+   fPrepared(false),
    fOptions(options),
    fFromTree(from),
    fToTree(to),
@@ -346,6 +348,8 @@ UInt_t TTreeCloner::CollectBranches(TBranch *from, TBranch *to) {
    }
 
    fFromBranches.AddLast(from);
+   if (!from->fPreparedBaskets.empty())
+      fPrepared = true;
    if (!from->TestBit(TBranch::kDoNotUseBufferMap)) {
       // Make sure that we reset the Buffer's map if needed.
       to->ResetBit(TBranch::kDoNotUseBufferMap);
@@ -473,6 +477,22 @@ void TTreeCloner::CopyStreamerInfos()
 {
    TFile *fromFile = fFromTree->GetDirectory()->GetFile();
    TFile *toFile = fToDirectory->GetFile();
+   if (fPrepared) {
+      // The source file is being written (see TBranch::PrepareBaskets): rather than
+      // reading back its StreamerInfo record, mark the same StreamerInfos as used
+      // in the output file.
+      TArrayC *fromIndex = fromFile->GetClassIndex();
+      TArrayC *toIndex = toFile->GetClassIndex();
+      if (fromIndex && toIndex && fromIndex->GetSize() <= toIndex->GetSize()) {
+         for (Int_t uid = 1; uid < fromIndex->GetSize(); ++uid) {
+            if (fromIndex->fArray[uid] && !toIndex->fArray[uid]) {
+               toIndex->fArray[0] = 1;
+               toIndex->fArray[uid] = 1;
+            }
+         }
+         return;
+      }
+   }
    TList *l = fromFile->GetStreamerInfoList();
    TIter next(l);
    TStreamerInfo *oldInfo;
@@ -595,7 +615,8 @@ void TTreeCloner::CopyProcessIds()
 
 void TTreeCloner::CreateCache()
 {
-   if (fCacheSize && fFromTree->GetCurrentFile()) {
+   // The prepared baskets are not read again.
+   if (fCacheSize && !fPrepared && fFromTree->GetCurrentFile()) {
       TFile *f = fFromTree->GetCurrentFile();
       auto prev = fFromTree->GetReadCache(f);
       if (fFileCache && prev == fFileCache) {
@@ -755,6 +776,14 @@ void TTreeCloner::WriteBaskets()
             basket->CopyTo(tofile);
             to->fBasketSeek[index] = basket->GetSeekKey();
          }
+      } else if (pos != 0 && index < (Int_t)from->fPreparedBaskets.size() && from->fPreparedBaskets[index]) {
+         // Already loaded by the thread that filled the source tree: only relocate and append it.
+         TBasket *prepared = from->fPreparedBaskets[index];
+         from->fPreparedBaskets[index] = nullptr;
+         prepared->IncrementPidOffset(fPidOffset);
+         prepared->CopyTo(tofile);
+         to->AddBasket(*prepared, true, fToStartEntries + from->GetBasketEntry()[index]);
+         delete prepared;
       } else if (pos!=0) {
          if (fFileCache && j >= notCached) {
             notCached = FillCache(notCached);
@@ -1,11 +1,14 @@
 #include "TChain.h"
 #include "TFile.h"
+#include "TNamed.h"
 #include "TROOT.h"
 #include "TSystem.h"
 #include "TTree.h"
 
 #include "gtest/gtest.h"
 
+#include <string>
+
 #ifdef R__USE_IMT
 
 // ROOT-9668
@@ -29,6 +32,56 @@ TEST(TTreeImplicitMT, flushBaskets)
    gSystem->Unlink(ofileName);
 }
 
+TEST(TTreeImplicitMT, writeBehind)
+{
+   ROOT::EnableImplicitMT(2);
+   const auto ofileName = "writeBehindMT.root";
+   constexpr int nEntries = 100000;
+   {
+      TFile f(ofileName, "RECREATE");
+      TTree t("t", "t");
+      t.SetWriteBehind();
+      EXPECT_TRUE(t.GetWriteBehind());
+      int i = 0;
+      double x = 0.;
+      // Small baskets, so that many of them are written behind the fill.
+      t.Branch("i", &i, 1000);
+      t.Branch("x", &x, 1000);
+      for (; i < nEntries; ++i) {
+         x = 0.5 * i;
+         t.Fill();
+         // Other objects can be written while baskets are in flight.
+         if (i % 10000 == 0) {
+            TNamed named("n", std::to_string(i).c_str());
+            f.WriteObject(&named, ("n" + std::to_string(i)).c_str());
+         }
+      }
+      t.Write();
+   }
+
+   TFile f(ofileName);
+   auto t = f.Get<TTree>("t");
+   ASSERT_NE(t, nullptr);
+   EXPECT_EQ(t->GetEntries(), nEntries);
+   EXPECT_GT(t->GetBranch("x")->GetWriteBasket(), 10);
+   int i = -1;
+   double x = -1.;
+   t->SetBranchAddress("i", &i);
+   t->SetBranchAddress("x", &x);
+   for (Long64_t entry = 0; entry < nEntries; ++entry) {
+      t->GetEntry(entry);
+      EXPECT_EQ(i, entry);
+      EXPECT_EQ(x, 0.5 * entry);
+   }
+   t->ResetBranchAddresses();
+   for (int n = 0; n < nEntries; n += 10000) {
+      auto named = f.Get<TNamed>(("n" + std::to_string(n)).c_str());
+      ASSERT_NE(named, nullptr);
+      EXPECT_STREQ(named->GetTitle(), std::to_string(n).c_str());
+   }
+   gSystem->Unlink(ofileName);
+}
+
 //# 8720
 TEST(TChainImplicitMT, propagateToTTree)
 {
@@ -2,9 +2,13 @@
 #include "TTree.h"
 #include "TBranch.h"
 #include "TRandom.h"
+#include "TROOT.h"
+#include "TSystem.h"
 
 #include "gtest/gtest.h"
 
+#include <memory>
+
 class TBranchTest : public ::testing::Test {
 protected:
    void SetUp() override
@@ -229,4 +233,65 @@ TEST_F(TBranchTest, branchInheritsCompression)
 {
    for(int mode = 4; mode >= 0; --mode)
       ASSERT_TRUE(nocomp(mode)) << "Failed for mode: " << mode;
-}
\ No newline at end of file
+}
+
+TEST(TBranch, basketStats)
+{
+   const auto filename = "TBranchBasketStats.root";
+   {
+      TFile file(filename, "RECREATE");
+      TTree tree("tree", "basket statistics");
+      Int_t run = 0;
+      Float_t x = 0;
+      Int_t n = 0;
+      Float_t arr[10];
+      tree.Branch("run", &run);
+      tree.Branch("x", &x);
+      tree.Branch("n", &n);
+      tree.Branch("arr", arr, "arr[n]/F");
+      tree.SetBasketSize("*", 1000);
+      EXPECT_EQ(tree.SetBasketStats("run"), 1);
+      EXPECT_EQ(tree.SetBasketStats("arr"), 1);
+      for (Int_t i = 0; i < 10000; ++i) {
+         run = i / 100;
+         x = i % 7;
+         n = i % 4;
+         for (Int_t j = 0; j < n; ++j)
+            arr[j] = run + j;
+         tree.Fill();
+      }
+      file.Write();
+   }
+
+   TFile file(filename);
+   auto tree = file.Get<TTree>("tree");
+   ASSERT_NE(tree, nullptr);
+   TBranch *run = tree->GetBranch("run");
+   ASSERT_TRUE(run->HasBasketStats());
+   EXPECT_TRUE(tree->GetBranch("arr")->HasBasketStats());
+   EXPECT_FALSE(tree->GetBranch("x")->HasBasketStats());
+   ASSERT_GT(run->GetWriteBasket(), 10);
+   for (Int_t b = 0; b < run->GetWriteBasket(); ++b) {
+      Double_t min, max;
+      ASSERT_TRUE(run->GetBasketStats(b, min, max));
+      EXPECT_EQ(min, run->GetBasketEntry()[b] / 100);
+      EXPECT_EQ(max, (run->GetBasketEntry()[b + 1] - 1) / 100);
+   }
+
+   // Selections on branches with statistics give the same result, reading fewer baskets.
+   tree->SetCacheSize(0);
+   Long64_t before = file.GetBytesRead();
+   EXPECT_EQ(tree->Draw("x", "run == 42 && x < 3", "goff"), 44);
+   const Long64_t pruned = file.GetBytesRead() - before;
+   before = file.GetBytesRead();
+   EXPECT_EQ(tree->Draw("x", "run + 0 == 42 && x < 3", "goff"), 44);
+   const Long64_t unpruned = file.GetBytesRead() - before;
+   EXPECT_LT(pruned * 10, unpruned);
+
+   EXPECT_EQ(tree->Draw("arr", "arr > 97.5", "goff"), tree->Draw("arr", "arr + 0 > 97.5", "goff"));
+   gROOT->cd();
+   std::unique_ptr<TTree> copy{tree->CopyTree("(run >= 90) && 95 > run")};
+   EXPECT_EQ(copy->GetEntries(), 500);
+
+   gSystem->Unlink(filename);
+}
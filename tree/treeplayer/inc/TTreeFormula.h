@@ -50,6 +50,7 @@ class TDataMember;
 class TStreamerElement;
 class TFormLeafInfoMultiVarDim;
 class TFormLeafInfo;
+class TBranch;
 class TBranchElement;
 class TAxis;
 class TTreeFormulaManager;
@@ -131,6 +132,21 @@ protected:
 
    RealInstanceCache fRealInstanceCache;              ///<! Cache accelerating the GetRealInstance function
 
+   // Helper struct describing a top-level `leaf <op> constant` term of the
+   // formula, used to skip entries based on the branches' basket statistics.
+   struct PruneTerm {
+      std::string fLeafName;
+      Int_t       fOp = 0;     ///< One of '<', 'l' (<=), '>', 'g' (>=), '='
+      Double_t    fValue = 0;
+      TBranch    *fBranch = nullptr;
+   };
+
+   std::vector<PruneTerm> fPruneTerms;                ///<! Terms usable with basket statistics in the current tree
+   bool                   fPruneInit = false;         ///<! True if fPruneTerms is set up for the current tree
+   bool                   fPruneSkip = false;         ///<! Result of CanSkipEntry for [fPruneFirst, fPruneLast)
+   Long64_t               fPruneFirst = -1;           ///<! First entry of the cached CanSkipEntry result
+   Long64_t               fPruneLast = -1;            ///<! One past the last entry of the cached CanSkipEntry result
+
    TTreeFormula(const char *name, const char *formula, TTree *tree, const std::vector<std::string>& aliases);
    void Init(const char *name, const char *formula);
    bool        BranchHasMethod(TLeaf* leaf, TBranch* branch, const char* method,const char* params, Long64_t readentry) const;
@@ -149,6 +165,7 @@ protected:
    virtual void*     GetValuePointerFromMethod(Int_t i, TLeaf *leaf) const;
    Int_t             GetRealInstance(Int_t instance, Int_t codeindex);
 
+   void              InitPruneTerms();
    void              LoadBranches();
    bool              LoadCurrentDim();
    void              ResetDimensions();
@@ -174,6 +191,7 @@ public:
    TTreeFormula(const char *name,const char *formula, TTree *tree);
      ~TTreeFormula() override;
 
+           bool        CanSkipEntry(Long64_t entry);
    Int_t       DefinedVariable(TString &variable, Int_t &action) override;
    virtual TClass*     EvalClass() const;
 
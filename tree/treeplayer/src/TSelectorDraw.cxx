@@ -1168,6 +1168,10 @@ bool TSelectorDraw::Notify()
 
 void TSelectorDraw::ProcessFill(Long64_t entry)
 {
+   // Skip entries whose baskets cannot pass the selection, see TTreeFormula::CanSkipEntry.
+   if (fSelect && fSelect->CanSkipEntry(entry))
+      return;
+
    if (fObjEval) {
       ProcessFillObject(entry);
       return;
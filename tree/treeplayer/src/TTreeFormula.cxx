@@ -51,6 +51,7 @@
 #include <cstdlib>
 #include <typeinfo>
 #include <algorithm>
+#include <limits>
 
 const Int_t kMaxLen     = 2048;
 
@@ -5101,6 +5102,204 @@ bool TTreeFormula::StringToNumber(Int_t oper)
 }
 
 
+namespace {
+
+/// Split `expr` at the `&&` operators found outside of parentheses, brackets and
+/// string literals. Returns false if `expr` has a top-level operator binding less
+/// tightly than `&&`, in which case the pieces are not conjuncts.
+bool SplitConjunction(const TString &expr, std::vector<TString> &terms)
+{
+   Int_t depth = 0;
+   Ssiz_t start = 0;
+   bool inString = false;
+   const Ssiz_t len = expr.Length();
+   for (Ssiz_t i = 0; i < len; ++i) {
+      const char c = expr[i];
+      if (c == '"') {
+         inString = !inString;
+      } else if (inString) {
+         continue;
+      } else if (c == '(' || c == '[') {
+         ++depth;
+      } else if (c == ')' || c == ']') {
+         --depth;
+      } else if (depth == 0) {
+         const char next = i + 1 < len ? expr[i + 1] : 0;
+         if ((c == '|' && next == '|') || c == '?')
+            return false;
+         if (c == '&' && next == '&') {
+            terms.push_back(expr(start, i - start));
+            start = i + 2;
+            ++i;
+         }
+      }
+   }
+   terms.push_back(expr(start, len - start));
+   return depth == 0 && !inString;
+}
+
+/// Return true if `term` is entirely wrapped in one pair of parentheses.
+bool IsParenthesized(const TString &term)
+{
+   if (term.Length() < 2 || term[0] != '(' || term[term.Length() - 1] != ')')
+      return false;
+   Int_t depth = 0;
+   for (Ssiz_t i = 0; i < term.Length() - 1; ++i) {
+      if (term[i] == '(') ++depth;
+      else if (term[i] == ')' && --depth == 0) return false;
+   }
+   return true;
+}
+
+/// Return true if `str` is a number, storing it in `value`.
+bool ParseNumber(const TString &str, Double_t &value)
+{
+   if (str.IsNull())
+      return false;
+   char *end = nullptr;
+   value = std::strtod(str.Data(), &end);
+   return end && *end == 0;
+}
+
+/// Return true if `str` can name a leaf.
+bool IsLeafName(const TString &str)
+{
+   if (str.IsNull() || !(std::isalpha(str[0]) || str[0] == '_'))
+      return false;
+   for (Ssiz_t i = 1; i < str.Length(); ++i) {
+      if (!(std::isalnum(str[i]) || str[i] == '_' || str[i] == '.'))
+         return false;
+   }
+   return true;
+}
+
+/// Return true if some value in [min, max] may satisfy `value <op> constant`.
+bool MayPass(Int_t op, Double_t constant, Double_t min, Double_t max)
+{
+   switch (op) {
+      case '<': return min < constant;
+      case 'l': return min <= constant;
+      case '>': return max > constant;
+      case 'g': return max >= constant;
+      case '=': return min <= constant && constant <= max;
+   }
+   return true;
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Collect the terms of the formula that CanSkipEntry can use for the current
+/// tree: comparisons of a leaf with a constant, combined with `&&`, where the
+/// leaf's branch belongs to the tree itself, not to a friend, and keeps basket
+/// statistics (see TBranch::SetBasketStats).
+
+void TTreeFormula::InitPruneTerms()
+{
+   fPruneInit = true;
+   fPruneFirst = fPruneLast = -1;
+   fPruneTerms.clear();
+   if (!fTree)
+      return;
+
+   std::vector<TString> terms;
+   if (!SplitConjunction(GetTitle(), terms)) {
+      // The top-level pieces are not conjuncts.
+      return;
+   }
+   while (!terms.empty()) {
+      TString term = terms.back();
+      terms.pop_back();
+      term = term.Strip(TString::kBoth);
+      if (IsParenthesized(term)) {
+         std::vector<TString> inner;
+         if (SplitConjunction(term(1, term.Length() - 2), inner))
+            terms.insert(terms.end(), inner.begin(), inner.end());
+         continue;
+      }
+
+      // Find the single comparison operator of the term.
+      static const struct { const char *fText; Int_t fOp; Int_t fMirror; } ops[] = {
+         {"<=", 'l', 'g'}, {">=", 'g', 'l'}, {"==", '=', '='}, {"<", '<', '>'}, {">", '>', '<'}};
+      for (const auto &op : ops) {
+         const Ssiz_t where = term.Index(op.fText);
+         if (where == kNPOS)
+            continue;
+         TString lhs = TString(term(0, where)).Strip(TString::kBoth);
+         TString rhs = TString(term(where + strlen(op.fText), term.Length())).Strip(TString::kBoth);
+         PruneTerm pruneTerm;
+         if (IsLeafName(lhs) && ParseNumber(rhs, pruneTerm.fValue)) {
+            pruneTerm.fLeafName = lhs.Data();
+            pruneTerm.fOp = op.fOp;
+         } else if (IsLeafName(rhs) && ParseNumber(lhs, pruneTerm.fValue)) {
+            pruneTerm.fLeafName = rhs.Data();
+            pruneTerm.fOp = op.fMirror;
+         } else {
+            break;
+         }
+         TLeaf *leaf = fTree->GetLeaf(pruneTerm.fLeafName.c_str());
+         // The leaf can be found in a friend tree, whose entry numbers differ
+         // from the ones of the tree (TTree::BuildIndex, friend chains): only
+         // the baskets of the tree itself can be looked up by entry.
+         if (leaf && leaf->GetBranch() && leaf->GetBranch()->GetTree() == fTree->GetTree() &&
+             leaf->GetBranch()->HasBasketStats()) {
+            pruneTerm.fBranch = leaf->GetBranch();
+            fPruneTerms.push_back(pruneTerm);
+         }
+         break;
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if the formula is known to evaluate to zero for all instances
+/// of the given entry of the current tree, without reading the entry.
+///
+/// This uses the per-basket statistics kept by branches on which
+/// TBranch::SetBasketStats was called: if the formula is a conjunction
+/// (`&&`) of terms and one of the terms compares such a branch with a
+/// constant that none of the values in the basket holding the entry can
+/// satisfy, the whole basket can be skipped. The answer is cached for the
+/// range of entries it holds for, so that consecutive calls are cheap.
+
+bool TTreeFormula::CanSkipEntry(Long64_t entry)
+{
+   if (!fPruneInit)
+      InitPruneTerms();
+   if (fPruneTerms.empty())
+      return false;
+   if (entry >= fPruneFirst && entry < fPruneLast)
+      return fPruneSkip;
+
+   Long64_t first = 0;
+   Long64_t last = std::numeric_limits<Long64_t>::max();
+   for (const auto &term : fPruneTerms) {
+      TBranch *branch = term.fBranch;
+      if (entry < 0 || entry >= branch->GetEntries())
+         return false;
+      const Int_t nbaskets = branch->GetWriteBasket();
+      const Long64_t *basketEntry = branch->GetBasketEntry();
+      const Int_t basket = TMath::BinarySearch(nbaskets + 1, basketEntry, entry);
+      const Long64_t basketFirst = basketEntry[basket];
+      const Long64_t basketLast = basket < nbaskets ? basketEntry[basket + 1] : branch->GetEntries();
+      Double_t min, max;
+      if (!branch->GetBasketStats(basket, min, max))
+         return false;
+      if (!MayPass(term.fOp, term.fValue, min, max)) {
+         fPruneFirst = basketFirst;
+         fPruneLast = basketLast;
+         fPruneSkip = true;
+         return true;
+      }
+      first = std::max(first, basketFirst);
+      last = std::min(last, basketLast);
+   }
+   fPruneFirst = first;
+   fPruneLast = last;
+   fPruneSkip = false;
+   return false;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// This function is called TTreePlayer::UpdateFormulaLeaves, itself
 /// called by TChain::LoadTree when a new Tree is loaded.
@@ -5112,6 +5311,7 @@ bool TTreeFormula::StringToNumber(Int_t oper)
 
 void TTreeFormula::UpdateFormulaLeaves()
 {
+   fPruneInit = false;
    Int_t nleaves = fLeafNames.GetEntriesFast();
    ResetBit( kMissingLeaf );
    for (Int_t i=0;i<nleaves;i++) {
@@ -239,6 +239,7 @@ TTree *TTreePlayer::CopyTree(const char *selection, Option_t *, Long64_t nentrie
          if (select) select->UpdateFormulaLeaves();
       }
       if (select) {
+         if (select->CanSkipEntry(localEntry)) continue;
          Int_t ndata = select->GetNdata();
          bool keep = false;
          for(Int_t current = 0; current<ndata && !keep; current++) {
@@ -0,0 +1,58 @@
+#include "TFile.h"
+#include "TROOT.h"
+#include "TSystem.h"
+#include "TTree.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+// The basket statistics of a friend tree can't be used to skip entries of the
+// main tree: with an index, the friend's entries are in a different order.
+TEST(TTreeFormulaBasketStats, IndexedFriend)
+{
+   const auto filename = "basketstats_indexedfriend.root";
+   constexpr Int_t nEntries = 10000;
+   {
+      TFile file(filename, "RECREATE");
+      TTree main("main", "main");
+      Int_t idx = 0;
+      main.Branch("idx", &idx);
+      for (idx = 0; idx < nEntries; ++idx)
+         main.Fill();
+
+      // The friend is filled in reverse order, and matched by the index on idx.
+      TTree fr("fr", "fr");
+      Int_t fidx = 0;
+      Int_t run = 0;
+      fr.Branch("idx", &fidx);
+      fr.Branch("run", &run);
+      fr.SetBasketSize("*", 1000);
+      EXPECT_EQ(fr.SetBasketStats("run"), 1);
+      for (Int_t i = 0; i < nEntries; ++i) {
+         fidx = nEntries - 1 - i;
+         run = fidx / 100;
+         fr.Fill();
+      }
+      file.Write();
+   }
+
+   TFile file(filename);
+   auto main = file.Get<TTree>("main");
+   auto fr = file.Get<TTree>("fr");
+   ASSERT_NE(main, nullptr);
+   ASSERT_NE(fr, nullptr);
+   ASSERT_TRUE(fr->GetBranch("run")->HasBasketStats());
+   fr->BuildIndex("idx");
+   main->AddFriend(fr);
+
+   EXPECT_EQ(main->Draw("idx", "run == 42", "goff"), 100);
+   EXPECT_EQ(main->Draw("idx", "idx >= 4200 && run == 42 && idx < 4300", "goff"), 100);
+   gROOT->cd();
+   std::unique_ptr<TTree> copy{main->CopyTree("run >= 10 && run < 12")};
+   EXPECT_EQ(copy->GetEntries(), 200);
+   copy.reset();
+
+   main->RemoveFriend(fr);
+   gSystem->Unlink(filename);
+}